@@ -0,0 +1,71 @@
+/**
+ *  @file AllocationCounter.h
+ *      Counting of heap allocations by solver phase, for detecting
+ *      allocations in solver hot paths
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_ALLOCATIONCOUNTER_H
+#define CT_ALLOCATIONCOUNTER_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+//! Solver phases to which heap allocations are attributed.
+//! @see AllocationPhase
+enum class SolverPhase {
+    None, //!< Outside of any of the phases below
+    Newton, //!< Damped Newton iterations of the 1D solver
+    TimeStep, //!< Pseudo-transient time stepping of the 1D solver
+    Residual, //!< Residual evaluations of the 1D solver
+    Refine, //!< Grid refinement of the 1D solver
+    nPhases
+};
+
+//! Name of a solver phase, such as "time_step"
+const char* solverPhaseName(SolverPhase phase);
+
+//! Returns `true` if Cantera was compiled with the `track_allocations`
+//! option, which replaces the global `operator new` to count heap
+//! allocations.
+bool allocationTrackingEnabled();
+
+//! Number of heap allocations made by all threads in `phase` since the last
+//! call to resetAllocationCounts(). Always zero if allocation tracking is not
+//! enabled.
+size_t allocationCount(SolverPhase phase);
+
+//! Reset the allocation counts of all phases to zero
+void resetAllocationCounts();
+
+//! Attributes the heap allocations of the current thread to a solver phase
+//! for the lifetime of the object.
+/*!
+ * Phases nest, and allocations are attributed to the innermost phase. If
+ * allocation tracking is not enabled, this class does nothing.
+ */
+class AllocationPhase
+{
+public:
+#if CT_TRACK_ALLOCATIONS
+    explicit AllocationPhase(SolverPhase phase);
+    ~AllocationPhase();
+#else
+    explicit AllocationPhase(SolverPhase phase) {}
+#endif
+    AllocationPhase(const AllocationPhase&) = delete;
+    AllocationPhase& operator=(const AllocationPhase&) = delete;
+
+#if CT_TRACK_ALLOCATIONS
+private:
+    SolverPhase m_previous;
+#endif
+};
+
+}
+
+#endif
@@ -0,0 +1,105 @@
+/**
+ *  @file Tracer.h
+ *      Scoped tracing spans which can be exported as a Chrome trace (see
+ *      \ref Cantera::TraceSpan).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_TRACER_H
+#define CT_TRACER_H
+
+#include "cantera/base/ct_defs.h"
+#include <atomic>
+
+namespace Cantera
+{
+
+//! Start recording tracing spans. Spans recorded previously are kept.
+void startTracing();
+
+//! Stop recording tracing spans
+void stopTracing();
+
+//! Discard all recorded tracing spans
+void clearTrace();
+
+//! Number of tracing spans recorded by all threads
+size_t traceEventCount();
+
+//! Set the name shown for the calling thread in exported traces. The default
+//! is "thread <n>", where *n* is the order in which threads recorded their
+//! first span.
+void setTraceThreadName(const std::string& name);
+
+//! Write the recorded spans to `filename` in the Chrome trace event format,
+//! which can be viewed with `chrome://tracing` or https://ui.perfetto.dev.
+/*!
+ * Spans which are still open are not included. Threads may continue to
+ * record spans while the trace is being written.
+ */
+void writeTrace(const std::string& filename);
+
+//! A span of time in the trace of the current thread, which lasts for the
+//! lifetime of the object.
+/*!
+ * Each thread records its spans into its own buffer. When tracing is not
+ * enabled, creating a span costs a single relaxed atomic load, so spans can be
+ * placed in frequently called functions:
+ *
+ * @code
+ * void GasKinetics::updateROP()
+ * {
+ *     TraceSpan span("GasKinetics::updateROP", "kinetics");
+ *     ...
+ * }
+ * @endcode
+ *
+ * @see startTracing(), writeTrace()
+ */
+class TraceSpan
+{
+public:
+    //! @param name  Name of the span. Must be a string literal, or otherwise
+    //!     outlive the recorded trace.
+    //! @param category  Category of the span, such as the name of the module.
+    //!     Must be a string literal.
+    TraceSpan(const char* name, const char* category="cantera") :
+        m_name(nullptr)
+    {
+        if (s_enabled.load(std::memory_order_relaxed)) {
+            begin(name, category);
+        }
+    }
+
+    ~TraceSpan() {
+        if (m_name) {
+            end();
+        }
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+    //! True if spans are being recorded
+    static bool enabled() {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+private:
+    void begin(const char* name, const char* category);
+    void end();
+
+    const char* m_name;
+    const char* m_category;
+    long long m_start; //!< Start time [ns]
+
+    static std::atomic<bool> s_enabled;
+    friend void startTracing();
+    friend void stopTracing();
+};
+
+}
+
+#endif
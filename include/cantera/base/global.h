@@ -139,6 +139,15 @@ inline void debuglog(const std::string& msg, int loglevel)
     }
 }
 
+//! Write a message to the log only if loglevel > 0. Avoids constructing a
+//! temporary string when the message is not written.
+inline void debuglog(const char* msg, int loglevel)
+{
+    if (loglevel > 0) {
+        writelog_direct(msg);
+    }
+}
+
 //! Write a formatted message to the screen.
 //!
 //! This function passes its arguments to the fmt library 'format' function to
@@ -0,0 +1,37 @@
+/**
+ * @file ctserver.h
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CTC_SERVER_H
+#define CTC_SERVER_H
+
+#include "clib_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    CANTERA_CAPI int chemclient_new(const char* name);
+    CANTERA_CAPI int chemclient_del(int i);
+    CANTERA_CAPI size_t chemclient_nSpecies(int i);
+    CANTERA_CAPI int chemclient_getSpeciesName(int i, size_t k, size_t lennm,
+                                               char* nm);
+    CANTERA_CAPI size_t chemclient_maxPoints(int i);
+    CANTERA_CAPI int chemclient_setTimeout(int i, double seconds);
+    CANTERA_CAPI int chemclient_getNetProductionRates(int i, size_t n,
+            const double* T, const double* P, const double* Y, double* wdot);
+    CANTERA_CAPI int chemclient_getProperties(int i, size_t n, const double* T,
+            const double* P, const double* Y, double* props);
+    CANTERA_CAPI int chemclient_advanceReactors(int i, size_t n, double dt,
+            double* T, const double* P, double* Y);
+    CANTERA_CAPI int chemclient_shutdownServer(int i);
+    CANTERA_CAPI int ct_clearChemClients();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
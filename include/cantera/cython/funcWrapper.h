@@ -28,6 +28,10 @@ public:
         formattedMessage_ = "\n" + std::string(71, '*') + "\n";
         formattedMessage_ += "Exception raised in Python callback function:\n";
 
+        // The message may be requested by the C++ solver while the GIL is
+        // released, e.g. to log a failed Newton iteration
+        PyGILState_STATE gil = PyGILState_Ensure();
+
         PyObject* name = PyObject_GetAttrString(m_type, "__name__");
         PyObject* value_str = PyObject_Str(m_value);
 
@@ -57,6 +61,7 @@ public:
 
         Py_XDECREF(name);
         Py_XDECREF(value_str);
+        PyGILState_Release(gil);
 
         formattedMessage_ += "\n" + std::string(71, '*') + "\n";
         return formattedMessage_.c_str();
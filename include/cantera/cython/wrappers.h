@@ -19,26 +19,34 @@ int get_sundials_version()
     return SUNDIALS_VERSION;
 }
 
+// Log messages may be written by solvers which are called with the GIL
+// released, so each method acquires the GIL before calling the Python API.
 class PythonLogger : public Cantera::Logger
 {
 public:
     virtual void write(const std::string& s) {
         // 1000 bytes is the maximum size permitted by PySys_WriteStdout
         static const size_t N = 999;
+        PyGILState_STATE gil = PyGILState_Ensure();
         for (size_t i = 0; i < s.size(); i+=N) {
             PySys_WriteStdout("%s", s.substr(i, N).c_str());
         }
+        PyGILState_Release(gil);
         std::cout.flush();
     }
 
     virtual void writeendl() {
+        PyGILState_STATE gil = PyGILState_Ensure();
         PySys_WriteStdout("%s", "\n");
+        PyGILState_Release(gil);
         std::cout.flush();
     }
 
     virtual void error(const std::string& msg) {
         std::string err = "raise Exception('''"+msg+"''')";
+        PyGILState_STATE gil = PyGILState_Ensure();
         PyRun_SimpleString(err.c_str());
+        PyGILState_Release(gil);
     }
 };
 
@@ -151,6 +151,11 @@ protected:
         return m_comp[k*m_mm + m];
     }
 
+    //! Name of element m, used in log messages
+    virtual std::string elementName(size_t m) const {
+        return m_phase->elementName(m);
+    }
+
     /*!
      * Prepare for equilibrium calculations.
      * @param s object representing the solution phase.
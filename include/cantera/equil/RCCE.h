@@ -0,0 +1,184 @@
+/**
+ *  @file RCCE.h Rate-controlled constrained equilibrium.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_RCCE_H
+#define CT_RCCE_H
+
+#include "ChemEquil.h"
+#include "cantera/numerics/DenseMatrix.h"
+
+namespace Cantera
+{
+
+/**
+ * Class RCCE computes rate-controlled constrained-equilibrium (RCCE) states of
+ * an ideal gas mixture. In RCCE, the composition is assumed to be the
+ * equilibrium composition subject to a set of linear constraints
+ *
+ * \f[
+ *     c_j = \sum_k a_{kj} n_k
+ * \f]
+ *
+ * where \f$ n_k \f$ is the number of moles of species *k* per unit mass. The
+ * constraints always include the element abundances, to which any number of
+ * additional constraints on groups of slowly-reacting species can be added.
+ * The constrained-equilibrium composition is
+ *
+ * \f[
+ *     n_k = \exp\left(\nu - \frac{\mu^0_k}{RT} + \sum_j a_{kj} \lambda_j \right)
+ * \f]
+ *
+ * where the \f$ \lambda_j \f$ are the dimensionless constraint potentials,
+ * which reduce to the element potentials used by ChemEquil for the element
+ * constraints, and \f$ \nu \f$ is the log of the total number of moles per
+ * unit mass.
+ *
+ * The evolution of the state is then described by the rates of change of the
+ * constraints, which are evaluated from the chemical production rates, instead
+ * of the rates of change of every species. getPotentialRates() transforms
+ * these into rates of change of the constraint potentials and the temperature
+ * for an adiabatic system at constant pressure, which are the variables
+ * integrated by RCCEReactor.
+ *
+ * The element potential solver of ChemEquil is used to generate an initial
+ * estimate of the constraint potentials by treating each constraint as an
+ * additional element.
+ * @ingroup equil
+ */
+class RCCE : public ChemEquil
+{
+public:
+    //! Constructor, with the element abundances as the only constraints.
+    //! @param s  Ideal gas phase
+    RCCE(thermo_t& s);
+
+    //! Add a constraint on a linear combination of the species abundances.
+    /*!
+     * @param name    Name of the constraint
+     * @param coeffs  Coefficient of each species in the constraint. Species not
+     *     included have coefficients of zero.
+     * @returns the index of the new constraint
+     */
+    size_t addConstraint(const std::string& name, const compositionMap& coeffs);
+
+    //! Number of constraints, including the element constraints
+    size_t nConstraints() const {
+        return m_mm;
+    }
+
+    //! Name of constraint `j`. The element constraints are named after the
+    //! corresponding elements.
+    std::string constraintName(size_t j) const;
+
+    //! Index of the constraint named `name`, or `npos` if there is no such
+    //! constraint.
+    size_t constraintIndex(const std::string& name) const;
+
+    //! Coefficient of species `k` in constraint `j`
+    double constraintCoeff(size_t k, size_t j) const {
+        return nAtoms(k, j);
+    }
+
+    //! Get the values of the constraints [kmol/kg] for the current
+    //! composition of the phase
+    void getConstraints(double* c) const;
+
+    //! Get the rates of change of the constraints [kmol/kg/s] corresponding
+    //! to the species net production rates `wdot` [kmol/m^3/s] at the current
+    //! density of the phase.
+    void getConstraintRates(const double* wdot, double* cdot) const;
+
+    //! Current values of the dimensionless constraint potentials
+    const vector_fp& constraintPotentials() const {
+        return m_lambda;
+    }
+
+    //! Set the phase to the constrained-equilibrium state with the
+    //! constraint values `c` [kmol/kg] at the current pressure.
+    /*!
+     * @param c  Values of the constraints. Length nConstraints().
+     * @param holdTemperature  If `true`, the temperature of the phase is held
+     *     constant. Otherwise, the specific enthalpy of the phase is held
+     *     constant.
+     * @param loglevel  Enable logging of the iterations if greater than 0.
+     */
+    void setToConstrainedEquilState(const double* c,
+                                    bool holdTemperature = false,
+                                    int loglevel = 0);
+
+    //! Set the phase to the constrained-equilibrium state for the
+    //! constraint potentials `lambda` and temperature `T` at the current
+    //! pressure.
+    void setState_Potentials(const double* lambda, double T);
+
+    //! Compute the rates of change of the constraint potentials and of the
+    //! temperature for the constrained-equilibrium state of the phase.
+    /*!
+     * The rates are the solution of the linear system obtained by
+     * differentiating the constraints, the specific enthalpy and the
+     * normalization of the mole fractions with respect to time, at constant
+     * pressure.
+     *
+     * @param cdot  Rates of change of the constraints [kmol/kg/s]
+     * @param hdot  Rate of change of the specific enthalpy [J/kg/s]
+     * @param[out] lambdaDot  Rates of change of the constraint potentials
+     *     [1/s]. Length nConstraints().
+     * @param holdTemperature  If `true`, the temperature is held constant
+     *     and `hdot` is not used.
+     * @returns the rate of change of the temperature [K/s]
+     */
+    double getPotentialRates(const double* cdot, double hdot,
+                             double* lambdaDot, bool holdTemperature = false);
+
+protected:
+    virtual std::string elementName(size_t m) const {
+        return constraintName(m);
+    }
+
+    //! Update the species properties used to construct #m_jac for the
+    //! current temperature of the phase. If `fromPotentials` is true, the
+    //! composition is evaluated from the constraint potentials and #m_nu.
+    //! Otherwise, the composition of the phase is used.
+    void updateSpeciesProperties(bool fromPotentials);
+
+    //! Fill #m_jac with the derivatives of the constraints, specific
+    //! enthalpy and sum of the mole fractions with respect to the constraint
+    //! potentials, #m_nu and the temperature.
+    void updateJacobian();
+
+    //! Scale the rows of #m_jac and the right hand side #m_rhs, and solve
+    //! for the update, which is returned in #m_rhs
+    void solveJacobian();
+
+    //! Names of the constraints which are not element constraints
+    std::vector<std::string> m_names;
+
+    //! Log of the number of moles per unit mass [kmol/kg]
+    double m_nu;
+
+    //! Species moles per unit mass [kmol/kg]
+    vector_fp m_n;
+
+    //! Species mole fractions. These do not sum to exactly one unless the
+    //! state satisfies the normalization condition.
+    vector_fp m_x;
+
+    //! Dimensionless partial molar enthalpies, h_k / RT
+    vector_fp m_hk;
+
+    //! Dimensionless partial molar heat capacities, cp_k / R
+    vector_fp m_cpk;
+
+    //! Jacobian of [constraints, enthalpy / RT, sum of mole fractions] with
+    //! respect to [potentials, #m_nu, temperature]
+    DenseMatrix m_jac;
+    vector_fp m_rhs;
+};
+
+}
+
+#endif
@@ -0,0 +1,214 @@
+//! @file TwoPhaseFlash.h Isothermal, isobaric vapor-liquid flash
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_TWOPHASEFLASH_H
+#define CT_TWOPHASEFLASH_H
+
+#include "cantera/thermo/ThermoPhase.h"
+
+namespace Cantera
+{
+
+/*!
+ * Two-phase vapor-liquid flash at fixed temperature, pressure and overall
+ * composition. This is a fast alternative to MultiPhase::equilibrate for the
+ * common problem of distributing the components of a non-reacting mixture,
+ * for example a multicomponent liquid fuel, between a vapor and a liquid.
+ *
+ * The components are the species of the vapor phase. Each species of the
+ * liquid phase must also be a species of the vapor phase, with the same name.
+ * Species of the vapor phase that are not present in the liquid phase are
+ * treated as non-condensable gases.
+ *
+ * The equilibrium ratios \f$ K_k = y_k / x_k \f$ are obtained by successive
+ * substitution,
+ *
+ * \f[
+ *     \ln K_k^{(n+1)} = \frac{\mu_k^L(x^{(n)}) - \mu_k^V(y^{(n)})}{RT}
+ *         + \ln \frac{y_k^{(n)}}{x_k^{(n)}}
+ * \f]
+ *
+ * where the compositions of both phases are obtained from the current
+ * equilibrium ratios by solving the Rachford-Rice equation for the vapor
+ * fraction with Newton's method. The substitution is accelerated by
+ * extrapolation along the dominant eigenvector of the iteration every few
+ * iterations. Since the chemical potentials are taken from the phase
+ * objects, any pair of phases can be used, for example an IdealGasPhase
+ * vapor with an ideal solution liquid (Raoult's law), or two
+ * RedlichKwongMFTP phases. For a RedlichKwongMFTP phase, the root of the
+ * equation of state corresponding to the role of the phase is selected
+ * explicitly.
+ *
+ * The Rachford-Rice equation is solved for any vapor fraction that gives
+ * positive compositions ("negative flash"), so the iteration is not
+ * interrupted when one of the phases disappears. A converged vapor fraction
+ * outside of [0, 1] indicates a single-phase mixture.
+ *
+ * The equilibrium ratios of each flash are used as the initial estimate for
+ * the next one, which makes repeated flashes at nearby conditions, such as
+ * adjacent grid points, much cheaper than the first one.
+ *
+ * @ingroup equil
+ */
+class TwoPhaseFlash
+{
+public:
+    //! Constructor.
+    //! @param vapor   Vapor phase. Its species are the components.
+    //! @param liquid  Liquid phase. The state of both phases is modified by
+    //!     the flash.
+    TwoPhaseFlash(ThermoPhase& vapor, ThermoPhase& liquid);
+
+    //! Number of components, which is the number of species of the vapor
+    //! phase
+    size_t nComponents() const {
+        return m_lnK.size();
+    }
+
+    //! Set the convergence tolerance on the logarithms of the equilibrium
+    //! ratios. The default is 1e-10.
+    void setTolerance(double tol) {
+        m_tol = tol;
+    }
+
+    //! Set the maximum number of successive substitution iterations. The
+    //! default is 500.
+    void setMaxIterations(int n) {
+        m_maxiter = n;
+    }
+
+    //! Compute the equilibrium split of a mixture.
+    /*!
+     * On return, the vapor and liquid phases are set to the compositions of
+     * the coexisting phases. If the mixture is a single phase, the other
+     * phase is set to the composition of its incipient phase.
+     *
+     * @param T  Temperature [K]
+     * @param P  Pressure [Pa]
+     * @param z  Overall mole fractions of the components. Length
+     *     nComponents().
+     * @returns the number of iterations
+     */
+    int flash(double T, double P, const double* z);
+
+    //! Compute the equilibrium split of `n` mixtures.
+    /*!
+     * Each flash is warm started from the result of the previous one, or
+     * from the equilibrium ratios given in `lnK` if this is not null.
+     *
+     * @param n  Number of mixtures
+     * @param T  Temperatures [K]. Length `n`.
+     * @param P  Pressures [Pa]. Length `n`.
+     * @param z  Overall mole fractions. Those of mixture `i` start at
+     *     `z[i*nComponents()]`.
+     * @param[out] beta  Molar vapor fractions. Length `n`.
+     * @param[out] x  Liquid mole fractions, in the same layout as `z`. May be
+     *     null.
+     * @param[out] y  Vapor mole fractions, in the same layout as `z`. May be
+     *     null.
+     * @param[in,out] lnK  Logarithms of the equilibrium ratios, in the same
+     *     layout as `z`, used as the initial estimate and overwritten with
+     *     the result. May be null.
+     */
+    void flash(size_t n, const double* T, const double* P, const double* z,
+               double* beta, double* x=0, double* y=0, double* lnK=0);
+
+    //! Molar vapor fraction from the last flash, between 0 and 1
+    double vaporFraction() const {
+        return m_beta;
+    }
+
+    //! Number of phases present after the last flash
+    int nPhases() const {
+        return (m_beta > 0.0 && m_beta < 1.0) ? 2 : 1;
+    }
+
+    //! Liquid mole fractions of the components from the last flash
+    void getLiquidMoleFractions(double* x) const;
+
+    //! Vapor mole fractions of the components from the last flash
+    void getVaporMoleFractions(double* y) const;
+
+    //! Get the logarithms of the equilibrium ratios. The ratio of a
+    //! non-condensable component is infinite.
+    void getLogKValues(double* lnK) const;
+
+    //! Set the logarithms of the equilibrium ratios used as the initial
+    //! estimate for the next flash. Entries for non-condensable components
+    //! are ignored.
+    void setLogKValues(const double* lnK);
+
+    //! Discard the equilibrium ratios of previous flashes, so that the next
+    //! flash starts from Wilson's correlation if the liquid phase provides
+    //! critical properties, and from the fugacities of the pure liquid
+    //! components otherwise.
+    void resetKValues() {
+        m_warm = false;
+    }
+
+    //! Solve the Rachford-Rice equation
+    /*!
+     * \f[
+     *     \sum_k \frac{z_k (K_k - 1)}{1 + \beta (K_k - 1)} = 0
+     * \f]
+     *
+     * for the vapor fraction \f$ \beta \f$ on the interval where all phase
+     * compositions are positive. This interval includes values outside of
+     * [0, 1]. Components with an infinite value of `K` are non-condensable.
+     *
+     * @param n     Number of components
+     * @param z     Overall mole fractions
+     * @param K     Equilibrium ratios
+     * @param beta  Initial estimate. Not used if it is outside of the
+     *     interval.
+     * @returns the vapor fraction. If the equation has no root because all
+     *     ratios are at least one, +Inf is returned. If all ratios are at most
+     *     one, -Inf is returned.
+     */
+    static double solveRachfordRice(size_t n, const double* z,
+                                    const double* K, double beta=0.5);
+
+protected:
+    //! Compute the phase compositions #m_x and #m_y from the overall
+    //! composition and #m_lnK, and set #m_beta to the unbounded vapor
+    //! fraction.
+    void splitComposition(const double* z);
+
+    //! Set the state of `phase` to `T`, `P` and the component mole fractions
+    //! `xc`. `liquid` selects the root of a cubic equation of state.
+    void setPhaseState(ThermoPhase& phase, bool liquid, double T, double P,
+                       const double* xc);
+
+    //! Compute new values of the logarithms of the equilibrium ratios from
+    //! the states of the phases. Returns the largest change.
+    double updateKValues(vector_fp& lnK);
+
+    ThermoPhase& m_vap;
+    ThermoPhase& m_liq;
+
+    //! Index in the liquid phase of each component, or `npos` for
+    //! non-condensable components
+    std::vector<size_t> m_liqIndex;
+
+    //! Logarithms of the equilibrium ratios
+    vector_fp m_lnK;
+
+    //! Vapor fraction, and component mole fractions of the liquid and vapor
+    double m_beta;
+    vector_fp m_x, m_y;
+
+    //! Work arrays
+    vector_fp m_K, m_xl, m_muV, m_muL, m_lnKold, m_dlnK, m_dlnKold;
+
+    double m_tol;
+    int m_maxiter;
+
+    //! True if #m_lnK holds the result of a previous flash
+    bool m_warm;
+};
+
+}
+
+#endif
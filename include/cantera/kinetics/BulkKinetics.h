@@ -43,6 +43,7 @@ public:
     virtual void invalidateCache();
 
 protected:
+    virtual void reserveReactions(size_t n);
     virtual void addElementaryReaction(ElementaryReaction& r);
     virtual void modifyElementaryReaction(size_t i, ElementaryReaction& rNew);
 
@@ -13,6 +13,7 @@
 #include "ThirdBodyCalc.h"
 #include "FalloffMgr.h"
 #include "Reaction.h"
+#include "cantera/numerics/DenseMatrix.h"
 
 namespace Cantera
 {
@@ -58,15 +59,75 @@ public:
     void updateROP();
 
     //! Update temperature-dependent portions of reaction rates and falloff
-    //! functions.
+    //! functions, and the pressure-dependent portion of P-log and Chebyshev
+    //! reactions if the pressure has changed.
     virtual void update_rates_T();
 
     //! Update properties that depend on concentrations.
     //! Currently the enhanced collision partner concentrations are updated
-    //! here, as well as the pressure-dependent portion of P-log and Chebyshev
-    //! reactions.
+    //! here.
     virtual void update_rates_C();
 
+    //! @name Quasi-Steady-State Approximation
+    /*!
+     * In the quasi-steady-state approximation (QSSA), the net production
+     * rates of a set of short-lived species (typically radicals) are assumed
+     * to be zero. The concentrations of these species are not taken from the
+     * phase, but are computed algebraically each time the rates of progress
+     * are evaluated, by solving the coupled system of species balances for
+     * the QSS species given the concentrations of all other species. The
+     * rates of progress of all reactions are then evaluated using these
+     * concentrations, so that the net production rates of the QSS species
+     * are zero and the fast time scales associated with them are removed
+     * from any reactor or flame model using this kinetics manager.
+     *
+     * Terms which are linear in the QSS concentrations are treated exactly.
+     * If the rate of a reaction depends nonlinearly on the QSS
+     * concentrations, the system is solved by fixed-point iteration, starting
+     * from the concentrations of the QSS species in the phase, and a
+     * CanteraError is thrown if the iteration does not converge. Third-body
+     * and falloff efficiencies always use the concentrations in the phase.
+     *
+     * The QSS concentrations are used only to compute the rates of progress;
+     * the phase itself is not modified. Use getQSSConcentrations() to obtain
+     * them, or applyQSSConcentrations() to write them to the phase.
+     *
+     * The QSS species are not removed from the systems solved by reactor and
+     * flame models, which still contain one unknown per species. Flow domains
+     * (StFlow) solve for the mass fractions of the QSS species as algebraic
+     * components equal to the QSS values. In reactors, the QSS species have
+     * zero net production rates. After each step of a ReactorNet, the QSS
+     * concentrations are written to the phase of each reactor (see
+     * Reactor::updateQSSState), so that its contents are consistent with
+     * the rates.
+     */
+    //! @{
+
+    //! Set the species treated as quasi-steady-state species. An empty list
+    //! disables the approximation. Each species must be consumed by at least
+    //! one reaction.
+    void setQSSSpecies(const std::vector<std::string>& names);
+
+    //! Names of the quasi-steady-state species, in order of increasing
+    //! species index
+    std::vector<std::string> qssSpecies() const;
+
+    //! Select the species with a chemical lifetime shorter than `tau` [s] at
+    //! the current state as the quasi-steady-state species. The lifetime of
+    //! each species is its concentration divided by its destruction rate,
+    //! evaluated without the QSSA. Species which are not consumed by any
+    //! reaction are never selected. Returns the number of selected species.
+    size_t selectQSSSpecies(double tau);
+
+    virtual void getQSSConcentrations(double* conc);
+
+    virtual void applyQSSConcentrations();
+
+    virtual bool isQSSSpecies(size_t k) const {
+        return k < m_qssIndex.size() && m_qssIndex[k] != npos;
+    }
+    //! @}
+
 protected:
     //! Reaction index of each falloff reaction
     std::vector<size_t> m_fallindx;
@@ -117,6 +178,56 @@ protected:
 
     //! Update the equilibrium constants in molar units.
     void updateKc();
+
+    //! A forward or reverse rate of progress which involves the QSS species.
+    struct QSSTerm {
+        size_t rxn; //!< reaction index
+        bool reverse; //!< true for the reverse rate of progress
+        //! Index in #m_qss and reaction order of each QSS species which the
+        //! rate of progress depends on
+        std::vector<std::pair<size_t, double>> orders;
+        //! Index in #m_qss and net production per unit rate of progress of
+        //! each QSS species produced or consumed by this term
+        std::vector<std::pair<size_t, double>> stoich;
+    };
+
+    //! Set up #m_qssTerms for the current QSS species and reactions
+    void initQSS();
+
+    //! True if species `k` is consumed by the forward direction of a reaction
+    //! or by the reverse direction of a reversible reaction
+    bool hasDestructionPath(size_t k) const;
+
+    //! Compute the QSS concentrations and apply them to the rates of
+    //! progress. On entry, #m_ropf and #m_ropr contain the rate constants;
+    //! on return, they contain the rates of progress.
+    void solveQSS();
+
+    //! Kinetics species indices of the quasi-steady-state species, in
+    //! increasing order
+    std::vector<size_t> m_qss;
+
+    //! Index in #m_qss of each kinetics species, or npos for species which
+    //! are not quasi-steady-state species
+    std::vector<size_t> m_qssIndex;
+
+    //! Forward and reverse rates of progress which involve the QSS species
+    std::vector<QSSTerm> m_qssTerms;
+
+    //! True if #m_qssTerms is up to date
+    bool m_qssReady;
+
+    //! True if all rates of progress are at most linear in the QSS
+    //! concentrations, in which case no iteration is needed
+    bool m_qssLinear;
+
+    //! Concentrations of the QSS species
+    vector_fp m_qssConc;
+
+    //! Work arrays for the QSS species balances
+    DenseMatrix m_qssJac;
+    vector_fp m_qssRhs;
+    vector_fp m_qssWork;
 };
 
 }
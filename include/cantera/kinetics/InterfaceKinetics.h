@@ -130,12 +130,8 @@ public:
     doublereal electrochem_beta(size_t irxn) const;
 
     virtual bool isReversible(size_t i) {
-        if (std::find(m_revindex.begin(), m_revindex.end(), i)
-                < m_revindex.end()) {
-            return true;
-        } else {
-            return false;
-        }
+        checkReactionIndex(i);
+        return m_reactions[i]->reversible;
     }
 
     virtual void getFwdRateConstants(doublereal* kfwd);
@@ -265,6 +261,28 @@ public:
     void solvePseudoSteadyStateProblem(int ifuncOverride = -1,
                                        doublereal timeScaleOverride = 1.0);
 
+    //! Derivatives of the net production rates with respect to the surface
+    //! coverages
+    /*!
+     * The derivatives are evaluated analytically at the current state, holding
+     * the temperature and the state of the other phases constant. Only
+     * available for mechanisms without coverage-dependent rate constants or
+     * electrochemical reactions. @see coverageDerivativesAvailable()
+     *
+     * @param dwdot  Output array of length nTotalSpecies() times the number of
+     *     surface species, where `dwdot[n*nTotalSpecies() + k]` is the
+     *     derivative of the net production rate of kinetic species `k` with
+     *     respect to the coverage of surface species `n` [kmol/m^2/s].
+     */
+    void getNetProductionRatesCoverageDerivatives(doublereal* dwdot);
+
+    //! Returns true if getNetProductionRatesCoverageDerivatives() can be used
+    //! for this mechanism
+    bool coverageDerivativesAvailable() const {
+        return !m_has_coverage_dependence && !m_has_electrochem_rxns &&
+               !m_phaseExistsCheck;
+    }
+
     void setIOFlag(int ioFlag);
 
     //! Update the standard state chemical potentials and species equilibrium
@@ -396,6 +414,23 @@ protected:
 
     bool m_redo_rates;
 
+    //! Temperature and pressure of each phase, followed by the site density of
+    //! the surface, for which the rate constants and equilibrium constants
+    //! were last evaluated
+    vector_fp m_rateState;
+
+    //! Check whether the temperature or pressure of any phase, or the site
+    //! density, has changed since the rate constants were last evaluated,
+    //! and update #m_rateState.
+    bool rateStateChanged();
+
+    //! For each reaction, the kinetic species indices and orders of the
+    //! forward and reverse rate expressions, and the net stoichiometric
+    //! coefficients. Used for computing coverage derivatives.
+    std::vector<std::vector<std::pair<size_t, double>>> m_fwdOrders;
+    std::vector<std::vector<std::pair<size_t, double>>> m_revOrders;
+    std::vector<std::vector<std::pair<size_t, double>>> m_netStoich;
+
     //! Vector of irreversible reaction numbers
     /*!
      * vector containing the reaction numbers of irreversible reactions.
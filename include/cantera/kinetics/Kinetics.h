@@ -15,6 +15,7 @@
 #include "StoichManager.h"
 #include "cantera/kinetics/Reaction.h"
 #include "cantera/base/global.h"
+#include <unordered_map>
 
 namespace Cantera
 {
@@ -661,6 +662,26 @@ public:
         throw NotImplementedError("Kinetics::getFwdRateConstants");
     }
 
+    //! True if the concentration of kinetics species `k` is computed by the
+    //! kinetics manager from a quasi-steady-state approximation, rather than
+    //! taken from the phase. The net production rate of such a species is
+    //! zero. @see GasKinetics::setQSSSpecies
+    virtual bool isQSSSpecies(size_t k) const {
+        return false;
+    }
+
+    //! Get the concentrations [kmol/m^3] of the quasi-steady-state species
+    //! at the current state, in order of increasing species index. These are
+    //! the concentrations used to compute the rates of progress; the phase is
+    //! not modified. @see isQSSSpecies
+    virtual void getQSSConcentrations(double* conc) {}
+
+    //! Write the quasi-steady-state concentrations at the current state to
+    //! the phase, keeping its temperature, density and the mass fractions of
+    //! all other species. Does nothing if there are no quasi-steady-state
+    //! species.
+    virtual void applyQSSConcentrations() {}
+
     //! @}
     //! @name Reaction Mechanism Construction
     //! @{
@@ -708,6 +729,35 @@ public:
      */
     virtual bool addReaction(shared_ptr<Reaction> r);
 
+    /**
+     * Add a set of reactions to the mechanism. The result is the same as
+     * calling addReaction() for each reaction in turn, but the setup which
+     * does not depend on the individual reactions is done only once:
+     *
+     *   - All reactions are validated (see Reaction::validate()) before any
+     *     of them are added, so that a reaction which fails validation leaves
+     *     the mechanism unmodified. Errors detected while a reaction is being
+     *     added, such as an undeclared species when undeclared species are
+     *     not skipped, are not rolled back: the reactions preceding the one
+     *     which failed remain in the mechanism, as they would if
+     *     addReaction() had been called for each reaction in turn.
+     *   - Storage for the complete set of reactions is reserved up front.
+     *   - resizeSpecies() is called once, rather than once per reaction. The
+     *     phases may therefore not be modified while the reactions are added.
+     *   - Species names are resolved to kinetics species indices once, and
+     *     reused by all subsequent reactions which refer to the same name.
+     *
+     * This is the method used by importKinetics(), and is significantly
+     * faster than adding reactions individually for large mechanisms.
+     *
+     * An empty list of reactions leaves the kinetics manager unchanged.
+     *
+     * @param reactions  Reactions to be added
+     * @return The number of reactions which were added, i.e. excluding
+     *     reactions skipped because of undeclared species.
+     */
+    size_t addReactions(const std::vector<shared_ptr<Reaction>>& reactions);
+
     /**
      * Modify the rate expression associated with a reaction. The
      * stoichiometric equation, type of the reaction, reaction orders, third
@@ -921,6 +971,21 @@ protected:
 
     //! @see skipUndeclaredThirdBodies()
     bool m_skipUndeclaredThirdBodies;
+
+    //! Reserve storage for a total of `n` reactions. Called by addReactions()
+    //! before adding the reactions. Derived classes should call the base class
+    //! method in addition to reserving their own per-reaction arrays.
+    virtual void reserveReactions(size_t n);
+
+    //! True while addReactions() is adding a set of reactions. In this case,
+    //! addReaction() skips the validation and the call to resizeSpecies(),
+    //! which have already been done for the complete set.
+    bool m_bulkAssembly;
+
+    //! Kinetics species indices of species names which have been looked up
+    //! by kineticsSpeciesIndex(const std::string&) during addReactions().
+    //! Empty except while adding a set of reactions.
+    mutable std::unordered_map<std::string, size_t> m_speciesLookup;
 };
 
 }
@@ -217,36 +217,57 @@ public:
     }
 
     //! Default constructor.
-    Plog() {}
+    Plog() : single_(false) {}
 
     //! Constructor from Arrhenius rate expressions at a set of pressures
     explicit Plog(const std::multimap<double, Arrhenius>& rates);
 
     //! Update concentration-dependent parts of the rate coefficient.
-    //! @param c natural log of the pressure in Pa
+    /*!
+     * If only a single rate expression is given at each of the two
+     * interpolation pressures, the interpolated rate at a fixed pressure is
+     * itself a modified Arrhenius expression, whose parameters are computed
+     * here so that updateRC() only needs to evaluate one expression.
+     *
+     * @param c natural log of the pressure in Pa
+     */
     void update_C(const doublereal* c) {
         logP_ = c[0];
-        if (logP_ > logP1_ && logP_ < logP2_) {
-            return;
+        if (logP_ <= logP1_ || logP_ >= logP2_) {
+            auto iter = pressures_.upper_bound(c[0]);
+            AssertThrowMsg(iter != pressures_.end(), "Plog::update_C",
+                           "Pressure out of range: {}", logP_);
+            AssertThrowMsg(iter != pressures_.begin(), "Plog::update_C",
+                           "Pressure out of range: {}", logP_);
+
+            // upper interpolation pressure
+            logP2_ = iter->first;
+            ihigh1_ = iter->second.first;
+            ihigh2_ = iter->second.second;
+
+            // lower interpolation pressure
+            logP1_ = (--iter)->first;
+            ilow1_ = iter->second.first;
+            ilow2_ = iter->second.second;
+
+            rDeltaP_ = 1.0 / (logP2_ - logP1_);
         }
 
-        auto iter = pressures_.upper_bound(c[0]);
-        AssertThrowMsg(iter != pressures_.end(), "Plog::update_C",
-                       "Pressure out of range: {}", logP_);
-        AssertThrowMsg(iter != pressures_.begin(), "Plog::update_C",
-                       "Pressure out of range: {}", logP_);
-
-        // upper interpolation pressure
-        logP2_ = iter->first;
-        ihigh1_ = iter->second.first;
-        ihigh2_ = iter->second.second;
-
-        // lower interpolation pressure
-        logP1_ = (--iter)->first;
-        ilow1_ = iter->second.first;
-        ilow2_ = iter->second.second;
-
-        rDeltaP_ = 1.0 / (logP2_ - logP1_);
+        const Arrhenius& r1 = rates_[ilow1_];
+        const Arrhenius& r2 = rates_[ihigh1_];
+        single_ = (ilow2_ == ilow1_ + 1 && ihigh2_ == ihigh1_ + 1
+                   && r1.preExponentialFactor() > 0
+                   && r2.preExponentialFactor() > 0);
+        if (single_) {
+            double f = (logP_ - logP1_) * rDeltaP_;
+            double logA1 = std::log(r1.preExponentialFactor());
+            double logA2 = std::log(r2.preExponentialFactor());
+            logA_ = logA1 + f * (logA2 - logA1);
+            b_ = r1.temperatureExponent()
+                 + f * (r2.temperatureExponent() - r1.temperatureExponent());
+            E_ = r1.activationEnergy_R()
+                 + f * (r2.activationEnergy_R() - r1.activationEnergy_R());
+        }
     }
 
     /**
@@ -255,6 +276,9 @@ public:
      * This function returns the actual value of the rate constant.
      */
     doublereal updateRC(doublereal logT, doublereal recipT) const {
+        if (single_) {
+            return std::exp(logA_ + b_*logT - E_*recipT);
+        }
         double log_k1, log_k2;
         if (ilow1_ == ilow2_) {
             log_k1 = rates_[ilow1_].updateLog(logT, recipT);
@@ -306,6 +330,15 @@ protected:
     size_t ilow1_, ilow2_, ihigh1_, ihigh2_;
 
     double rDeltaP_; //!< reciprocal of (logP2 - logP1)
+
+    //! True if there is a single rate expression at each of the current
+    //! interpolation pressures, in which case the rate is evaluated using the
+    //! equivalent Arrhenius parameters #logA_, #b_ and #E_
+    bool single_;
+
+    double logA_; //!< log of the equivalent pre-exponential factor
+    double b_; //!< equivalent temperature exponent
+    double E_; //!< equivalent activation energy [K]
 };
 
 //! Pressure-dependent rate expression where the rate coefficient is expressed
@@ -0,0 +1,282 @@
+//! @file UncertaintyEnsemble.h Ensemble propagation of rate constant
+//!     uncertainties
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_UNCERTAINTYENSEMBLE_H
+#define CT_UNCERTAINTYENSEMBLE_H
+
+#include "cantera/base/ct_defs.h"
+#include "cantera/base/ctexceptions.h"
+#include <functional>
+
+namespace Cantera
+{
+
+class Kinetics;
+
+//! Thrown by EnsembleModel::solve() when the output of a sample lies outside
+//! the range the model can resolve, for example an ignition delay that is
+//! longer than the integration horizon.
+/*!
+ * Unlike other errors, this does not mean that the model failed: the output
+ * of the sample is known to lie beyond a bound. Such samples are recorded
+ * by UncertaintyEnsemble as censored rather than failed.
+ *
+ * @ingroup errorhandling
+ */
+class CensoredSampleError : public CanteraError
+{
+public:
+    template <typename... Args>
+    CensoredSampleError(const std::string& procedure, const std::string& msg,
+                        const Args&... args)
+        : CanteraError(procedure, msg, args...) {}
+
+    virtual std::string getClass() const {
+        return "CensoredSampleError";
+    }
+};
+
+//! A model that is solved repeatedly by an UncertaintyEnsemble, for example
+//! an ignition delay calculation or a flame.
+/*!
+ * Each thread of the ensemble uses its own instance of the model. The model
+ * of the first thread is solved with the nominal rate constants using
+ * solveNominal(), and the models of the other threads take its nominal
+ * solution using copyNominal(). Each model is then solved once per sample
+ * using solve(), after the rate multipliers of kinetics() have been set to
+ * the values of the sample. Models should use the nominal solution to speed
+ * up the solution of the samples, for example as an initial guess.
+ *
+ * @ingroup kineticsmgr
+ */
+class EnsembleModel
+{
+public:
+    virtual ~EnsembleModel() {}
+
+    //! Kinetics manager whose rate multipliers are perturbed for each sample
+    virtual Kinetics& kinetics() = 0;
+
+    //! Number of scalar outputs of the model
+    virtual size_t nOutputs() const = 0;
+
+    //! Solve the model with the nominal rate constants
+    //! @param[out] outputs  Outputs of the model. Length nOutputs().
+    virtual void solveNominal(double* outputs) = 0;
+
+    //! Take the nominal solution from *other*, a model whose solveNominal()
+    //! has been called, instead of solving the nominal case again. Returns
+    //! false if the nominal solution cannot be copied, in which case
+    //! solveNominal() is called instead. The default returns false.
+    virtual bool copyNominal(const EnsembleModel& other) {
+        return false;
+    }
+
+    //! Solve the model with the current rate multipliers. A
+    //! CensoredSampleError thrown by this method marks the sample as
+    //! censored, and any other CanteraError marks it as failed.
+    //! @param[out] outputs  Outputs of the model. Length nOutputs().
+    virtual void solve(double* outputs) = 0;
+};
+
+//! Streaming statistics of the outputs of an ensemble.
+/*!
+ * The mean, variance, extrema of each output and the covariance of each
+ * output with each parameter are updated one sample at a time, using
+ * Welford's algorithm, so that the samples themselves do not need to be
+ * stored. Statistics gathered separately, for example by different threads,
+ * can be combined with merge().
+ *
+ * @ingroup kineticsmgr
+ */
+class EnsembleStatistics
+{
+public:
+    EnsembleStatistics(size_t nOutputs=0, size_t nParameters=0);
+
+    //! Add one sample with outputs *y* and parameters *p*
+    void add(const double* y, const double* p);
+
+    //! Add the samples summarized by *other*
+    void merge(const EnsembleStatistics& other);
+
+    //! Number of samples
+    size_t count() const {
+        return m_count;
+    }
+
+    size_t nOutputs() const {
+        return m_mean.size();
+    }
+
+    size_t nParameters() const {
+        return m_pmean.size();
+    }
+
+    //! Mean of output *i*
+    double mean(size_t i) const {
+        return m_mean[i];
+    }
+
+    //! Sample variance of output *i*
+    double variance(size_t i) const;
+
+    //! Sample standard deviation of output *i*
+    double stdDev(size_t i) const {
+        return std::sqrt(variance(i));
+    }
+
+    //! Smallest value of output *i*
+    double min(size_t i) const {
+        return m_min[i];
+    }
+
+    //! Largest value of output *i*
+    double max(size_t i) const {
+        return m_max[i];
+    }
+
+    //! Sample covariance of output *i* and parameter *j*
+    double covariance(size_t i, size_t j) const;
+
+    //! Correlation coefficient of output *i* and parameter *j*. Zero if
+    //! either of them does not vary.
+    double correlation(size_t i, size_t j) const;
+
+protected:
+    size_t m_count;
+
+    //! Means and sums of squared deviations of the outputs
+    vector_fp m_mean, m_M2;
+    vector_fp m_min, m_max;
+
+    //! Means and sums of squared deviations of the parameters
+    vector_fp m_pmean, m_pM2;
+
+    //! Sums of products of the deviations of the outputs and the parameters.
+    //! The co-moment of output `i` and parameter `j` is at
+    //! `i*nParameters() + j`.
+    vector_fp m_C;
+};
+
+//! Monte Carlo propagation of uncertainties in rate constants.
+/*!
+ * The rate constant of each reaction is multiplied by a factor whose
+ * logarithm is normally distributed with mean zero. The uncertainty of
+ * reaction `i` is given as the factor @f$ f_i @f$ by which its rate constant
+ * is uncertain at two standard deviations, so that @f$ \ln f_i / 2 @f$ is the
+ * standard deviation of the logarithm of the multiplier.
+ *
+ * Only the rate multipliers (see Kinetics::setMultiplier) of the models
+ * change from one sample to the next, so the mechanism is parsed only once per
+ * thread. The parameters of each sample are generated from the seed and the
+ * index of the sample, so that the same samples are drawn regardless of the
+ * number of threads and the order in which the samples are solved. The
+ * parameters recorded in the statistics are the logarithms of the
+ * multipliers, so that EnsembleStatistics::correlation gives linear
+ * sensitivities of the outputs.
+ *
+ * The statistics only include the samples that were solved. Samples whose
+ * outputs lie beyond the range of the model (see CensoredSampleError) are
+ * listed by censoredSamples(), and samples for which the model failed by
+ * failedSamples(). If there are censored samples, the statistics are
+ * conditional on the output being within that range; for example, the mean
+ * ignition delay is biased towards short delays. The number of censored
+ * samples should be reported along with the statistics.
+ *
+ * @ingroup kineticsmgr
+ */
+class UncertaintyEnsemble
+{
+public:
+    //! Constructor.
+    //! @param nReactions  Number of reactions of the models
+    explicit UncertaintyEnsemble(size_t nReactions);
+
+    //! Number of reactions, which is also the number of parameters
+    size_t nParameters() const {
+        return m_sigma.size();
+    }
+
+    //! Set the uncertainty factor of reaction *i*. A factor of one means
+    //! the reaction is not perturbed, which is the default.
+    void setUncertaintyFactor(size_t i, double f);
+
+    //! Set the uncertainty factors of all reactions
+    void setUncertaintyFactors(const vector_fp& f);
+
+    //! Set the seed of the random number generator
+    void setSeed(unsigned long seed) {
+        m_seed = seed;
+    }
+
+    //! Set the number of threads used by run(). Zero means one thread per
+    //! hardware thread.
+    void setThreads(size_t n) {
+        m_nThreads = n;
+    }
+
+    //! Logarithms of the rate multipliers of *sample*
+    //! @param[out] lnm  Length nParameters()
+    void getLogMultipliers(size_t sample, double* lnm) const;
+
+    //! Forward rate constants of the samples `first` to `first+n-1` at the
+    //! current state of *kin*. The multipliers of the samples replace those
+    //! set on *kin*, which are left unchanged.
+    //! @param[out] kf  The rate constants of sample `first+s` start at
+    //!     `kf[s*nParameters()]`.
+    void getFwdRateConstants(Kinetics& kin, size_t first, size_t n,
+                             double* kf) const;
+
+    //! Solve *nSamples* samples.
+    //! @param nSamples  Number of samples
+    //! @param factory   Creates the model used by one thread. Called
+    //!     from the calling thread, once for each thread.
+    void run(size_t nSamples,
+             const std::function<std::unique_ptr<EnsembleModel>()>& factory);
+
+    //! Statistics of the samples solved by the last call to run()
+    const EnsembleStatistics& statistics() const {
+        return m_stats;
+    }
+
+    //! Outputs of the model with the nominal rate constants
+    const vector_fp& nominalOutputs() const {
+        return m_nominal;
+    }
+
+    //! Indices of the samples for which the model could not be solved, in
+    //! increasing order
+    const std::vector<size_t>& failedSamples() const {
+        return m_failed;
+    }
+
+    //! Indices of the samples whose outputs lie beyond the range of the
+    //! model, in increasing order. These samples are not included in the
+    //! statistics.
+    const std::vector<size_t>& censoredSamples() const {
+        return m_censored;
+    }
+
+protected:
+    //! Standard deviation of the logarithm of each multiplier
+    vector_fp m_sigma;
+
+    //! Indices of the reactions that are perturbed
+    std::vector<size_t> m_perturbed;
+
+    unsigned long m_seed;
+    size_t m_nThreads;
+
+    EnsembleStatistics m_stats;
+    vector_fp m_nominal;
+    std::vector<size_t> m_failed;
+    std::vector<size_t> m_censored;
+};
+
+}
+
+#endif
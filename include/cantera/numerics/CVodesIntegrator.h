@@ -37,6 +37,16 @@ public:
     virtual void setProblemType(int probtype);
     virtual void initialize(double t0, FuncEval& func);
     virtual void reinitialize(double t0, FuncEval& func);
+
+    //! Enable or disable warm restarts. The Jacobian is only reused for the
+    //! problem type `DENSE + NOJAC`; for other problem types, only the step
+    //! size is kept. See Integrator::setWarmRestart.
+    virtual void setWarmRestart(bool warm, double jacTol=0.05,
+                                int maxJacAge=20);
+    virtual void invalidateJacobian() {
+        m_jacValid = false;
+    }
+
     virtual void integrate(double tout);
     virtual doublereal step(double tout);
     virtual double& solution(size_t k);
@@ -45,11 +55,21 @@ public:
         return static_cast<int>(m_neq);
     }
     virtual int nEvals() const;
+    virtual int nSteps() const;
+    virtual int nNonlinIters() const;
+    virtual int nJacEvals() const;
+
+    //! The number of Jacobians computed since the last call to initialize()
+    //! or reinitialize(). Unlike nJacEvals(), this does not count the
+    //! requests for a Jacobian which are answered with the Jacobian saved for
+    //! warm restarts.
+    int nJacBuilds() const;
     virtual void setMaxOrder(int n) {
         m_maxord = n;
     }
     virtual void setMethod(MethodType t);
     virtual void setIterator(IterType t);
+    virtual void setInitialStepSize(double h0);
     virtual void setMaxStepSize(double hmax);
     virtual void setMinStepSize(double hmin);
     virtual void setMaxSteps(int nmax);
@@ -72,6 +92,26 @@ public:
     //! Error message information provide by CVodes
     std::string m_error_message;
 
+    //! The object which evaluates the equations being integrated
+    FuncEval* funcEval() {
+        return m_func;
+    }
+
+    //! Evaluate the dense Jacobian by finite differences, or return the
+    //! Jacobian saved from the previous integration after a warm restart.
+    //! Called by CVODES when warm restarts are enabled.
+    /*!
+     * @param t    Current time
+     * @param y    Current state
+     * @param fy   Right hand side evaluated at `y`
+     * @param jac  Pointers to the columns of the Jacobian
+     * @param ewt  Work vector, used for the error weights
+     * @param ftemp  Work vector, used for the perturbed right hand side
+     * @returns 0 on success, or the error flag returned by the FuncEval
+     */
+    int evalJacobian(double t, N_Vector y, N_Vector fy, double** jac,
+                     N_Vector ewt, N_Vector ftemp);
+
 protected:
     //! Applies user-specified options to the underlying CVODES solver. Called
     //! during integrator initialization or reinitialization.
@@ -95,7 +135,7 @@ private:
     double m_abstols;
     double m_reltolsens, m_abstolsens;
     size_t m_nabs;
-    double m_hmax, m_hmin;
+    double m_h0, m_hmax, m_hmin;
     int m_maxsteps;
     int m_maxErrTestFails;
     N_Vector* m_yS;
@@ -105,6 +145,37 @@ private:
     //! Indicates whether the sensitivities stored in m_yS have been updated
     //! for at the current integrator time.
     bool m_sens_ok;
+
+    //! @name Warm restarts
+    //! @see setWarmRestart()
+    //! @{
+    bool m_warmStart;
+    double m_jacTol;
+    int m_maxJacAge;
+
+    //! Most recent Jacobian, stored by column
+    vector_fp m_jac;
+
+    //! State at which #m_jac was evaluated
+    vector_fp m_jacState;
+
+    //! Sensitivity parameters of the FuncEval for which #m_jac was evaluated
+    vector_fp m_jacParams;
+
+    //! True if #m_jac corresponds to the current problem
+    bool m_jacValid;
+
+    //! True if #m_jac should be used the next time CVODES requests a
+    //! Jacobian, instead of computing a new one
+    bool m_reuseJac;
+
+    //! Number of reinitializations for which #m_jac has been reused
+    int m_jacAge;
+
+    //! Number of Jacobians computed by evalJacobian() since the last
+    //! (re)initialization
+    int m_nJacBuilds;
+    //! @}
 };
 
 } // namespace
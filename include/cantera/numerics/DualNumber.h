@@ -0,0 +1,333 @@
+/**
+ *  @file DualNumber.h
+ *      Dual numbers for forward-mode automatic differentiation (see
+ *      \ref Cantera::autodiff::Dual).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_DUALNUMBER_H
+#define CT_DUALNUMBER_H
+
+#include "cantera/base/ct_defs.h"
+#include <array>
+
+namespace Cantera
+{
+
+//! Dual numbers and their operators and math functions. The functions are
+//! found by argument-dependent lookup, and are kept out of namespace Cantera
+//! so they don't hide the functions from `<cmath>` there.
+namespace autodiff
+{
+
+//! A value together with its derivatives with respect to `N` independent
+//! variables, for forward-mode automatic differentiation.
+/*!
+ * Functions written as templates on their scalar type can be evaluated with
+ * `Dual<N>` arguments to obtain exact derivatives along with the function
+ * value. Seeding the derivative of independent variable *i* in direction *i*
+ * gives `N` columns of the Jacobian in a single evaluation:
+ *
+ * @code
+ * Dual<2> x(3.0), y(2.0);
+ * x.setDerivative(0, 1.0);
+ * y.setDerivative(1, 1.0);
+ * Dual<2> f = x * exp(y);
+ * // f.derivative(0) == exp(2.0), f.derivative(1) == 3.0*exp(2.0)
+ * @endcode
+ *
+ * Comparisons use only the values, so a branch in the function is
+ * differentiated on the side that is taken.
+ *
+ * In such templates, calls to the math functions should be unqualified and
+ * preceded by `using std::exp;` etc., so that the overloads for `double` and
+ * for `Dual` are both found.
+ *
+ * @ingroup numerics
+ */
+template <size_t N>
+class Dual
+{
+public:
+    Dual(double value=0.0) : m_value(value) {
+        m_deriv.fill(0.0);
+    }
+
+    double value() const {
+        return m_value;
+    }
+
+    double derivative(size_t i) const {
+        return m_deriv[i];
+    }
+
+    void setDerivative(size_t i, double d) {
+        m_deriv[i] = d;
+    }
+
+    //! Set the value and clear all derivatives
+    Dual& operator=(double value) {
+        m_value = value;
+        m_deriv.fill(0.0);
+        return *this;
+    }
+
+    Dual& operator+=(const Dual& y) {
+        m_value += y.m_value;
+        for (size_t i = 0; i < N; i++) {
+            m_deriv[i] += y.m_deriv[i];
+        }
+        return *this;
+    }
+
+    Dual& operator-=(const Dual& y) {
+        m_value -= y.m_value;
+        for (size_t i = 0; i < N; i++) {
+            m_deriv[i] -= y.m_deriv[i];
+        }
+        return *this;
+    }
+
+    Dual& operator*=(const Dual& y) {
+        for (size_t i = 0; i < N; i++) {
+            m_deriv[i] = m_deriv[i] * y.m_value + m_value * y.m_deriv[i];
+        }
+        m_value *= y.m_value;
+        return *this;
+    }
+
+    Dual& operator/=(const Dual& y) {
+        double r = 1.0 / y.m_value;
+        m_value *= r;
+        for (size_t i = 0; i < N; i++) {
+            m_deriv[i] = (m_deriv[i] - m_value * y.m_deriv[i]) * r;
+        }
+        return *this;
+    }
+
+    Dual& operator+=(double y) {
+        m_value += y;
+        return *this;
+    }
+
+    Dual& operator-=(double y) {
+        m_value -= y;
+        return *this;
+    }
+
+    Dual& operator*=(double y) {
+        m_value *= y;
+        for (size_t i = 0; i < N; i++) {
+            m_deriv[i] *= y;
+        }
+        return *this;
+    }
+
+    Dual& operator/=(double y) {
+        return *this *= 1.0 / y;
+    }
+
+    //! Apply the chain rule for a function with value `f` and derivative
+    //! `dfdx` at value() of this object
+    Dual chain(double f, double dfdx) const {
+        Dual r(f);
+        for (size_t i = 0; i < N; i++) {
+            r.m_deriv[i] = dfdx * m_deriv[i];
+        }
+        return r;
+    }
+
+private:
+    double m_value;
+    std::array<double, N> m_deriv;
+};
+
+//! @name Arithmetic operators for Dual
+//! @{
+
+template <size_t N>
+Dual<N> operator-(const Dual<N>& x) {
+    return x.chain(-x.value(), -1.0);
+}
+
+template <size_t N>
+Dual<N> operator+(Dual<N> x, const Dual<N>& y) {
+    return x += y;
+}
+
+template <size_t N>
+Dual<N> operator+(Dual<N> x, double y) {
+    return x += y;
+}
+
+template <size_t N>
+Dual<N> operator+(double x, Dual<N> y) {
+    return y += x;
+}
+
+template <size_t N>
+Dual<N> operator-(Dual<N> x, const Dual<N>& y) {
+    return x -= y;
+}
+
+template <size_t N>
+Dual<N> operator-(Dual<N> x, double y) {
+    return x -= y;
+}
+
+template <size_t N>
+Dual<N> operator-(double x, const Dual<N>& y) {
+    return -y + x;
+}
+
+template <size_t N>
+Dual<N> operator*(Dual<N> x, const Dual<N>& y) {
+    return x *= y;
+}
+
+template <size_t N>
+Dual<N> operator*(Dual<N> x, double y) {
+    return x *= y;
+}
+
+template <size_t N>
+Dual<N> operator*(double x, Dual<N> y) {
+    return y *= x;
+}
+
+template <size_t N>
+Dual<N> operator/(Dual<N> x, const Dual<N>& y) {
+    return x /= y;
+}
+
+template <size_t N>
+Dual<N> operator/(Dual<N> x, double y) {
+    return x /= y;
+}
+
+template <size_t N>
+Dual<N> operator/(double x, const Dual<N>& y) {
+    double r = x / y.value();
+    return y.chain(r, -r / y.value());
+}
+
+//! @}
+//! @name Comparison operators for Dual, which compare only the values
+//! @{
+
+#define CT_DUAL_COMPARISON(OP) \
+template <size_t N> \
+bool operator OP(const Dual<N>& x, const Dual<N>& y) { \
+    return x.value() OP y.value(); \
+} \
+template <size_t N> \
+bool operator OP(const Dual<N>& x, double y) { \
+    return x.value() OP y; \
+} \
+template <size_t N> \
+bool operator OP(double x, const Dual<N>& y) { \
+    return x OP y.value(); \
+}
+
+CT_DUAL_COMPARISON(<)
+CT_DUAL_COMPARISON(>)
+CT_DUAL_COMPARISON(<=)
+CT_DUAL_COMPARISON(>=)
+CT_DUAL_COMPARISON(==)
+CT_DUAL_COMPARISON(!=)
+
+#undef CT_DUAL_COMPARISON
+
+//! @}
+//! @name Math functions for Dual
+//! @{
+
+template <size_t N>
+Dual<N> exp(const Dual<N>& x) {
+    double f = std::exp(x.value());
+    return x.chain(f, f);
+}
+
+template <size_t N>
+Dual<N> log(const Dual<N>& x) {
+    return x.chain(std::log(x.value()), 1.0 / x.value());
+}
+
+template <size_t N>
+Dual<N> sqrt(const Dual<N>& x) {
+    double f = std::sqrt(x.value());
+    return x.chain(f, 0.5 / f);
+}
+
+template <size_t N>
+Dual<N> pow(const Dual<N>& x, double a) {
+    return x.chain(std::pow(x.value(), a), a * std::pow(x.value(), a - 1.0));
+}
+
+template <size_t N>
+Dual<N> pow(double a, const Dual<N>& x) {
+    double f = std::pow(a, x.value());
+    return x.chain(f, f * std::log(a));
+}
+
+template <size_t N>
+Dual<N> pow(const Dual<N>& x, const Dual<N>& y) {
+    return exp(y * log(x));
+}
+
+template <size_t N>
+Dual<N> abs(const Dual<N>& x) {
+    return (x.value() < 0) ? -x : x;
+}
+
+template <size_t N>
+Dual<N> max(const Dual<N>& x, const Dual<N>& y) {
+    return (x.value() < y.value()) ? y : x;
+}
+
+template <size_t N>
+Dual<N> max(const Dual<N>& x, double y) {
+    return (x.value() < y) ? Dual<N>(y) : x;
+}
+
+template <size_t N>
+Dual<N> max(double x, const Dual<N>& y) {
+    return (x < y.value()) ? y : Dual<N>(x);
+}
+
+template <size_t N>
+Dual<N> min(const Dual<N>& x, const Dual<N>& y) {
+    return (y.value() < x.value()) ? y : x;
+}
+
+template <size_t N>
+Dual<N> min(const Dual<N>& x, double y) {
+    return (y < x.value()) ? Dual<N>(y) : x;
+}
+
+template <size_t N>
+Dual<N> min(double x, const Dual<N>& y) {
+    return (y.value() < x) ? y : Dual<N>(x);
+}
+
+//! @}
+
+} // namespace autodiff
+
+using autodiff::Dual;
+
+//! The value of a scalar, with its derivatives discarded
+inline double scalarValue(double x) {
+    return x;
+}
+
+template <size_t N>
+double scalarValue(const Dual<N>& x) {
+    return x.value();
+}
+
+}
+
+#endif
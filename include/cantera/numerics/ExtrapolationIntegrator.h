@@ -0,0 +1,93 @@
+/**
+ *  @file ExtrapolationIntegrator.h
+ *      Extrapolated linearly implicit Euler integrator for stiff ODE systems
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_EXTRAPOLATIONINTEGRATOR_H
+#define CT_EXTRAPOLATIONINTEGRATOR_H
+
+#include "cantera/numerics/LinearlyImplicitIntegrator.h"
+
+namespace Cantera
+{
+
+//! Extrapolation method based on the linearly implicit Euler method, with
+//! variable order and step size.
+/*!
+ * Each step of size \f$ H \f$ computes approximations \f$ T_{j1} \f$ of the
+ * solution using \f$ n_j = 1, 2, 3, \ldots \f$ substeps of the linearly
+ * implicit Euler method
+ *
+ * \f[
+ *     (I/h - J) (y_{m+1} - y_m) = f(t_m, y_m) + h \frac{\partial f}{\partial t}
+ * \f]
+ *
+ * with \f$ h = H / n_j \f$, which are combined by Aitken-Neville
+ * extrapolation into a solution of order \f$ j \f$. The difference between
+ * the two most extrapolated values estimates the error. The number of
+ * columns and the step size are chosen to minimize the work per unit step,
+ * following the code SEULEX of Hairer and Wanner (Solving Ordinary
+ * Differential Equations II, Section IV.9). The Jacobian is evaluated once
+ * per step, and one factorization is required per column.
+ *
+ * Create with `newIntegrator("Extrapolation")`.
+ *
+ * @ingroup odeGroup
+ */
+class ExtrapolationIntegrator : public LinearlyImplicitIntegrator
+{
+public:
+    ExtrapolationIntegrator();
+
+    //! Set the maximum number of columns of the extrapolation table, which
+    //! is the highest order of the method. Must be at least 3. The default
+    //! is 6.
+    virtual void setMaxOrder(int n);
+
+    //! Number of columns of the extrapolation table used by the last step,
+    //! which is the order of its solution.
+    int lastOrder() const {
+        return m_klast + 1;
+    }
+
+protected:
+    virtual void takeStep(double tmax);
+    virtual void resetMethod();
+
+    //! Compute column `j` of the extrapolation table for a step of size `H`
+    //! from #m_t, and extrapolate. Returns `false` if the computation failed
+    //! or the linearly implicit Euler iteration is not contracting.
+    bool computeColumn(size_t j, double H);
+
+    //! Maximum number of columns
+    size_t m_kmax;
+
+    //! Optimal column index for the next step (zero-based)
+    size_t m_kopt;
+
+    //! Column index used by the last step
+    size_t m_klast;
+
+    //! Extrapolation table. After computing column `j`, `m_table[0]` is the
+    //! most extrapolated value and `m_table[1]` the next lower order value.
+    std::vector<vector_fp> m_table;
+
+    //! Right-hand side at the start of the step and its time derivative
+    vector_fp m_f0, m_dfdt;
+
+    //! Increment of the current substep
+    vector_fp m_del;
+
+    //! Work per unit step and proposed step size for each column
+    vector_fp m_work, m_hopt;
+
+    //! True if the last step was rejected
+    bool m_rejected;
+};
+
+}
+
+#endif
@@ -11,6 +11,7 @@
 #include "cantera/base/ct_defs.h"
 #include "cantera/base/ctexceptions.h"
 #include "cantera/base/global.h"
+#include "cantera/base/Array.h"
 
 namespace Cantera
 {
@@ -49,6 +50,26 @@ public:
      */
     int eval_nothrow(double t, double* y, double* ydot);
 
+    //! Evaluate the Jacobian of the right-hand-side function.
+    /*!
+     * Used by integrators that need the Jacobian explicitly, such as the
+     * Rosenbrock and extrapolation integrators. The default implementation
+     * does nothing and returns `false`, in which case the integrator
+     * computes the Jacobian by finite differences.
+     *
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq(). May be modified during the
+     *     evaluation, but is restored on return.
+     * @param[out] ydot rate of change of solution vector, length neq()
+     * @param[in] p sensitivity parameter vector, length nparams()
+     * @param[out] j Jacobian matrix, `j(m,n)` = d ydot[m] / d y[n]
+     * @returns `true` if the Jacobian was evaluated
+     */
+    virtual bool evalJacobian(double t, double* y, double* ydot, double* p,
+                              Array2D* j) {
+        return false;
+    }
+
     //! Fill in the vector *y* with the current state of the system
     virtual void getState(double* y) {
         throw NotImplementedError("FuncEval::getState");
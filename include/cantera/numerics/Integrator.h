@@ -110,6 +110,42 @@ public:
         warn("reinitialize");
     }
 
+    //! Enable or disable warm restarts.
+    /*!
+     * When warm restarts are enabled, reinitialize() keeps the last step size
+     * and, if the state has not changed too much, the Jacobian from the
+     * previous integration, instead of starting from a small initial step and
+     * a newly evaluated Jacobian.
+     *
+     * Integrators that do not store their Jacobian only keep the step size.
+     * In particular, CVodesIntegrator only reuses the Jacobian with the
+     * default problem type `DENSE + NOJAC`, where it evaluates the Jacobian
+     * itself; with the banded, diagonal and GMRES linear solvers, the
+     * Jacobian is evaluated by CVODES and `jacTol` and `maxJacAge` have no
+     * effect.
+     *
+     * The saved Jacobian is discarded if reinitialize() is called with a
+     * different FuncEval, or if the sensitivity parameters of the FuncEval
+     * (FuncEval::m_sens_params) have changed. Any other change to the
+     * equations, such as a change of a reaction rate multiplier, is not
+     * detected; call invalidateJacobian() before reinitialize() in that case.
+     *
+     * @param warm      Enable warm restarts
+     * @param jacTol    Largest relative change in any component of the state
+     *     for which the previous Jacobian is reused
+     * @param maxJacAge Maximum number of reinitializations for which the same
+     *     Jacobian is reused
+     */
+    virtual void setWarmRestart(bool warm, double jacTol=0.05,
+                                int maxJacAge=20) {
+        warn("setWarmRestart");
+    }
+
+    //! Discard the Jacobian saved for warm restarts, so that a new one is
+    //! evaluated after the next call to reinitialize(). Integrators which do
+    //! not reuse the Jacobian across restarts ignore this call.
+    virtual void invalidateJacobian() {}
+
     //! Integrate the system of equations.
     /*!
      * @param tout Integrate to this time. Note that this is the
@@ -153,6 +189,24 @@ public:
         return 0;
     }
 
+    //! The number of internal time steps taken.
+    virtual int nSteps() const {
+        warn("nSteps");
+        return 0;
+    }
+
+    //! The number of nonlinear (Newton) iterations performed.
+    virtual int nNonlinIters() const {
+        warn("nNonlinIters");
+        return 0;
+    }
+
+    //! The number of Jacobian evaluations.
+    virtual int nJacEvals() const {
+        warn("nJacEvals");
+        return 0;
+    }
+
     //! Set the maximum integration order that will be used.
     virtual void setMaxOrder(int n) {
         warn("setMaxorder");
@@ -168,6 +222,13 @@ public:
         warn("setInterator");
     }
 
+    //! Set the size of the first step after initialize() or reinitialize().
+    //! Zero, the default, lets the integrator estimate it. A nonzero value
+    //! also replaces the step size kept by warm restarts.
+    virtual void setInitialStepSize(double h0) {
+        warn("setInitialStepSize");
+    }
+
     //! Set the maximum step size
     virtual void setMaxStepSize(double hmax) {
         warn("setMaxStepSize");
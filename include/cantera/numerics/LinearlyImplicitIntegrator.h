@@ -0,0 +1,198 @@
+/**
+ *  @file LinearlyImplicitIntegrator.h
+ *      Base class for one-step integrators that solve linear systems with
+ *      the Jacobian of the ODE system
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_LINEARLYIMPLICITINTEGRATOR_H
+#define CT_LINEARLYIMPLICITINTEGRATOR_H
+
+#include "cantera/numerics/Integrator.h"
+#include "cantera/numerics/DenseMatrix.h"
+
+namespace Cantera
+{
+
+//! Base class for linearly implicit one-step integrators.
+/*!
+ * Linearly implicit methods, such as Rosenbrock methods and extrapolated
+ * linearly implicit Euler methods, evaluate the Jacobian once per step and
+ * replace the Newton iterations of implicit methods by a fixed number of
+ * linear solves. Since they carry no history from one step to the next, they
+ * have no start-up phase, which makes them efficient for short integrations
+ * such as the chemistry substeps of operator-split flow solvers.
+ *
+ * The Jacobian is obtained from FuncEval::evalJacobian if it is implemented,
+ * and by forward differences otherwise. Sensitivity analysis is not
+ * supported.
+ *
+ * This class handles the tolerances, the output times and the linear
+ * algebra. Derived classes implement takeStep().
+ *
+ * @ingroup odeGroup
+ */
+class LinearlyImplicitIntegrator : public Integrator
+{
+public:
+    LinearlyImplicitIntegrator();
+
+    virtual void setTolerances(double reltol, size_t n, double* abstol);
+    virtual void setTolerances(double reltol, double abstol);
+    virtual void setProblemType(int probtype) {}
+    virtual void initialize(double t0, FuncEval& func);
+    virtual void reinitialize(double t0, FuncEval& func);
+
+    //! Enable or disable warm restarts. With warm restarts, the first step
+    //! after reinitialize() uses the step size from the end of the previous
+    //! integration. A new Jacobian is evaluated for every step, so `jacTol`
+    //! and `maxJacAge` are not used.
+    virtual void setWarmRestart(bool warm, double jacTol=0.05,
+                                int maxJacAge=20) {
+        m_warm = warm;
+    }
+
+    virtual void integrate(double tout);
+    virtual double step(double tout);
+    virtual double& solution(size_t k) {
+        return m_y[k];
+    }
+    virtual double* solution() {
+        return m_y.data();
+    }
+    virtual int nEquations() const {
+        return static_cast<int>(m_neq);
+    }
+    virtual int nEvals() const {
+        return m_nevals;
+    }
+    virtual int nSteps() const {
+        return m_nsteps;
+    }
+    virtual int nNonlinIters() const {
+        return 0;
+    }
+    virtual int nJacEvals() const {
+        return m_njac;
+    }
+
+    //! Number of rejected steps
+    int nRejectedSteps() const {
+        return m_nrejected;
+    }
+
+    //! Number of LU factorizations
+    int nFactorizations() const {
+        return m_nfactor;
+    }
+
+    virtual void setInitialStepSize(double h0) {
+        m_h0 = h0;
+    }
+    virtual void setMaxStepSize(double hmax) {
+        m_hmax = hmax;
+    }
+    virtual void setMinStepSize(double hmin) {
+        m_hmin = hmin;
+    }
+    virtual void setMaxSteps(int nmax) {
+        m_maxsteps = nmax;
+    }
+    //! Set the maximum number of successive rejected steps. Zero selects
+    //! the default of 10.
+    virtual void setMaxErrTestFails(int n) {
+        m_maxfails = n;
+    }
+
+protected:
+    //! Take one successful step from #m_t, not going beyond `tmax`.
+    /*!
+     * On entry, #m_h is the proposed step size, which is zero for the first
+     * step of a problem. On return, #m_t and #m_y are the time and state at
+     * the end of the step, and #m_h is the proposed size of the next step.
+     */
+    virtual void takeStep(double tmax) = 0;
+
+    //! Reset method-specific data, such as the order, for a new problem
+    virtual void resetMethod() {}
+
+    //! Evaluate the right-hand side. Returns `false` if the evaluation
+    //! failed with a recoverable error.
+    bool evalRHS(double t, double* y, double* ydot);
+
+    //! Evaluate the Jacobian at (`t`, `y`) into #m_jac, and the right-hand
+    //! side into `ydot`. Returns `false` if an evaluation failed with a
+    //! recoverable error.
+    bool evalJacobian(double t, double* y, double* ydot);
+
+    //! Evaluate the partial derivative of the right-hand side with respect
+    //! to time at (`t`, `y`) by a forward difference, given the right-hand
+    //! side `ydot` at that point and the step size `h`. Returns `false` if
+    //! the evaluation failed with a recoverable error.
+    bool evalTimeDerivative(double t, double* y, const double* ydot,
+                            double* dfdt, double h);
+
+    //! Form and factorize the iteration matrix `c*I - J`. Returns `false`
+    //! if the matrix is singular.
+    bool factor(double c);
+
+    //! Solve the system with the iteration matrix. `b` is overwritten with
+    //! the solution.
+    void solveFactored(double* b);
+
+    //! Weighted root-mean-square norm of `err`, using error weights computed
+    //! from the larger magnitude of `y0` and `y1` in each component
+    double errorNorm(const double* err, const double* y0,
+                     const double* y1) const;
+
+    //! Initial step size for an integration to `tout`, given the
+    //! right-hand side `f0` at the initial state and the order of the method
+    //! (Hairer, Norsett and Wanner, Solving Ordinary Differential Equations
+    //! I, Section II.4)
+    double initialStepSize(double tout, const double* f0, int order);
+
+    //! Record a rejected step. Throws an exception if the step size becomes
+    //! too small or there are too many successive rejected steps.
+    void rejectStep(double h, const std::string& reason);
+
+    //! The object which evaluates the equations being integrated
+    FuncEval* m_func;
+
+    size_t m_neq;
+    double m_t; //!< Current time
+    double m_h; //!< Proposed size of the next step
+    vector_fp m_y; //!< Current solution
+
+    double m_rtol;
+    vector_fp m_atol;
+    double m_h0, m_hmax, m_hmin;
+    int m_maxsteps;
+    int m_maxfails;
+    bool m_warm;
+
+    //! Jacobian at the start of the current step
+    DenseMatrix m_jac;
+
+    //! LU factors of the iteration matrix
+    DenseMatrix m_M;
+
+    //! Pivots of the LU factorization, if LAPACK is not used
+    std::vector<long int> m_pivots;
+
+    //! False if the FuncEval object does not provide a Jacobian
+    bool m_userJac;
+
+    //! Work arrays
+    vector_fp m_ftmp, m_ytmp;
+
+    int m_nevals, m_nsteps, m_njac, m_nrejected, m_nfactor;
+
+    //! Number of successive rejected steps
+    int m_nfails;
+};
+
+}
+
+#endif
@@ -0,0 +1,61 @@
+/**
+ *  @file RosenbrockIntegrator.h
+ *      Fourth-order Rosenbrock integrator for stiff ODE systems
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_ROSENBROCKINTEGRATOR_H
+#define CT_ROSENBROCKINTEGRATOR_H
+
+#include "cantera/numerics/LinearlyImplicitIntegrator.h"
+
+namespace Cantera
+{
+
+//! Stiffly accurate Rosenbrock method of order 4 with an embedded method of
+//! order 3.
+/*!
+ * This is the method RODAS4 of Hairer and Wanner (Solving Ordinary
+ * Differential Equations II, Section VI.4), which uses six stages, each
+ * requiring one solve with the iteration matrix \f$ I/(h\gamma) - J \f$.
+ * The Jacobian and the iteration matrix are evaluated once per step. The
+ * time derivative of the right-hand side, needed for non-autonomous systems,
+ * is computed by a finite difference.
+ *
+ * Create with `newIntegrator("Rosenbrock")`.
+ *
+ * @ingroup odeGroup
+ */
+class RosenbrockIntegrator : public LinearlyImplicitIntegrator
+{
+public:
+    RosenbrockIntegrator();
+
+    //! Disable step size control and take steps of size `h`, except for the
+    //! last step to each output time. A value of zero restores the adaptive
+    //! step size selection. Intended for testing.
+    void setFixedStepSize(double h) {
+        m_hfixed = h;
+    }
+
+protected:
+    virtual void takeStep(double tmax);
+
+    //! Stage vectors
+    std::vector<vector_fp> m_k;
+
+    //! Right-hand side at the start of the step and its time derivative
+    vector_fp m_f0, m_dfdt;
+
+    //! Fixed step size, or zero for adaptive steps
+    double m_hfixed;
+
+    //! True if the last step was rejected
+    bool m_rejected;
+};
+
+}
+
+#endif
@@ -48,7 +48,7 @@ public:
     virtual ~Domain1D() {}
 
     //! Domain type flag.
-    int domainType() {
+    int domainType() const {
         return m_type;
     }
 
@@ -298,6 +298,24 @@ public:
         throw NotImplementedError("Domain1D::eval");
     }
 
+    //! Evaluate the columns of the steady-state Jacobian corresponding to the
+    //! solution components at global grid point *jg* directly, instead of by
+    //! finite differences.
+    /*!
+     *  The default implementation does nothing and returns `false`, in which
+     *  case the columns are computed by MultiJac using finite differences.
+     *  Domains which override this method must set all nonzero elements of
+     *  these columns, including those in rows belonging to adjacent domains.
+     *
+     *  @param jg  Global grid point
+     *  @param[in] xg  Global state vector
+     *  @param[out] jac  Jacobian matrix
+     *  @returns `true` if the columns were evaluated
+     */
+    virtual bool evalJacobianColumns(size_t jg, doublereal* xg, MultiJac& jac) {
+        return false;
+    }
+
     size_t index(size_t n, size_t j) const {
         return m_nv*j + n;
     }
@@ -333,6 +351,25 @@ public:
      */
     virtual void restore(const XML_Node& dom, doublereal* soln, int loglevel);
 
+    //! Set the solution for this domain by mapping the solution of another
+    //! domain of the same type
+    /*!
+     * The other domain may have a different grid and a different set of
+     * components, e.g. if it uses a different reaction mechanism. Components
+     * are matched by name, and are linearly interpolated onto the current grid
+     * of this domain. Components which are not present in the other domain
+     * are left unchanged. Derived classes should call the base class method
+     * in addition to mapping their own data.
+     *
+     * @param src   Domain to map the solution from
+     * @param xsrc  Solution vector of `src`, local to that domain
+     * @param soln  Solution vector, local to this domain
+     * @param loglevel 0 to suppress all output; 1 to show warnings; 2 for
+     *      verbose output
+     */
+    virtual void mapSolution(const Domain1D& src, const doublereal* xsrc,
+                             doublereal* soln, int loglevel);
+
     size_t size() const {
         return m_nv*m_points;
     }
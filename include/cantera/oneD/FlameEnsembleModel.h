@@ -0,0 +1,78 @@
+//! @file FlameEnsembleModel.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_FLAMEENSEMBLEMODEL_H
+#define CT_FLAMEENSEMBLEMODEL_H
+
+#include "cantera/kinetics/UncertaintyEnsemble.h"
+
+namespace Cantera
+{
+
+class Sim1D;
+
+//! A one-dimensional simulation used as a model of an UncertaintyEnsemble.
+/*!
+ * Each sample is solved starting from the nominal solution, on the nominal
+ * grid, which is usually much faster than solving it from the initial guess.
+ * The outputs are computed from the converged simulation by a user-supplied
+ * function.
+ *
+ * The model does not own the simulation or the kinetics manager. A class
+ * that creates them for each thread can derive from this class and call
+ * setSimulation() from its constructor.
+ *
+ * @ingroup onedim
+ */
+class FlameEnsembleModel : public EnsembleModel
+{
+public:
+    //! Function computing the outputs of a converged simulation
+    typedef std::function<void(Sim1D&, double*)> OutputFunction;
+
+    //! Constructor.
+    //! @param outputs   Function computing the outputs
+    //! @param nOutputs  Number of outputs
+    FlameEnsembleModel(const OutputFunction& outputs, size_t nOutputs);
+
+    //! Set the simulation and the kinetics manager used by its flow domains.
+    void setSimulation(Sim1D& sim, Kinetics& kin);
+
+    //! Set the options passed to Sim1D::solve for the nominal solution and
+    //! for the samples. By default, the grid is refined for the nominal
+    //! solution only.
+    void setRefine(bool nominal, bool samples) {
+        m_refineNominal = nominal;
+        m_refineSamples = samples;
+    }
+
+    virtual Kinetics& kinetics();
+
+    virtual size_t nOutputs() const {
+        return m_nOutputs;
+    }
+
+    virtual void solveNominal(double* outputs);
+    virtual bool copyNominal(const EnsembleModel& other);
+    virtual void solve(double* outputs);
+
+protected:
+    //! Restore the nominal grid and solution
+    void restoreNominal();
+
+    Sim1D* m_sim;
+    Kinetics* m_kin;
+    OutputFunction m_outputs;
+    size_t m_nOutputs;
+    bool m_refineNominal, m_refineSamples;
+
+    //! Nominal grid of each domain, and nominal solution
+    std::vector<vector_fp> m_grids;
+    vector_fp m_x0;
+};
+
+}
+
+#endif
@@ -0,0 +1,248 @@
+//! @file FlameletTable.h Tabulation of flamelet solutions for lookup by CFD codes
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_FLAMELETTABLE_H
+#define CT_FLAMELETTABLE_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class StFlow;
+class Sim1D;
+class ThermoPhase;
+
+/**
+ * Builds an N-dimensional table of flamelet solutions, which can be read back
+ * using class FlameletTable.
+ *
+ * The last axis of the table is always the Bilger mixture fraction, computed
+ * from the elemental composition of the fuel and oxidizer streams given to
+ * setStreams(). The other axes are defined with addAxis(), for example a
+ * progress variable, strain rate or liquid loading. Each flamelet added with
+ * addFlamelet() fills the values along the mixture fraction axis at one node
+ * of the other axes, so the flamelets have to cover all combinations of the
+ * nodes on these axes before the table can be written. Storing the mixture
+ * fraction last keeps each flamelet contiguous in the table.
+ *
+ * The profile of each flamelet is mapped from the spatial grid to the mixture
+ * fraction grid by linear interpolation, after sorting the grid points by
+ * mixture fraction. For mixture fractions outside the range covered by the
+ * flamelet, the value at the nearest end of the range is used.
+ *
+ * The tabulated variables are given by name when constructing the builder:
+ *  - `T`: temperature [K]
+ *  - `rho`: density [kg/m^3]
+ *  - `hrr`: heat release rate [W/m^3]
+ *  - the name of a species: mass fraction of that species
+ *  - `wdot:` followed by the name of a species: net mass production rate of
+ *    that species [kg/m^3/s]
+ *
+ * @ingroup onedim
+ */
+class FlameletTableBuilder
+{
+public:
+    //! Constructor.
+    //! @param phase      Phase used by the flow domains of the flamelets
+    //! @param variables  Names of the tabulated variables
+    //! @param nZ         Number of points on the mixture fraction axis, which
+    //!                   is uniform between 0 and 1
+    FlameletTableBuilder(ThermoPhase& phase,
+                         const std::vector<std::string>& variables,
+                         size_t nZ);
+
+    //! Set the mixture fraction axis to the (increasing) values *Z*. Any
+    //! flamelets that were already added are discarded.
+    void setMixtureFractionGrid(const vector_fp& Z);
+
+    //! Set the compositions of the fuel and oxidizer streams, which define
+    //! the mixture fraction. The compositions are given as mass fractions, in
+    //! a form accepted by ThermoPhase::setMassFractionsByName.
+    void setStreams(const std::string& fuel, const std::string& oxidizer);
+
+    //! Add an axis to the table, before the mixture fraction axis. Any
+    //! flamelets that were already added are discarded.
+    //! @param name    Name of the variable along this axis
+    //! @param values  Nodes of the axis, in increasing order
+    void addAxis(const std::string& name, const vector_fp& values);
+
+    //! Add the flamelet solved for by *sim*.
+    //! @param sim     Converged simulation
+    //! @param dom     Index of the flow domain in *sim*
+    //! @param coords  Coordinates of the flamelet on the axes added with
+    //!                addAxis(). Each value has to match a node of the axis.
+    void addFlamelet(Sim1D& sim, size_t dom, const vector_fp& coords);
+
+    //! Add a flamelet given the solution *x* of the flow domain *flow*.
+    //! @param flow    Flow domain. Its phase and kinetics managers are used
+    //!                to evaluate the tabulated variables.
+    //! @param x       Solution of the flow domain only, starting with the
+    //!                first component at the first grid point
+    //! @param coords  Coordinates of the flamelet on the axes added with
+    //!                addAxis()
+    void addFlamelet(StFlow& flow, const double* x, const vector_fp& coords);
+
+    //! Mixture fraction corresponding to the mass fractions *Y*
+    double mixtureFraction(const double* Y) const;
+
+    //! Write the table to *filename*. Throws an exception if there are nodes
+    //! of the table for which no flamelet was added.
+    void write(const std::string& filename) const;
+
+protected:
+    //! Bilger's coupling function for the mass fractions *Y*
+    double bilgerBeta(const double* Y) const;
+
+    ThermoPhase& m_phase;
+
+    //! Names of the axes, with the mixture fraction last
+    std::vector<std::string> m_axisNames;
+
+    //! Nodes on each axis
+    std::vector<vector_fp> m_axes;
+
+    //! Number of nodes on the mixture fraction axis
+    size_t m_nZ;
+
+    //! Names of the tabulated variables
+    std::vector<std::string> m_varNames;
+
+    //! For each variable, its type (`T`, `rho`, `hrr`, species or production
+    //! rate) and the associated species index, if any
+    std::vector<std::pair<int, size_t>> m_vars;
+
+    //! Contribution of each species to Bilger's coupling function, per unit
+    //! mass fraction
+    vector_fp m_spWeight;
+
+    //! Coupling function for the oxidizer and fuel streams
+    double m_betaOx, m_betaFuel;
+
+    //! Tabulated values. The variables are stored contiguously for each node,
+    //! and the last axis varies fastest.
+    vector_fp m_data;
+
+    //! Whether a flamelet has been added at each node of the axes before the
+    //! mixture fraction
+    std::vector<bool> m_filled;
+};
+
+/**
+ * Read-only table of flamelet solutions written by FlameletTableBuilder, with
+ * multilinear interpolation.
+ *
+ * The table file is mapped into memory rather than read, so several processes
+ * on the same machine that open the same file share a single copy of the data
+ * through the operating system's page cache. The variables at each node of the
+ * table are stored contiguously, so that an interpolation touches one block of
+ * memory for each of the @f$ 2^N @f$ corners of the enclosing cell, and the
+ * innermost loop over the variables can be vectorized by the compiler.
+ *
+ * Interpolation does not modify the table, so one object can be used by
+ * several threads. Tables can have at most #maxAxes axes. On platforms without
+ * `mmap`, the file is read into memory instead.
+ *
+ * @ingroup onedim
+ */
+class FlameletTable
+{
+public:
+    //! Open the table stored in *filename*
+    explicit FlameletTable(const std::string& filename);
+    ~FlameletTable();
+    FlameletTable(const FlameletTable&) = delete;
+    FlameletTable& operator=(const FlameletTable&) = delete;
+
+    //! Maximum number of axes
+    static const size_t maxAxes = 6;
+
+    //! Number of axes of the table
+    size_t nAxes() const {
+        return m_nAxes;
+    }
+
+    //! Name of axis *i*
+    const std::string& axisName(size_t i) const {
+        return m_axisNames.at(i);
+    }
+
+    //! Nodes on axis *i*
+    vector_fp axis(size_t i) const;
+
+    //! Number of tabulated variables
+    size_t nVariables() const {
+        return m_nVars;
+    }
+
+    //! Name of variable *i*
+    const std::string& variableName(size_t i) const {
+        return m_varNames.at(i);
+    }
+
+    //! Index of the variable *name*, or `npos` if it is not in the table
+    size_t variableIndex(const std::string& name) const;
+
+    //! Interpolate all variables.
+    //! @param coords  Coordinates on each axis. Values outside the range of an
+    //!                axis are moved to the nearest end of that axis.
+    //! @param[out] values  Interpolated values. Length nVariables().
+    void interpolate(const double* coords, double* values) const;
+
+    //! Interpolate all variables at *n* points.
+    //! @param n       Number of points
+    //! @param coords  Coordinates of the points. The coordinates of point `i`
+    //!                start at `coords[i*nAxes()]`.
+    //! @param[out] values  Interpolated values. The values for point `i` start
+    //!                at `values[i*nVariables()]`.
+    void interpolate(size_t n, const double* coords, double* values) const;
+
+    //! Interpolate the single variable *var* at *coords*
+    double value(size_t var, const double* coords) const;
+
+protected:
+    //! Find the cell containing *x* on axis *i*, and the weight of its upper
+    //! node
+    void locate(size_t i, double x, size_t& cell, double& weight) const;
+
+    //! Compute the offsets of the corners of the cell containing *coords*,
+    //! and their weights. Returns the number of corners.
+    size_t corners(const double* coords, size_t* offsets, double* weights) const;
+
+    //! Unmap the file or free the buffer holding it
+    void close();
+
+    size_t m_nAxes;
+    size_t m_nVars;
+    std::vector<std::string> m_axisNames;
+    std::vector<std::string> m_varNames;
+
+    //! Number of nodes on each axis
+    std::vector<size_t> m_size;
+
+    //! Stride of each axis in #m_data, in units of doubles
+    std::vector<size_t> m_stride;
+
+    //! Nodes of each axis, pointing into the mapped file
+    std::vector<const double*> m_axes;
+
+    //! Whether each axis has uniformly spaced nodes
+    std::vector<bool> m_uniform;
+
+    //! Tabulated values, pointing into the mapped file
+    const double* m_data;
+
+    //! Start and length of the mapped file
+    void* m_map;
+    size_t m_mapSize;
+
+    //! Buffer holding the file, if it could not be mapped
+    std::vector<char> m_buffer;
+};
+
+}
+
+#endif
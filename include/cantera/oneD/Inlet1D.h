@@ -286,6 +286,23 @@ public:
         m_enabled = docov;
     }
 
+    //! Compute the coverages as the pseudo-steady state for the adjacent gas
+    //! state, using InterfaceKinetics::solvePseudoSteadyStateProblem, instead
+    //! of solving transient equations for them. The coverages are still part
+    //! of the solution vector, but are determined by algebraic constraints.
+    void enableQuasiSteadyCoverages(bool qss) {
+        m_quasiSteady = qss;
+    }
+
+    //! Use the analytic derivatives of the surface production rates with
+    //! respect to the coverages for the Jacobian, if the surface mechanism
+    //! supports them (see
+    //! InterfaceKinetics::getNetProductionRatesCoverageDerivatives).
+    //! Enabled by default.
+    void enableAnalyticJacobian(bool analytic) {
+        m_analyticJac = analytic;
+    }
+
     virtual std::string componentName(size_t n) const;
 
     virtual void init();
@@ -294,6 +311,8 @@ public:
     virtual void eval(size_t jg, doublereal* xg, doublereal* rg,
                       integer* diagg, doublereal rdt);
 
+    virtual bool evalJacobianColumns(size_t jg, doublereal* xg, MultiJac& jac);
+
     virtual XML_Node& save(XML_Node& o, const doublereal* const soln);
     virtual void restore(const XML_Node& dom, doublereal* soln, int loglevel);
 
@@ -308,12 +327,37 @@ public:
     virtual void showSolution(const doublereal* x);
 
 protected:
+    //! Set the state of the surface and the adjacent gas phases
+    void setState(const doublereal* xg);
+
+    //! Compute the production rates of all kinetic species into #m_work.
+    //! During Jacobian evaluations, the rates computed for the last full
+    //! residual evaluation are reused if the solution components on which
+    //! they depend have not been perturbed.
+    void updateRates(size_t jg, const doublereal* xg);
+
     InterfaceKinetics* m_kin;
     SurfPhase* m_sphase;
     size_t m_surfindex, m_nsp;
     bool m_enabled;
+    bool m_quasiSteady;
+    bool m_analyticJac;
     vector_fp m_work;
     vector_fp m_fixed_cov;
+
+    //! Pseudo-steady coverages, when using quasi-steady coverages
+    vector_fp m_qss_cov;
+
+    //! Solution components used to compute the cached rates: the coverages
+    //! and the states of the adjacent gas points
+    vector_fp m_cachedState;
+
+    //! Production rates and pseudo-steady coverages for the state in
+    //! #m_cachedState
+    vector_fp m_cachedRates, m_cachedCov;
+
+    //! Derivatives of the production rates with respect to the coverages
+    vector_fp m_dwdot;
 };
 
 /**
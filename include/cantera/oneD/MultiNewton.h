@@ -67,19 +67,49 @@ public:
         m_maxAge = maxJacAge;
     }
 
+    //! Set the damping used by dampStep(). The damping coefficient is divided
+    //! by *factor* after each rejected step, and at most *maxSteps* damping
+    //! coefficients are tried. The defaults are sqrt(2) and 7.
+    void setDampingOptions(double factor, size_t maxSteps);
+
+    //! Factor by which the damping coefficient is divided after each
+    //! rejected step
+    double dampFactor() const {
+        return m_dampFactor;
+    }
+
+    //! Maximum number of damping coefficients tried
+    size_t maxDampSteps() const {
+        return m_maxDampSteps;
+    }
+
     /// Change the problem size.
     void resize(size_t points);
 
+    //! Total number of undamped Newton steps computed by solve()
+    int nIterations() const {
+        return m_nIterations;
+    }
+
 protected:
     //! Work arrays of size #m_n used in solve().
     vector_fp m_x, m_stp, m_stp1;
 
     int m_maxAge;
 
+    //! Factor by which the damping coefficient is reduced
+    double m_dampFactor;
+
+    //! Maximum number of damping coefficients tried by dampStep()
+    size_t m_maxDampSteps;
+
     //! number of variables
     size_t m_n;
 
     doublereal m_elapsed;
+
+    //! Number of Newton iterations taken in all calls to solve()
+    int m_nIterations;
 };
 }
 
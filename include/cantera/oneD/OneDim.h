@@ -37,6 +37,13 @@ public:
     //! Return a reference to the Jacobian evaluator.
     MultiJac& jacobian();
 
+    //! Return a shared pointer to the Jacobian evaluator. The evaluator is
+    //! replaced when the problem is resized, and the pointer keeps the
+    //! previous evaluator and its last Jacobian alive.
+    std::shared_ptr<MultiJac> sharedJacobian() {
+        return m_jac;
+    }
+
     /// Return a reference to the Newton iterator.
     MultiNewton& newton();
 
@@ -242,6 +249,16 @@ public:
 
     void setJacAge(int ss_age, int ts_age=-1);
 
+    //! Maximum age of the Jacobian in steady Newton iterations
+    int steadyJacAge() const {
+        return m_ss_jac_age;
+    }
+
+    //! Maximum age of the Jacobian in transient Newton iterations
+    int transientJacAge() const {
+        return m_ts_jac_age;
+    }
+
     /**
      * Save statistics on function and Jacobian evaluation, and reset the
      * counters. Statistics are saved only if the number of Jacobian
@@ -321,7 +338,7 @@ protected:
     //! factor time step is multiplied by  if time stepping fails ( < 1 )
     doublereal m_tfactor;
 
-    std::unique_ptr<MultiJac> m_jac; //!< Jacobian evaluator
+    std::shared_ptr<MultiJac> m_jac; //!< Jacobian evaluator
     std::unique_ptr<MultiNewton> m_newt; //!< Newton iterator
     doublereal m_rdt; //!< reciprocal of time step
     bool m_jac_ok; //!< if true, Jacobian is current
@@ -335,6 +352,10 @@ protected:
     std::vector<size_t> m_nvars;
     std::vector<size_t> m_loc;
     vector_int m_mask;
+
+    //! Work array of length size(), used by timeStep()
+    vector_fp m_work;
+
     size_t m_pts;
     doublereal m_solve_time;
 
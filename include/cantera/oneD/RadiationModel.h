@@ -0,0 +1,140 @@
+//! @file RadiationModel.h Radiative heat loss models for one-dimensional flows
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_RADIATIONMODEL_H
+#define CT_RADIATIONMODEL_H
+
+#include "cantera/thermo/ThermoPhase.h"
+
+namespace Cantera
+{
+
+/**
+ * Base class for models of the volumetric radiative heat loss in a flow
+ * domain (see StFlow::setRadiationModel). The heat loss is evaluated for all
+ * grid points at once, using the temperatures and mass fractions taken
+ * directly from the solution vector of the flow domain.
+ * @ingroup onedim
+ */
+class RadiationModel
+{
+public:
+    RadiationModel() {}
+    virtual ~RadiationModel() {}
+    RadiationModel(const RadiationModel&) = delete;
+    RadiationModel& operator=(const RadiationModel&) = delete;
+
+    //! Called when the model is attached to a flow domain using the phase
+    //! *thermo*.
+    virtual void init(const ThermoPhase& thermo) {}
+
+    //! Compute the radiative heat loss [W/m^3] at each grid point.
+    /*!
+     * @param n         Number of grid points
+     * @param z         Locations of the grid points [m]
+     * @param T         Temperatures. The temperature at point `j` is `T[j*ld]`
+     * @param Y         Mass fractions. The mass fractions at point `j` start
+     *                  at `Y + j*ld`
+     * @param ld        Stride between grid points in `T` and `Y`
+     * @param wtm       Mean molecular weight at each grid point [kg/kmol]
+     * @param P         Pressure [Pa]
+     * @param epsLeft   Emissivity of the left boundary
+     * @param epsRight  Emissivity of the right boundary
+     * @param[out] qdot Radiative heat loss at each grid point. Length `n`.
+     */
+    virtual void eval(size_t n, const double* z, const double* T,
+                      const double* Y, size_t ld, const double* wtm,
+                      double P, double epsLeft, double epsRight,
+                      double* qdot) = 0;
+};
+
+/**
+ * Optically thin radiation model using the gray-gas approximation, following
+ * Y. Liu and B. Rogg [Modelling of thermally radiating diffusion flames with
+ * detailed chemistry and transport, EUROTHERM Seminars, 17:114-127, 1991].
+ *
+ * The Planck-mean absorption coefficient of the mixture is the sum of the
+ * contributions of the radiating species, each of which is interpolated from
+ * a table on a uniform temperature grid, and of soot, if a soot volume
+ * fraction profile is specified. Tables for CO2, H2O, CO and CH4 are
+ * provided by default, based on the fits to the RADCAL data [Grosshandler,
+ * W. L., RADCAL: A Narrow-Band Model for Radiation Calculations in a
+ * Combustion Environment, NIST technical note 1402, 1993] given at
+ * http://www.sandia.gov/TNF/radiation.html. Other species, such as the
+ * vapor of a liquid fuel, can be added with setAbsorptionCoeffs().
+ *
+ * The tables cover 200 K to 3500 K in steps of 10 K, and temperatures
+ * outside of this range use the value at the nearest end of the table. For
+ * H2O and CO2, the tables reproduce the fifth-order polynomials in 1000/T
+ * used by previous versions of StFlow to within 0.5% between 300 K and
+ * 2500 K. Since CO and CH4 are also radiating species by default, flames
+ * containing them lose more heat by radiation than with previous versions.
+ * Their contribution can be removed by setting their absorption
+ * coefficients to zero with setAbsorptionCoeffs().
+ * @ingroup onedim
+ */
+class PlanckMeanRadiation : public RadiationModel
+{
+public:
+    PlanckMeanRadiation();
+
+    //! Set the Planck-mean absorption coefficient of a species.
+    /*!
+     * The values are interpolated onto the internal temperature grid. Any
+     * existing table for the same species is replaced. Species which are not
+     * in the phase are ignored.
+     *
+     * @param species  Name of the species
+     * @param T        Temperatures [K], in increasing order
+     * @param kP       Absorption coefficients at each temperature [1/m/atm]
+     */
+    void setAbsorptionCoeffs(const std::string& species, const vector_fp& T,
+                             const vector_fp& kP);
+
+    //! The tabulated absorption coefficient [1/m/atm] of *species* at
+    //! temperature *T*, or 0 if no table is defined for the species.
+    double absorptionCoeff(const std::string& species, double T) const;
+
+    //! Set a soot volume fraction profile, which is linearly interpolated to
+    //! the grid points. The soot absorption coefficient is computed as
+    //! @f$ 3.72 f_v C_0 T / C_2 @f$ with @f$ C_0 = 7 @f$ and
+    //! @f$ C_2 = 1.4388 \times 10^{-2} @f$ m K.
+    void setSootVolumeFraction(const vector_fp& z, const vector_fp& fv);
+
+    virtual void init(const ThermoPhase& thermo);
+    virtual void eval(size_t n, const double* z, const double* T,
+                      const double* Y, size_t ld, const double* wtm,
+                      double P, double epsLeft, double epsRight,
+                      double* qdot);
+
+protected:
+    //! Pack the tables for the species present in the phase into #m_table
+    void updateTable();
+
+    //! Minimum temperature and spacing of the temperature grid
+    double m_Tmin, m_dT;
+
+    //! Number of points in the temperature grid
+    size_t m_nT;
+
+    //! Absorption coefficients for each species on the temperature grid
+    std::map<std::string, vector_fp> m_coeffs;
+
+    //! Indices of the radiating species in the phase
+    std::vector<size_t> m_kRadiating;
+
+    //! Absorption coefficients of the radiating species, divided by their
+    //! molecular weights. Row-major with one row per temperature.
+    vector_fp m_table;
+
+    //! Soot volume fraction profile
+    vector_fp m_zSoot, m_fvSoot;
+
+    const ThermoPhase* m_thermo;
+};
+
+}
+
+#endif
@@ -168,6 +168,30 @@ public:
     //! Initialize the solution with a previously-saved solution.
     void restore(const std::string& fname, const std::string& id, int loglevel=2);
 
+    //! Initialize the solution by mapping the solution of another Sim1D object
+    /*!
+     * The other simulation must consist of domains of the same types, but may
+     * use a different reaction mechanism and different grids. This can be
+     * used to start the solution with a detailed mechanism from a converged
+     * solution obtained with a reduced mechanism, so that the solver starts
+     * within the convergence radius of the Newton iteration.
+     *
+     * Solution components are matched by name and linearly interpolated onto
+     * the new grid, see Domain1D::mapSolution. In flow domains, species which
+     * do not exist in the other mechanism are estimated from the local
+     * equilibrium composition. Components of spray liquid domains are mapped
+     * in the same way as those of the gas phase.
+     *
+     * @param other  Simulation to map the solution from
+     * @param useOtherGrid  If true, each domain adopts the grid of the
+     *     corresponding domain of `other`. Otherwise, the solution is
+     *     interpolated onto the current grid of each domain.
+     * @param loglevel 0 to suppress all output; 1 to show warnings; 2 for
+     *     verbose output
+     */
+    void mapSolution(const Sim1D& other, bool useOtherGrid=true,
+                     int loglevel=1);
+
     //! Set the current solution vector to the last successful time-stepping
     //! solution. This can be used to examine the solver progress after a failed
     //! integration.
@@ -379,6 +403,18 @@ protected:
     //! a work array used to hold the residual or the new solution
     vector_fp m_xnew;
 
+    //! Work arrays used by refine() and refine_and_sync() to assemble the
+    //! new grid and the new solution
+    vector_fp m_znew, m_xrefined;
+
+    //! Work array used by refine_and_sync() to assemble the new solution of
+    //! the other simulation
+    vector_fp m_xrefined_other;
+
+    //! Work array holding the number of grid points of each domain after
+    //! refinement
+    std::vector<size_t> m_dsize;
+
     //! timestep
     doublereal m_tstep;
 
@@ -0,0 +1,207 @@
+//! @file SpeculativeSolver.h Concurrent solution of a Sim1D problem with
+//!     several solver strategies
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_SPECULATIVESOLVER_H
+#define CT_SPECULATIVESOLVER_H
+
+#include "cantera/base/ct_defs.h"
+#include <functional>
+
+namespace Cantera
+{
+
+class Sim1D;
+
+//! A one-dimensional problem solved by a SpeculativeSolver.
+/*!
+ * Each strategy solves its own instance of the problem, so the model owns
+ * the phases, domains and simulation it uses. The simulation returned by
+ * simulation() should be set up with its initial guess, ready for
+ * Sim1D::solve.
+ *
+ * @ingroup onedim
+ */
+class SpeculativeModel
+{
+public:
+    virtual ~SpeculativeModel() {}
+
+    //! The simulation solved by the strategy
+    virtual Sim1D& simulation() = 0;
+};
+
+//! Solver settings tried by a SpeculativeSolver.
+/*!
+ * Settings which are zero or empty keep the values set up by the model.
+ *
+ * @ingroup onedim
+ */
+struct SolveStrategy
+{
+    explicit SolveStrategy(const std::string& name_="") :
+        name(name_),
+        timeStep(0.0),
+        ssJacAge(0),
+        tsJacAge(0),
+        maxTimeStep(0.0),
+        timeStepFactor(0.0),
+        dampFactor(0.0),
+        maxDampSteps(0),
+        refine(true)
+    {
+    }
+
+    //! Name used to report the outcome of the strategy
+    std::string name;
+
+    //! Initial time step [s] used when the steady Newton iteration fails
+    double timeStep;
+
+    //! Number of time steps taken after each failed Newton iteration (see
+    //! Sim1D::setTimeStep). If only one of #timeStep and #timeSteps is set,
+    //! the other takes the default value of Sim1D.
+    vector_int timeSteps;
+
+    //! Maximum age of the Jacobian in steady and in transient Newton
+    //! iterations (see OneDim::setJacAge)
+    int ssJacAge, tsJacAge;
+
+    //! Largest time step [s]
+    double maxTimeStep;
+
+    //! Factor by which the time step is reduced after a failed step
+    double timeStepFactor;
+
+    //! Damping of the Newton steps (see MultiNewton::setDampingOptions). If
+    //! only one of these is set, the other takes its default value.
+    double dampFactor;
+    size_t maxDampSteps;
+
+    //! Whether the grid is refined
+    bool refine;
+
+    //! Name of a file and id of a solution in that file (see Sim1D::restore)
+    //! used as the initial guess instead of the one set up by the model
+    std::string restoreFile, restoreId;
+
+    //! Called from the thread calling SpeculativeSolver::solve, after the
+    //! other settings have been applied. Can be used to change the initial
+    //! guess (for example with Sim1D::mapSolution), the grid or the
+    //! artificial viscosity coefficients of a spray (see
+    //! SprayLiquid::setAVCoefficients).
+    std::function<void(Sim1D&)> setup;
+};
+
+//! Solves a hard Sim1D problem by trying several strategies at once.
+/*!
+ * When Newton iteration fails, Sim1D::solve falls back on time stepping with
+ * a single schedule, and a difficult case may need to be retried with
+ * different settings. A SpeculativeSolver solves the problem with each of its
+ * strategies concurrently, each on its own thread and with its own model.
+ * The first strategy to converge wins, and the others are cancelled through
+ * the interrupt of their simulation (see OneDim::setInterrupt), which is
+ * checked at each residual evaluation and replaces any interrupt set by the
+ * model. Strategies which fail with a CanteraError are recorded and do not
+ * stop the others.
+ *
+ * @code
+ * SpeculativeSolver solver;
+ * SolveStrategy fine("small steps");
+ * fine.timeStep = 1e-7;
+ * fine.timeSteps = {2, 5, 10};
+ * solver.addStrategy(fine);
+ * SolveStrategy damped("strong damping");
+ * damped.dampFactor = 2.0;
+ * damped.maxDampSteps = 12;
+ * solver.addStrategy(damped);
+ * solver.solve(factory);
+ * solver.getSolution(sim);
+ * @endcode
+ *
+ * Which strategy wins depends on the timing of the threads, so different runs
+ * may return different, equally converged, solutions.
+ *
+ * @ingroup onedim
+ */
+class SpeculativeSolver
+{
+public:
+    //! Outcome of a strategy
+    enum class Status {
+        NotRun, //!< The strategy was not started before another one won
+        Converged,
+        Failed,
+        Cancelled
+    };
+
+    SpeculativeSolver();
+
+    //! Add a strategy. Returns its index.
+    size_t addStrategy(const SolveStrategy& strategy);
+
+    size_t nStrategies() const {
+        return m_strategies.size();
+    }
+
+    const SolveStrategy& strategy(size_t i) const;
+
+    //! Set the number of threads used by solve(). Zero, the default, means
+    //! one thread per strategy. With fewer threads, the strategies are
+    //! started in the order they were added.
+    void setThreads(size_t n) {
+        m_nThreads = n;
+    }
+
+    //! Cancel all strategies after *seconds* of wall time. Zero, the default,
+    //! means no limit.
+    void setTimeLimit(double seconds) {
+        m_timeLimit = seconds;
+    }
+
+    //! Solve the problem with all strategies and return the index of the
+    //! first one that converged. Throws a CanteraError if none converged.
+    //! @param factory  Creates the model used by one strategy. Called from
+    //!     the calling thread, once for each strategy.
+    size_t solve(
+        const std::function<std::unique_ptr<SpeculativeModel>()>& factory);
+
+    //! Index of the winning strategy of the last call to solve(), or npos
+    size_t winner() const {
+        return m_winner;
+    }
+
+    //! Model solved by the winning strategy
+    SpeculativeModel& model();
+
+    //! Copy the grid and the solution of the winning strategy to *sim*,
+    //! which must have the same domains as the simulation of the models
+    void getSolution(Sim1D& sim);
+
+    //! Outcome of strategy *i* in the last call to solve()
+    Status status(size_t i) const;
+
+    //! Error message of strategy *i* if it failed, and an empty string
+    //! otherwise
+    const std::string& errorMessage(size_t i) const;
+
+    //! Wall time [s] spent by strategy *i*
+    double elapsedTime(size_t i) const;
+
+protected:
+    std::vector<SolveStrategy> m_strategies;
+    size_t m_nThreads;
+    double m_timeLimit;
+
+    size_t m_winner;
+    std::unique_ptr<SpeculativeModel> m_model;
+    std::vector<Status> m_status;
+    std::vector<std::string> m_errors;
+    vector_fp m_elapsed;
+};
+
+}
+
+#endif
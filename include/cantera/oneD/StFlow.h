@@ -7,9 +7,11 @@
 #define CT_STFLOW_H
 
 #include "Domain1D.h"
+#include "RadiationModel.h"
 #include "cantera/base/Array.h"
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/kinetics/Kinetics.h"
+#include "cantera/numerics/DualNumber.h"
 #include "cantera/base/ct_defs.h"
 
 namespace Cantera
@@ -80,11 +82,15 @@ public:
      */
     void setThermo(IdealGasPhase& th) {
         m_thermo = &th;
+        m_radiation->init(th);
     }
 
-    //! Set the kinetics manager. The kinetics manager must
+    //! Set the kinetics manager. The kinetics manager must use the same
+    //! phase as this domain. Quasi-steady-state species must be selected in
+    //! the kinetics manager before it is set here (see Kinetics::isQSSSpecies).
     void setKinetics(Kinetics& kin) {
         m_kin = &kin;
+        updateQSSSpecies();
     }
 
     //! set the transport manager
@@ -154,6 +160,15 @@ public:
     virtual void restore(const XML_Node& dom, doublereal* soln,
                          int loglevel);
 
+    //! Map the solution of another flow domain, which may use a different
+    //! mechanism and grid. Species are matched by name, and species which
+    //! are not present in the other domain are estimated from the local
+    //! equilibrium composition. The mapped mass fractions at each point sum
+    //! to one and have the elemental composition of the matched species.
+    //! @see Domain1D::mapSolution
+    virtual void mapSolution(const Domain1D& src, const doublereal* xsrc,
+                             doublereal* soln, int loglevel);
+
     // overloaded in subclasses
     virtual std::string flowType() {
         return "<none>";
@@ -163,15 +178,36 @@ public:
 
     //! Turn radiation on / off.
     /*!
-     *  The simple radiation model used was established by Y. Liu and B. Rogg
-     *  [Y. Liu and B. Rogg, Modelling of thermally radiating diffusion flames
-     *  with detailed chemistry and transport, EUROTHERM Seminars, 17:114-127,
-     *  1991]. This model considers the radiation of CO2 and H2O.
+     *  By default, the optically thin model of Y. Liu and B. Rogg [Y. Liu and
+     *  B. Rogg, Modelling of thermally radiating diffusion flames with
+     *  detailed chemistry and transport, EUROTHERM Seminars, 17:114-127,
+     *  1991] is used, with tabulated Planck-mean absorption coefficients for
+     *  CO2, H2O, CO and CH4. See PlanckMeanRadiation.
      */
     void enableRadiation(bool doRadiation) {
         m_do_radiation = doRadiation;
     }
 
+    //! Replace the model used to compute the radiative heat loss. The flow
+    //! domain takes ownership of *model*.
+    void setRadiationModel(RadiationModel* model);
+
+    //! The model used to compute the radiative heat loss
+    RadiationModel& radiationModel() {
+        return *m_radiation;
+    }
+
+    //! Set the Planck-mean absorption coefficient of a species, as a function
+    //! of temperature. Requires the radiation model to be a
+    //! PlanckMeanRadiation object. @see PlanckMeanRadiation::setAbsorptionCoeffs
+    void setAbsorptionCoeffs(const std::string& species, const vector_fp& T,
+                             const vector_fp& kP);
+
+    //! Set the soot volume fraction profile used in the radiation model.
+    //! Requires the radiation model to be a PlanckMeanRadiation object.
+    //! @see PlanckMeanRadiation::setSootVolumeFraction
+    void setSootVolumeFraction(const vector_fp& z, const vector_fp& fv);
+
     //! Returns `true` if the radiation term in the energy equation is enabled
     bool radiationEnabled() const {
         return m_do_radiation;
@@ -265,6 +301,10 @@ public:
 
 protected:
 
+    //! Update #m_qss and the size of #m_qssConc from the quasi-steady-state
+    //! species of the kinetics manager
+    void updateQSSSpecies();
+
     //! Write the net production rates at point `j` into array `m_wdot`
     void getWdot(doublereal* x, size_t j) {
         setGas(x,j);
@@ -464,9 +504,8 @@ protected:
     doublereal m_epsilon_left;
     doublereal m_epsilon_right;
 
-    //! Indices within the ThermoPhase of the radiating species. First index is
-    //! for CO2, second is for H2O.
-    std::vector<size_t> m_kRadiating;
+    //! Model for the radiative heat loss
+    std::unique_ptr<RadiationModel> m_radiation;
 
     // flags
     std::vector<bool> m_do_energy;
@@ -474,10 +513,20 @@ protected:
     std::vector<bool> m_do_species;
     bool m_do_multicomponent;
 
+    //! True for species which the kinetics manager treats as quasi-steady.
+    //! Their mass fractions are algebraic components, equal to the
+    //! quasi-steady-state values at each interior point. Set by
+    //! updateQSSSpecies().
+    std::vector<bool> m_qss;
+
+    //! Concentrations of the quasi-steady-state species at the current point
+    vector_fp m_qssConc;
+
     //! flag for the radiative heat loss
     bool m_do_radiation;
 
-    //! radiative heat loss vector
+    //! radiative heat loss vector. Only updated when the full residual is
+    //! evaluated, and held constant while evaluating the Jacobian.
     vector_fp m_qdotRadiation;
 
     // fixed T and Y values
@@ -545,6 +594,8 @@ public:
     }
     virtual void _finalize(const doublereal* x);
     virtual void restore(const XML_Node& dom, doublereal* soln, int loglevel);
+    virtual void mapSolution(const Domain1D& src, const doublereal* xsrc,
+                             doublereal* soln, int loglevel);
 
     virtual XML_Node& save(XML_Node& o, const doublereal* const sol);
 
@@ -584,6 +635,12 @@ public:
     }
 
 protected:
+    //! Equilibrium status of the fuel at point `j`: `true` if the gas is
+    //! super-saturated, `false` if it is sub-saturated
+    bool equilibrium_status(size_t j);
+
+    //! Equilibrium status at all points. Allocates; check_for_liquid_step()
+    //! updates #m_eq_stat in place instead.
     std::vector<bool> get_equilibrium_status();
 
     doublereal Fr(const doublereal* x, size_t j);
@@ -628,6 +685,18 @@ public:
     virtual void evalRightBoundaryLiquid(doublereal* x, doublereal* rsd,
                       integer* diag, doublereal rdt);
 
+    //! Evaluate the Jacobian columns for the solution at interior point `jg`
+    //! exactly, by evaluating the residual with dual numbers. The columns for
+    //! the two points at either end of the domain, which also enter the
+    //! residuals of the boundary domains, are computed by finite differences.
+    virtual bool evalJacobianColumns(size_t jg, doublereal* xg, MultiJac& jac);
+
+    //! Use automatic differentiation of the residual for the Jacobian instead
+    //! of finite differences. Enabled by default.
+    void enableAnalyticJacobian(bool analytic) {
+        m_analyticJac = analytic;
+    }
+
     virtual std::string componentName(size_t n) const;
 
     virtual size_t componentIndex(const std::string& name) const;
@@ -693,10 +762,12 @@ public:
         m_visc_vl = m_visc[4]; 
     }
 
-    doublereal prs(doublereal T) {
+    template <class S>
+    S prs(S T) {
       // Antoine Equation
       // (Elliott, Lira, Introductory Chemical Engineering Thermodynamics, 2012)
-      return std::pow(10.0,m_prs_A-m_prs_B/(m_prs_C+T)) * m_cvt;
+      using std::pow;
+      return pow(10.0,m_prs_A-m_prs_B/(m_prs_C+T)) * m_cvt;
     }
 
     doublereal Zl(const doublereal* x, size_t j) {
@@ -725,14 +796,35 @@ public:
       m_evap_cst = std::max(1.0,m_max - m_t/m_t_relax);
     }
 protected:
+    //! Scalar type for automatic differentiation with respect to the
+    //! components at one grid point
+    typedef Dual<c_offset_nl+1> LiquidDual;
+
+    //! Residual of the liquid phase equations at points `jmin` through
+    //! `jmax`. Templated on the scalar type, so the residual can be evaluated
+    //! with `double` or LiquidDual.
+    template <class S>
+    void evalLiquid(size_t jmin, size_t jmax, S* x, S* rsd, integer* diag,
+                    doublereal rdt);
+
+    //! Residual of the number density equation at interior point `j`
+    template <class S>
+    void numberDensityResidual(size_t j, S* x, S* rsd, integer* diag,
+                               doublereal rdt);
+
+    //! Residuals at the last point of the domain
+    template <class S>
+    void rightBoundaryResidual(S* x, S* rsd, integer* diag, doublereal rdt);
 
     //! @name Solution components
     //! @{
-    doublereal Tl(const doublereal* x, size_t j) const {
+    template <class S>
+    S Tl(const S* x, size_t j) const {
         return x[index(c_offset_Tl,j)];
     }
 
-    doublereal& Tl(doublereal* x, size_t j) const {
+    template <class S>
+    S& Tl(S* x, size_t j) const {
         return x[index(c_offset_Tl,j)];
     }
 
@@ -740,14 +832,16 @@ protected:
         return prevSoln(c_offset_Tl, j);
     }
 
-    doublereal vl(const doublereal* x, size_t j) const {
+    template <class S>
+    S vl(const S* x, size_t j) const {
         if (ml_act(x,j) > cutoff)
         return x[index(c_offset_vl,j)];
         else
         return 0.0;
     }
 
-    doublereal& vl(doublereal* x, size_t j) const {
+    template <class S>
+    S& vl(S* x, size_t j) const {
         return x[index(c_offset_vl,j)];
     }
 
@@ -755,14 +849,16 @@ protected:
         return prevSoln(c_offset_vl, j);
     }
 
-    doublereal Ul(const doublereal* x, size_t j) const {
+    template <class S>
+    S Ul(const S* x, size_t j) const {
         if (ml_act(x,j) > cutoff)
         return x[index(c_offset_Ul,j)];
         else
         return 0.0;
     }
 
-    doublereal& Ul(doublereal* x, size_t j) const {
+    template <class S>
+    S& Ul(S* x, size_t j) const {
         return x[index(c_offset_Ul,j)];
     }
 
@@ -770,14 +866,16 @@ protected:
         return prevSoln(c_offset_Ul, j);
     }
 
-    doublereal ml(const doublereal* x, size_t j) const {
+    template <class S>
+    S ml(const S* x, size_t j) const {
         if (ml_act(x,j) > cutoff)
         return x[index(c_offset_ml,j)];
         else
         return 0.0;
     }
 
-    doublereal ml_act(const doublereal* x, size_t j) const {
+    template <class S>
+    S ml_act(const S* x, size_t j) const {
         return m_ml0*x[index(c_offset_ml,j)];
     }
 
@@ -785,7 +883,8 @@ protected:
         return m_ml0*prevSoln(c_offset_ml,j);
     }
 
-    doublereal& ml(doublereal* x, size_t j) const {
+    template <class S>
+    S& ml(S* x, size_t j) const {
         return x[index(c_offset_ml,j)];
     }
 
@@ -793,14 +892,16 @@ protected:
         return prevSoln(c_offset_ml, j);
     }
 
-    doublereal nl(const doublereal* x, size_t j) const {
+    template <class S>
+    S nl(const S* x, size_t j) const {
         if (ml_act(x,j) > cutoff)
         return x[index(c_offset_nl,j)];
         else
         return 0.0;
     }
 
-    doublereal& nl(doublereal* x, size_t j) const {
+    template <class S>
+    S& nl(S* x, size_t j) const {
         return x[index(c_offset_nl,j)];
         // return 0.0;
     }
@@ -809,38 +910,46 @@ protected:
         return prevSoln(c_offset_nl, j);
     }
 
-    doublereal rhol(const doublereal* x, size_t j) const {
+    template <class S>
+    S rhol(const S* x, size_t j) const {
         // DIPPR 105
         if (std::abs(m_rhol_B-0.0)<std::sqrt(std::numeric_limits<double>::min()) && 
             std::abs(m_rhol_C-0.0)<std::sqrt(std::numeric_limits<double>::min()) &&
             std::abs(m_rhol_D-0.0)<std::sqrt(std::numeric_limits<double>::min()) ) {
             return m_rhol_A;
         } else {
-            return m_rhol_A/(std::pow(m_rhol_B,1.0+std::pow(1.0-Tl(x,j)/m_rhol_C,m_rhol_D)));
+            using std::pow;
+            return m_rhol_A/(pow(m_rhol_B,1.0+pow(1.0-Tl(x,j)/m_rhol_C,m_rhol_D)));
         }
     }
 
-    doublereal ml_vl(const doublereal* x, size_t j) const {
+    template <class S>
+    S ml_vl(const S* x, size_t j) const {
         return ml(x,j)*vl(x,j);
     }
 
-    doublereal ml_Ul(const doublereal* x, size_t j) const {
+    template <class S>
+    S ml_Ul(const S* x, size_t j) const {
         return ml(x,j)*Ul(x,j);
     }
 
-    doublereal nl_Ul(const doublereal* x, size_t j) const {
+    template <class S>
+    S nl_Ul(const S* x, size_t j) const {
         return nl(x,j)*Ul(x,j);
     }
 
-    doublereal nl_vl(const doublereal* x, size_t j) const {
+    template <class S>
+    S nl_vl(const S* x, size_t j) const {
         return nl(x,j)*vl(x,j);
     }
 
-    doublereal dl(const doublereal* x, size_t j) const {
+    template <class S>
+    S dl(const S* x, size_t j) const {
         if (ml_act(x,j)< cutoff) {
             return 0.0;
         }
-        return std::pow(6.0*ml_act(x,j)/Pi/rhol(x,j),1.0/3.0);
+        using std::pow;
+        return pow(6.0*ml_act(x,j)/Pi/rhol(x,j),1.0/3.0);
     }
 
     doublereal dl_prev(size_t j) const {
@@ -848,7 +957,8 @@ protected:
     }
 
 
-    doublereal prs(const doublereal* x, size_t j) {
+    template <class S>
+    S prs(const S* x, size_t j) {
       return prs(Tl(x,j));
     }
 
@@ -858,7 +968,8 @@ protected:
         return m_Lv;
     }
 
-    doublereal cpl(const doublereal* x, size_t j) {
+    template <class S>
+    S cpl(const S* x, size_t j) {
         // assume constant for now
         return m_cpl;
     }
@@ -871,27 +982,32 @@ protected:
       //  return m_gas->m_cp[j];
     //}
 
-    doublereal Yrs(const doublereal* x, size_t j) {
-        doublereal Xrs = std::min(prs(x,j)/m_gas->m_press,1.0);
-        doublereal Yrs = m_gas->m_wt[m_gas->c_offset_fuel]*Xrs / 
+    template <class S>
+    S Yrs(const S* x, size_t j) {
+        using std::min;
+        S Xrs = min(prs(x,j)/m_gas->m_press,1.0);
+        S Yrs = m_gas->m_wt[m_gas->c_offset_fuel]*Xrs / 
                         (m_gas->m_wt[m_gas->c_offset_fuel]*Xrs + 
                          (1.0 - Xrs)*m_gas->m_wtm[j]);
         return Yrs;
     }
 
-    doublereal mdot(const doublereal* x, size_t j) {
-        doublereal Yrs_ = Yrs(x,j);
+    template <class S>
+    S mdot(const S* x, size_t j) {
+        using std::max;
+        using std::log;
+        S Yrs_ = Yrs(x,j);
         
-        doublereal Bm;
+        S Bm;
         // Boiling switch
         if (Yrs_ == 1.0)
             Bm = m_gas->cpgf(j)*(m_gas->T_prev(j)-Tl(x,j))/Lv();
         else {
             Bm = (Yrs_- m_gas->Y_prev(m_gas->c_offset_fuel,j)) / 
-            std::max(1.0-Yrs_,std::sqrt(std::numeric_limits<double>::min()));
-            Bm = std::max(0.0,Bm);
+            max(1.0-Yrs_,std::sqrt(std::numeric_limits<double>::min()));
+            Bm = max(0.0,Bm);
         }
-        doublereal mdot_ = 2.0*Pi*dl(x,j)*m_gas->m_rho[j]*m_gas->Dgf(j)*std::log(1.0+Bm);
+        S mdot_ = 2.0*Pi*dl(x,j)*m_gas->m_rho[j]*m_gas->Dgf(j)*log(1.0+Bm);
         // Set ramping based on current time
         if (m_accel_evap) {
           updateEvapConstant();
@@ -904,11 +1020,13 @@ protected:
        return mdot(prevSolnPtr(), j);
     }
 
-    doublereal q(const doublereal* x,size_t j) {
+    template <class S>
+    S q(const S* x, size_t j) {
         if (mdot(x,j)<= cutoff) {
             return 0.0;
         } else {
-            doublereal BT = std::exp((mdot(x,j)/m_evap_cst)/(2.0*Pi*m_gas->m_rho[j]*m_gas->Dgf(j)*dl(x,j)))-1.0;
+            using std::exp;
+            S BT = exp((mdot(x,j)/m_evap_cst)/(2.0*Pi*m_gas->m_rho[j]*m_gas->Dgf(j)*dl(x,j)))-1.0;
             return m_gas->cpgf(j)*(m_gas->T_prev(j)-Tl(x,j))/BT;
         }
     }
@@ -917,11 +1035,13 @@ protected:
         return q(prevSolnPtr(),j);
     }
 
-    doublereal Fr(const doublereal* x, size_t j) {
+    template <class S>
+    S Fr(const S* x, size_t j) {
         return 3.0*Pi*dl(x,j)*m_gas->m_visc[j]*(m_gas->V_prev(j)-Ul(x,j));
     }
 
-    doublereal fz(const doublereal* x, size_t j) {
+    template <class S>
+    S fz(const S* x, size_t j) {
         return 3.0*Pi*dl(x,j)*m_gas->m_visc[j]*(m_gas->u_prev(j)-vl(x,j));
     }
 
@@ -935,27 +1055,32 @@ protected:
     //! @name convective spatial derivatives.
     //! These use upwind differencing, assuming vl(z) is negative
     //! @{
-    doublereal dUldz(const doublereal* x, size_t j) const {
+    template <class S>
+    S dUldz(const S* x, size_t j) const {
         size_t jloc = (vl(x,j) > 0.0 ? j : j + 1);
         return (Ul(x,jloc) - Ul(x,jloc-1))/m_dz[jloc-1];
     }
 
-    doublereal dvldz(const doublereal* x, size_t j) const {
+    template <class S>
+    S dvldz(const S* x, size_t j) const {
         size_t jloc = (vl(x,j) > 0.0 ? j : j + 1);
         return (vl(x,jloc) - vl(x,jloc-1))/m_dz[jloc-1];
     }
 
-    doublereal dmldz(const doublereal* x, size_t j) const {
+    template <class S>
+    S dmldz(const S* x, size_t j) const {
         size_t jloc = (vl(x,j) > 0.0 ? j : j + 1);
         return (ml(x,jloc) - ml(x,jloc-1))/m_dz[jloc-1];
     }
 
-    doublereal dnldz(const doublereal* x, size_t j) const {
+    template <class S>
+    S dnldz(const S* x, size_t j) const {
         size_t jloc = (vl(x,j) > 0.0 ? j : j + 1);
         return (nl(x,jloc) - nl(x,jloc-1))/m_dz[jloc-1];
     }
 
-    doublereal dTldz(const doublereal* x, size_t j) const {
+    template <class S>
+    S dTldz(const S* x, size_t j) const {
         size_t jloc = (vl(x,j) > 0.0 ? j : j + 1);
         return (Tl(x,jloc) - Tl(x,jloc-1))/m_dz[jloc-1];
     }
@@ -963,33 +1088,38 @@ protected:
 
     //! @name artifitial viscosities
     //! @{
-    doublereal av_ml(const doublereal* x, size_t j) const {
-        doublereal c1 = m_visc_ml*(ml(x,j) - ml(x,j-1));
-        doublereal c2 = m_visc_ml*(ml(x,j+1) - ml(x,j));
+    template <class S>
+    S av_ml(const S* x, size_t j) const {
+        S c1 = m_visc_ml*(ml(x,j) - ml(x,j-1));
+        S c2 = m_visc_ml*(ml(x,j+1) - ml(x,j));
         return 2.0*(c2/(z(j+1) - z(j)) - c1/(z(j) - z(j-1)))/(z(j+1) - z(j-1));
     }
 
-    doublereal av_nl(const doublereal* x, size_t j) const {
-        doublereal c1 = m_visc_nl*(nl(x,j) - nl(x,j-1));
-        doublereal c2 = m_visc_nl*(nl(x,j+1) - nl(x,j));
+    template <class S>
+    S av_nl(const S* x, size_t j) const {
+        S c1 = m_visc_nl*(nl(x,j) - nl(x,j-1));
+        S c2 = m_visc_nl*(nl(x,j+1) - nl(x,j));
         return 2.0*(c2/(z(j+1) - z(j)) - c1/(z(j) - z(j-1)))/(z(j+1) - z(j-1));
     }
 
-    doublereal av_Tl(const doublereal* x, size_t j) const {
-        doublereal c1 = m_visc_Tl*(Tl(x,j) - Tl(x,j-1));
-        doublereal c2 = m_visc_Tl*(Tl(x,j+1) - Tl(x,j));
+    template <class S>
+    S av_Tl(const S* x, size_t j) const {
+        S c1 = m_visc_Tl*(Tl(x,j) - Tl(x,j-1));
+        S c2 = m_visc_Tl*(Tl(x,j+1) - Tl(x,j));
         return 2.0*(c2/(z(j+1) - z(j)) - c1/(z(j) - z(j-1)))/(z(j+1) - z(j-1));
     }
 
-    doublereal av_Ul(const doublereal* x, size_t j) const {
-        doublereal c1 = m_visc_Ul*(Ul(x,j) - Ul(x,j-1));
-        doublereal c2 = m_visc_Ul*(Ul(x,j+1) - Ul(x,j));
+    template <class S>
+    S av_Ul(const S* x, size_t j) const {
+        S c1 = m_visc_Ul*(Ul(x,j) - Ul(x,j-1));
+        S c2 = m_visc_Ul*(Ul(x,j+1) - Ul(x,j));
         return 2.0*(c2/(z(j+1) - z(j)) - c1/(z(j) - z(j-1)))/(z(j+1) - z(j-1));
     }
 
-    doublereal av_vl(const doublereal* x, size_t j) const {
-        doublereal c1 = m_visc_vl*(vl(x,j) - vl(x,j-1));
-        doublereal c2 = m_visc_vl*(vl(x,j+1) - vl(x,j));
+    template <class S>
+    S av_vl(const S* x, size_t j) const {
+        S c1 = m_visc_vl*(vl(x,j) - vl(x,j-1));
+        S c2 = m_visc_vl*(vl(x,j+1) - vl(x,j));
         return 2.0*(c2/(z(j+1) - z(j)) - c1/(z(j) - z(j-1)))/(z(j+1) - z(j-1));
     }
     //! @}
@@ -1026,6 +1156,15 @@ protected:
     doublereal m_t_relax = 0.1;
     // Evaporation constat
     doublereal m_evap_cst;
+
+    //! True if the Jacobian is computed by automatic differentiation
+    bool m_analyticJac;
+
+    //! Workspaces for the solution and residual used by evalJacobianColumns()
+    std::vector<LiquidDual> m_xdual, m_rdual;
+
+    //! Unused mask values set while evaluating the Jacobian
+    vector_int m_diag_work;
 };
 
 }
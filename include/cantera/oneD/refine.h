@@ -99,6 +99,10 @@ protected:
     size_t m_nv, m_npmax;
     doublereal m_thresh;
     doublereal m_gridmin; //!< minimum grid spacing [m]
+
+    //! Work arrays used by analyze() for the values and slopes of one
+    //! component, and the grid spacing
+    vector_fp m_v, m_s, m_dz;
 };
 
 }
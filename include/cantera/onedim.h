@@ -15,5 +15,6 @@
 #include "oneD/Domain1D.h"
 #include "oneD/Inlet1D.h"
 #include "oneD/StFlow.h"
+#include "oneD/FlameletTable.h"
 
 #endif
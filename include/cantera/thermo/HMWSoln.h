@@ -2569,7 +2569,8 @@ private:
     /*!
      * It will also calculate the temperature derivatives of the coefficients,
      * as they are important in the calculation of the latent heats and the heat
-     * capacities of the mixtures.
+     * capacities of the mixtures. The results are cached, and are only
+     * recalculated when the temperature changes.
      *
      * @param doDerivs If >= 1, then the routine will calculate the first
      *                 derivative. If >= 2, the routine will calculate the first
@@ -2588,6 +2589,21 @@ private:
     void calc_lambdas(double is) const;
     mutable doublereal m_last_is;
 
+    //! Calculate the functions g(x) and hfunc(x) for each cation-anion pair.
+    /*!
+     * These are functions of the reduced variables x = alpha * sqrt(Is) only,
+     * so they are evaluated once for each value of the ionic strength and
+     * shared by the routines for the activity coefficients and their
+     * temperature and pressure derivatives. Results are stored in
+     * #m_gfunc_IJ, #m_hfunc_IJ, #m_g2func_IJ and #m_h2func_IJ.
+     *
+     * @param is Ionic strength
+     */
+    void calc_gfuncs(double is) const;
+
+    //! Ionic strength used in the last call to calc_gfuncs()
+    mutable double m_last_is_gfunc;
+
     /**
      * Calculate etheta and etheta_prime
      *
@@ -437,6 +437,29 @@ public:
         return false;
     }
 
+    //! Get the molar volume and its temperature derivatives, for standard
+    //! states which are determined by the reference state thermo of the
+    //! species and a molar volume which depends only on temperature.
+    /*!
+     * VPStandardStateTP evaluates the reference state of all species with
+     * such standard states together and applies the pressure correction
+     * directly, without calling the PDSS object for each species. The state
+     * of the PDSS object itself is not updated in this case.
+     *
+     * @param temp        Temperature [K]
+     * @param[out] V      Molar volume [m^3/kmol]
+     * @param[out] dVdT   Derivative of the molar volume with respect to
+     *                    temperature [m^3/kmol/K]
+     * @param[out] d2VdT2 Second derivative of the molar volume with respect
+     *                    to temperature [m^3/kmol/K^2]
+     * @returns 'false' if the standard state does not have this form, in
+     *     which case the outputs are not set.
+     */
+    virtual bool getMolarVolumeDerivs(double temp, double& V, double& dVdT,
+                                      double& d2VdT2) const {
+        return false;
+    }
+
     //! Set the parent VPStandardStateTP object of this PDSS object
     /*!
      * This information is only used by certain PDSS subclasses
@@ -47,6 +47,8 @@ public:
     //! @{
 
     virtual doublereal satPressure(doublereal t);
+    virtual bool getMolarVolumeDerivs(double temp, double& V, double& dVdT,
+                                      double& d2VdT2) const;
 
     //! @}
     //! @name Initialization of the Object
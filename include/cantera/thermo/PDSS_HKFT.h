@@ -19,6 +19,79 @@ namespace Cantera
 class PDSS_Water;
 class WaterProps;
 
+//! Properties of the water solvent which appear in the HKFT standard state
+/*!
+ * These properties depend only on temperature and pressure, so a single
+ * instance is shared by all of the PDSS_HKFT species in a phase. The values
+ * for the two most recently used (T, P) states are kept, which covers the
+ * standard state and the reference state (at PDSS_Water::pref_safe()) that are
+ * evaluated in each update of the parent VPStandardStateTP object. This way,
+ * the density of water and its derivatives are computed once per state for
+ * all solute species, rather than several times for each of them.
+ *
+ * For all methods, `ifunc` selects the desired information:
+ *   - 0 function value
+ *   - 1 derivative wrt temperature
+ *   - 2 2nd derivative wrt temperature
+ *   - 3 derivative wrt pressure
+ *
+ * @ingroup pdssthermo
+ */
+class HKFT_SolventProps
+{
+public:
+    //! Constructor
+    //! @param water  Standard state of the solvent. Not owned by this object.
+    explicit HKFT_SolventProps(PDSS_Water* water);
+    ~HKFT_SolventProps();
+
+    //! Relative permittivity of water (see WaterProps::relEpsilon)
+    double relEpsilon(double temp, double pres, int ifunc);
+
+    //! The Gstar value appearing in the HKFT formulation
+    double gstar(double temp, double pres, int ifunc);
+
+    //! Value of PDSS_Water::pref_safe() at the temperature *temp*
+    double pref_safe(double temp);
+
+private:
+    //! Cached properties at one (T, P) state
+    struct State {
+        double temp;
+        double pres;
+        double relEps[4];
+        double gstar[4];
+        bool gstarValid;
+    };
+
+    //! Return the cached properties at (*temp*, *pres*), computing the
+    //! dielectric constant if this state is not one of the two cached ones.
+    State& state(double temp, double pres);
+
+    //! Compute the Gstar values for *s*. This requires the density of water.
+    void calcGstar(State& s);
+
+    //! Internal formula for the calculation of a_g(). Units of Angstroms.
+    static double ag(double temp, int ifunc);
+
+    //! Internal formula for the calculation of b_g(). Unitless.
+    static double bg(double temp, int ifunc);
+
+    //! Difference function f appearing in the Johnson et al. formulation of
+    //! omega_j (Eqn. 33)
+    static double f(double temp, double pres, int ifunc);
+
+    PDSS_Water* m_water;
+    std::unique_ptr<WaterProps> m_waterProps;
+
+    //! Cached states and the index of the most recently used one
+    State m_states[2];
+    size_t m_last;
+
+    //! Temperature and result of the last call to pref_safe()
+    double m_Tpref, m_pref;
+};
+
 //! Class for pressure dependent standard states corresponding to
 //!  ionic solutes in electrolyte water.
 /*!
@@ -146,61 +219,6 @@ private:
      */
     doublereal deltaH() const;
 
-    //! Internal formula for the calculation of a_g()
-    /*!
-     * The output of this is in units of Angstroms
-     *
-     * @param temp Temperature (K)
-     * @param ifunc     parameters specifying the desired information
-     *                 - 0 function value
-     *                 - 1 derivative wrt temperature
-     *                 - 2 2nd derivative wrt temperature
-     *                 - 3 derivative wrt pressure
-     */
-    doublereal ag(const doublereal temp, const int ifunc = 0) const;
-
-    //! Internal formula for the calculation of b_g()
-    /*!
-     * the output of this is unitless
-     *
-     * @param temp Temperature (K)
-     * @param ifunc     parameters specifying the desired information
-     *                 - 0 function value
-     *                 - 1 derivative wrt temperature
-     *                 - 2 2nd derivative wrt temperature
-     *                 - 3 derivative wrt pressure
-     */
-    doublereal bg(const doublereal temp, const int ifunc = 0) const;
-
-    //! function g appearing in the formulation
-    /*!
-     * Function g appearing in the Johnson et al formulation
-     *
-     * @param temp      Temperature kelvin
-     * @param pres      Pressure (pascal)
-     * @param ifunc     parameters specifying the desired information
-     *                 - 0 function value
-     *                 - 1 derivative wrt temperature
-     *                 - 2 2nd derivative wrt temperature
-     *                 - 3 derivative wrt pressure
-     */
-    doublereal g(const doublereal temp, const doublereal pres, const int ifunc = 0) const;
-
-    //! Difference function f appearing in the formulation
-    /*!
-     * Function f appearing in the Johnson et al formulation of omega_j
-     *   Eqn. 33 ref
-     *
-     * @param temp      Temperature kelvin
-     * @param pres      Pressure (pascal)
-     * @param ifunc     parameters specifying the desired information
-     *                 - 0 function value
-     *                 - 1 derivative wrt temperature
-     *                 - 2 2nd derivative wrt temperature
-     *                 - 3 derivative wrt pressure
-     */
-    doublereal f(const doublereal temp, const doublereal pres, const int ifunc = 0) const;
-
     //! Evaluate the Gstar value appearing in the HKFT formulation
     /*!
      * @param temp      Temperature kelvin
@@ -243,11 +261,9 @@ private:
      */
     PDSS_Water* m_waterSS;
 
-    //! density of standard-state water. internal temporary variable
-    mutable doublereal m_densWaterSS;
-
-    //!  Pointer to the water property calculator
-    std::unique_ptr<WaterProps> m_waterProps;
+    //! Properties of the solvent, shared with the other HKFT species of the
+    //! parent phase
+    shared_ptr<HKFT_SolventProps> m_solvent;
 
     //! Born coefficient for the current ion or species
     doublereal m_born_coeff_j;
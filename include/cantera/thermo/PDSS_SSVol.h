@@ -193,6 +193,8 @@ private:
     //! @{
 
     virtual doublereal satPressure(doublereal t);
+    virtual bool getMolarVolumeDerivs(double temp, double& V, double& dVdT,
+                                      double& d2VdT2) const;
 
     //! @}
     //! @name Initialization of the Object
@@ -14,6 +14,7 @@
 #include "PDSS.h"
 #include "WaterPropsIAPWS.h"
 #include "WaterProps.h"
+#include "WaterPropsTable.h"
 
 namespace Cantera
 {
@@ -148,11 +149,41 @@ public:
         return &m_waterProps;
     }
 
+    //! @}
+    //! @name Tabulated Properties
+    /*!
+     * As for WaterSSTP, a WaterPropsTable may be used to seed the density
+     * iteration in setPressure(), which is then refined on the equation of
+     * state, and to evaluate the reference state properties by
+     * interpolation. Properties of the current state are always evaluated
+     * from the equation of state. States outside the table use the full
+     * equation of state.
+     */
+    //! @{
+
+    //! Use the table `table` to evaluate properties. The same table may be
+    //! shared with other objects. Passing an empty pointer disables
+    //! tabulation.
+    void setTabulation(shared_ptr<WaterPropsTable> table) {
+        m_table = table;
+    }
+
+    //! The table used to evaluate properties, if any
+    shared_ptr<WaterPropsTable> tabulation() const {
+        return m_table;
+    }
     //! @}
 
     virtual bool useSTITbyPDSS() const { return true; }
 
 private:
+    //! Evaluate the properties at temperature `T` and pressure `P` from the
+    //! table, on the liquid side of the saturation curve. Returns false if
+    //! tabulation is not enabled or the state is not covered by the table.
+    bool lookup(double T, double P, WaterPropsTable::State& state) const {
+        return m_table && m_table->lookup(T, P, WATER_LIQUID, state);
+    }
+
     //! Pointer to the WaterPropsIAPWS object, which does the actual calculations
     //! for the real equation of state
     /*!
@@ -170,6 +201,9 @@ private:
      */
     WaterProps m_waterProps;
 
+    //! Table used to evaluate properties, if any
+    shared_ptr<WaterPropsTable> m_table;
+
     //! State of the system - density
     /*!
      * Density is the independent variable here, but it's hidden behind the
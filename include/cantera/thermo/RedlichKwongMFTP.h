@@ -261,10 +261,21 @@ public:
     /*!
      *  The a and the b parameters depend on the mole fraction and the
      *  temperature. This function updates the internal numbers based on the
-     *  state of the object.
+     *  state of the object, using the mixing sums computed by
+     *  updateMixingSums(), so its cost is linear in the number of species.
      */
     void updateAB();
 
+    //! Update the sums over the species that depend only on the composition
+    /*!
+     *  Computes the products of the matrices of the constant and
+     *  temperature-proportional parts of the "a" coefficients with the mole
+     *  fraction vector in a single pass over their upper triangles. These
+     *  products are reused by updateAB() when only the temperature changes,
+     *  and by the partial molar properties and activity coefficients.
+     */
+    void updateMixingSums();
+
     //! Calculate the a and the b parameters given the temperature
     /*!
      * This function doesn't change the internal state of the object, so it is a
@@ -289,13 +300,92 @@ public:
      *
      *     V**3 - V**2(RT/P)  - V(RTb/P - a/(P T**.5) + b*b) - (a b / (P T**.5)) = 0
      *
-     * Returns the number of solutions found. If it only finds the liquid
-     * branch solution, it will return a -1 or a -2 instead of 1 or 2.  If it
-     * returns 0, then there is an error.
+     * Returns 3 if there are three physical roots, which are the liquid,
+     * unstable and gas volumes in increasing order. Otherwise, there is a
+     * single stable root in `Vroot[0]`, and the return value is 1 if it is on
+     * the gas branch and -1 if it is on the liquid branch. See
+     * classifyRoots().
      */
     int NicholsSolve(double TKelvin, double pres, doublereal a, doublereal b,
                      doublereal Vroot[3]) const;
 
+    //! Classify the physical roots found by solveCubic() at one state
+    /*!
+     * If only two roots are physical, the smaller one is on the mechanically
+     * unstable branch and is discarded. A single remaining root is moved to
+     * `Vroot[0]`.
+     *
+     * @param T       Temperature [K]
+     * @param P       Pressure [Pa]
+     * @param a       "a" parameter of the mixture
+     * @param b       "b" parameter of the mixture
+     * @param Vroot   Roots found by solveCubic(), in increasing order
+     * @param nRoots  Number of roots found by solveCubic(). Must be positive.
+     * @returns the number of roots, as returned by NicholsSolve()
+     */
+    static int classifyRoots(double T, double P, double a, double b,
+                             double* Vroot, int nRoots);
+
+    //! Select the molar volume of the requested phase among the roots
+    //! classified by classifyRoots(). Used by densityCalc() and
+    //! getDensities().
+    /*!
+     * @param nSolns  Value returned by classifyRoots()
+     * @param Vroot   Roots of the equation of state
+     * @param phase   Requested phase, for example FLUID_GAS or FLUID_LIQUID_0
+     * @param supercritical  True if the temperature is above the critical
+     *                temperature of the mixture
+     * @param volguess  Estimate of the molar volume, used to choose between
+     *                the liquid and gas roots if the phase is not specified
+     * @returns the molar volume, or -2 if there is no root for the requested
+     *     phase, or -1 if there is no root at all.
+     */
+    static double selectMolarVolume(int nSolns, const double* Vroot,
+                                    int phase, bool supercritical,
+                                    double volguess);
+
+    //! Solve the cubic equation of state at *n* states
+    /*!
+     * The cubic is solved in terms of the compressibility factor, using the
+     * trigonometric form if it has three real roots and Cardano's formula
+     * otherwise, followed by a fixed number of Newton iterations. Both forms
+     * are evaluated for every state so that the loop over the states can be
+     * vectorized. Roots with @f$ V \le b @f$ are not physical and are
+     * discarded.
+     *
+     * @param n       Number of states
+     * @param T       Temperatures [K]
+     * @param P       Pressures [Pa]
+     * @param a       "a" parameters of the mixture at each state
+     * @param b       "b" parameters of the mixture at each state
+     * @param[out] Vroot  Physical molar volumes at each state, in increasing
+     *                    order, starting at `Vroot[3*i]`. Unused entries are
+     *                    set to zero.
+     * @param[out] nRoots  Number of physical roots at each state
+     */
+    static void solveCubic(size_t n, const double* T, const double* P,
+                           const double* a, const double* b, double* Vroot,
+                           int* nRoots);
+
+    //! Densities of the current mixture at *n* temperatures and pressures.
+    /*!
+     *  The roots of the equation of state are selected as in densityCalc()
+     *  with the ideal gas density as the initial guess (see
+     *  selectMolarVolume()), using the "a" and "b" parameters of the current
+     *  composition at each temperature. In particular, if the phase is
+     *  FLUID_UNDEFINED and there are both liquid and gas roots, the gas root
+     *  is returned.
+     *
+     *  @param n       Number of states
+     *  @param T       Temperatures [K]
+     *  @param P       Pressures [Pa]
+     *  @param phase   Requested phase, for example FLUID_GAS or FLUID_LIQUID_0
+     *  @param[out] rho  Densities [kg/m^3], or a negative value if there is
+     *                   no root for the requested phase
+     */
+    void getDensities(size_t n, const double* T, const double* P, int phase,
+                      double* rho) const;
+
 protected:
     //! Form of the temperature parameterization
     /*!
@@ -316,7 +406,18 @@ protected:
      */
     doublereal m_a_current;
 
-    vector_fp a_vec_Curr_;
+    //! Constant and temperature-proportional parts of #m_a_current, which
+    //! depend only on the mole fractions
+    double m_a0_mix, m_a1_mix;
+
+    //! Sums @f$ \sum_j a_{0,kj} X_j @f$ and @f$ \sum_j a_{1,kj} X_j @f$ for
+    //! each species *k*, computed by updateMixingSums()
+    vector_fp m_a0Sum, m_a1Sum;
+
+    //! Sum @f$ \sum_j a_{kj}(T) X_j @f$ for each species *k* at the current
+    //! temperature
+    vector_fp m_aSum;
+
     vector_fp b_vec_Curr_;
 
     Array2D a_coeff_vec;
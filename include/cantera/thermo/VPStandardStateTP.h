@@ -280,6 +280,20 @@ protected:
      */
     std::vector<std::unique_ptr<PDSS>> m_PDSS_storage;
 
+    //! Reference state parameterizations of the species whose standard states
+    //! are determined by the reference state and a molar volume which depends
+    //! only on temperature (see PDSS::getMolarVolumeDerivs). The properties
+    //! of these species are evaluated together, with the species grouped by
+    //! parameterization type.
+    std::unique_ptr<MultiSpeciesThermo> m_volOnlyThermo;
+
+    //! Indices of the species evaluated using #m_volOnlyThermo
+    std::vector<size_t> m_kVolOnly;
+
+    //! Indices of the species whose standard state properties are computed by
+    //! their PDSS objects
+    std::vector<size_t> m_kGeneric;
+
     //! Vector containing the species reference enthalpies at T = m_tlast
     //! and P = p_ref.
     mutable vector_fp m_h0_RT;
@@ -0,0 +1,200 @@
+/**
+ * @file WaterPropsTable.h
+ * Headers for a class providing tabulated approximations to the IAPWS 1995
+ * equation of state for water (see class
+ * \link Cantera::WaterPropsTable WaterPropsTable\endlink).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_WATERPROPSTABLE_H
+#define CT_WATERPROPSTABLE_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class WaterPropsIAPWS;
+
+//! Tabulated approximation to the IAPWS 1995 equation of state for water, as
+//! a function of temperature and pressure.
+/*!
+ * Evaluating properties for a given temperature and pressure with
+ * WaterPropsIAPWS requires an iterative solution for the density, with each
+ * iteration evaluating the full Helmholtz free energy formulation. This class
+ * precomputes the density and the thermodynamic properties on a grid, so that
+ * they can be evaluated at the cost of a bicubic interpolation.
+ *
+ * The following are tabulated:
+ *
+ *   - The saturation pressure, for temperatures between `Tmin` and `Tsat`.
+ *   - The liquid, for temperatures between `Tmin` and `Tsat` and pressures
+ *     between the saturation pressure and `Pmax`.
+ *   - The vapor, for temperatures between `Tmin` and `Tsat` and pressures
+ *     between `Pmin` and the saturation pressure.
+ *   - The superheated vapor, for temperatures between `Tsat` and `Tmax` and
+ *     pressures between `Pmin` and the saturation pressure at `Tsat`.
+ *
+ * Within each region, the grid is uniform in temperature and in a scaled
+ * pressure which is 0 and 1 at the lower and upper pressure limits at each
+ * temperature, so that the saturation curve always falls on the edge of the
+ * grid. The pressure nodes are clustered quadratically toward the saturation
+ * curve. Values are interpolated using cubic convolution
+ * (Catmull-Rom splines), which is continuous in the values and first
+ * derivatives.
+ *
+ * The region near the critical point, where the properties vary too rapidly
+ * to be tabulated, is excluded by choosing `Tsat` below the critical
+ * temperature. States which are not covered by the table are not evaluated by
+ * lookup(), so that the caller can fall back to the full equation of state.
+ *
+ * The table uses the units and the thermodynamic basis of WaterPropsIAPWS,
+ * i.e. molar quantities, with u = s = 0 for the liquid at the triple point.
+ *
+ * WaterSSTP and PDSS_Water (see WaterSSTP::setTabulation and
+ * PDSS_Water::setTabulation) use the table in two ways. The tabulated density
+ * seeds a short Newton iteration on the equation of state when the state is
+ * set from the temperature and pressure, so the properties of the current
+ * state are still those of the equation of state. The reference state
+ * properties at one atmosphere are returned directly from the table, to
+ * within the tolerance of the table. Other models can call lookup() to use
+ * the interpolated properties directly.
+ *
+ * @ingroup thermoprops
+ */
+class WaterPropsTable
+{
+public:
+    //! Properties of water at a single state
+    struct State {
+        double density; //!< density [kg/m^3]
+        double enthalpy; //!< molar enthalpy [J/kmol]
+        double entropy; //!< molar entropy [J/kmol/K]
+        double cp; //!< molar heat capacity at constant pressure [J/kmol/K]
+        double cv; //!< molar heat capacity at constant volume [J/kmol/K]
+        double compressibility; //!< isothermal compressibility [1/Pa]
+        double expansion; //!< thermal expansion coefficient [1/K]
+    };
+
+    //! Construct and fill the table.
+    /*!
+     * @param nT    Number of temperature intervals in the liquid region. The
+     *              other regions use the same temperature spacing.
+     * @param nP    Number of pressure intervals in each region
+     * @param Tmin  Minimum temperature [K]. May not be below the triple point.
+     * @param Tsat  Maximum temperature [K] of the liquid region and of the
+     *              saturation curve. Must be below the critical temperature.
+     * @param Tmax  Maximum temperature [K] of the superheated vapor region
+     * @param Pmin  Minimum pressure [Pa] of the vapor region
+     * @param Pmax  Maximum pressure [Pa] of the liquid region
+     */
+    WaterPropsTable(size_t nT = 60, size_t nP = 20, double Tmin = 273.16,
+                    double Tsat = 600.0, double Tmax = 1500.0,
+                    double Pmin = 1.0, double Pmax = 1.0e8);
+
+    //! Create a table which reproduces the equation of state to within the
+    //! tolerance `tol`, as measured by maxError(). The grid resolution is
+    //! doubled, starting from the default, until the tolerance is met.
+    static shared_ptr<WaterPropsTable> build(double tol);
+
+    //! Evaluate the properties at temperature `T` [K] and pressure `P` [Pa]
+    /*!
+     * @param T      temperature [K]
+     * @param P      pressure [Pa]
+     * @param phase  WATER_LIQUID or WATER_GAS. Determines the region of the
+     *     table which is used.
+     * @param[out] state  Properties at the specified state
+     * @returns true if the state is covered by the table, and false
+     *     otherwise, in which case `state` is not modified.
+     */
+    bool lookup(double T, double P, int phase, State& state) const;
+
+    //! Saturation pressure [Pa] at temperature `T` [K], or -1 if `T` is
+    //! outside the tabulated range of the saturation curve.
+    double satPressure(double T) const;
+
+    //! Maximum error of the table, relative to the full equation of state.
+    /*!
+     * The error is evaluated at the center of each grid cell, which is where
+     * the interpolation error is largest. The relative error is used for the
+     * density, heat capacities and compressibility, while the errors in the
+     * enthalpy and entropy are normalized by RT and R respectively. The error
+     * in the thermal expansion coefficient, which passes through zero, is
+     * normalized by the larger of its magnitude and 1/T.
+     */
+    double maxError() const;
+
+    //! Minimum temperature [K] covered by the table
+    double minTemp() const {
+        return m_Tmin;
+    }
+
+    //! Maximum temperature [K] of the liquid region
+    double maxLiquidTemp() const {
+        return m_Tsat;
+    }
+
+    //! Maximum temperature [K] of the vapor region
+    double maxTemp() const {
+        return m_Tmax;
+    }
+
+protected:
+    //! Tabulated values for one region, including one layer of extrapolated
+    //! ghost nodes around the grid so that the full interpolation stencil is
+    //! available in the boundary cells.
+    struct Region {
+        double T0; //!< temperature of the first grid node [K]
+        size_t nT; //!< number of temperature intervals
+        size_t nP; //!< number of pressure intervals
+        int phase; //!< WATER_LIQUID or WATER_GAS
+        //! Values for node (i, j) are stored starting at
+        //! `nProps * ((i+1) * (nP+3) + j+1)`, for i = -1 to nT+1 and j = -1
+        //! to nP+1.
+        vector_fp data;
+    };
+
+    //! Fill the tabulated values for region `r`
+    void fillRegion(WaterPropsIAPWS& water, Region& r);
+
+    //! Lower and upper limits of the pressure [Pa] of region `r` at
+    //! temperature `T`
+    void pressureRange(const Region& r, double T, double& Plow,
+                       double& Phigh) const;
+
+    //! Log of the saturation pressure [Pa] at temperature `T`, using the
+    //! value at the nearest end of the tabulated range if `T` is outside of it
+    double lnSatPressure(double T) const;
+
+    //! Interpolate all properties in region `r` at temperature `T` and
+    //! pressure `P`, corresponding to the scaled pressure coordinate `x`
+    void interpolate(const Region& r, double T, double P, double x,
+                     State& state) const;
+
+    //! Evaluate the full equation of state at `T` and `P`
+    static void evaluate(WaterPropsIAPWS& water, double T, double P,
+                         int phase, State& state);
+
+    //! Catmull-Rom interpolation weights for the fractional position `t`
+    static void weights(double t, double* w);
+
+    double m_Tmin, m_Tsat, m_Tmax;
+    double m_Pmin, m_Pmax;
+
+    //! Temperature spacing of the grid
+    double m_dT;
+
+    //! Log of the saturation pressure at the temperatures of the liquid grid,
+    //! including one ghost node on either end
+    vector_fp m_lnPsat;
+
+    Region m_liquid;
+    Region m_vapor;
+    Region m_superheated;
+};
+
+}
+
+#endif
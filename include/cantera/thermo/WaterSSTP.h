@@ -13,6 +13,7 @@
 #include "SingleSpeciesTP.h"
 #include "cantera/thermo/WaterPropsIAPWS.h"
 #include "cantera/thermo/WaterProps.h"
+#include "cantera/thermo/WaterPropsTable.h"
 
 namespace Cantera
 {
@@ -230,6 +231,35 @@ public:
         return m_waterProps.get();
     }
 
+    //! @name Tabulated Properties
+    /*!
+     * Setting the state by temperature and pressure normally requires an
+     * iterative solution of the IAPWS equation of state for the density. If a
+     * WaterPropsTable is set, the density is instead interpolated from the
+     * table for states which it covers and refined by Newton iteration on the
+     * equation of state, so that the state is consistent with the pressure.
+     * The reference state properties are evaluated from the table without
+     * modifying the state of the underlying WaterPropsIAPWS object. States
+     * outside the table are evaluated using the full equation of state.
+     */
+    //! @{
+
+    //! Use the table `table` to evaluate properties. The same table may be
+    //! shared between multiple phases. Passing an empty pointer disables
+    //! tabulation.
+    void setTabulation(shared_ptr<WaterPropsTable> table);
+
+    //! Build a table which reproduces the equation of state to within the
+    //! tolerance `tol` (see WaterPropsTable::build), and use it to evaluate
+    //! properties.
+    void enableTabulation(double tol=1e-3);
+
+    //! The table used to evaluate properties, if any
+    shared_ptr<WaterPropsTable> tabulation() const {
+        return m_table;
+    }
+    //! @}
+
 protected:
     /**
      * @internal This internal routine must be overridden because it is not
@@ -237,6 +267,12 @@ protected:
      */
     void _updateThermo() const;
 
+    //! Evaluate the properties at temperature `T` and pressure `P` from the
+    //! table, for the phase corresponding to the current density. Returns
+    //! false if tabulation is not enabled or the state is not covered by the
+    //! table.
+    bool lookup(double T, double P, WaterPropsTable::State& state) const;
+
 private:
     //! WaterPropsIAPWS that calculates the real properties of water.
     mutable WaterPropsIAPWS m_sub;
@@ -276,6 +312,9 @@ private:
      *  consistency with ideal-gas thermo functions for example.
      */
     bool m_allowGasPhase;
+
+    //! Table used to evaluate properties, if tabulation is enabled
+    shared_ptr<WaterPropsTable> m_table;
 };
 
 }
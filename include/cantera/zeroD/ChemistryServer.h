@@ -0,0 +1,220 @@
+//! @file ChemistryServer.h Node-local evaluation of chemistry and properties
+//!     through shared memory
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_CHEMISTRYSERVER_H
+#define CT_CHEMISTRYSERVER_H
+
+#include "cantera/base/ct_defs.h"
+#include <atomic>
+
+namespace Cantera
+{
+
+class ThermoPhase;
+class Kinetics;
+class Transport;
+class ReactorBase;
+class Reactor;
+class ReactorNet;
+
+//! Number of properties returned for each point by
+//! ChemistryClient::getProperties, not counting the diffusion coefficients
+const size_t nServerProperties = 5;
+
+/**
+ * Serves chemistry and property evaluations to other processes on the same
+ * machine through a named shared memory segment.
+ *
+ * The server holds a single copy of the phase, kinetics and transport
+ * managers, which are only read by the clients. Each ChemistryClient attached
+ * to the segment is assigned its own slot, which holds one batched request
+ * and its results. A slot is used as a single-producer, single-consumer queue
+ * with a depth of one: the client fills in the request and then publishes it
+ * by changing the state of the slot, and the server publishes the results in
+ * the same way. Because each slot is only ever written by one side at a time,
+ * no locks are needed, and clients never wait on each other except for the
+ * time the server spends evaluating their requests.
+ *
+ * The requests available are:
+ *  - the thermodynamic and transport properties at a set of states (see
+ *    ChemistryClient::getProperties)
+ *  - the net production rates at a set of states
+ *  - advancing a set of adiabatic, constant pressure reactors in time
+ *
+ * The segment is removed when the server is destroyed. This class is only
+ * available on platforms that support POSIX shared memory.
+ *
+ * @ingroup ZeroD
+ */
+class ChemistryServer
+{
+public:
+    //! Create the shared memory segment *name*.
+    //! @param name       Name of the segment. Must not be in use by another
+    //!                   server.
+    //! @param thermo     Phase used to evaluate all requests
+    //! @param kin        Kinetics manager for *thermo*
+    //! @param trans      Transport manager for *thermo*. May be null, in which
+    //!                   case property requests fail.
+    //! @param nSlots     Maximum number of clients attached at the same time
+    //! @param maxPoints  Maximum number of points in one request. Larger
+    //!                   batches are split by the client.
+    ChemistryServer(const std::string& name, ThermoPhase& thermo, Kinetics& kin,
+                    Transport* trans, size_t nSlots=64, size_t maxPoints=256);
+    ~ChemistryServer();
+    ChemistryServer(const ChemistryServer&) = delete;
+    ChemistryServer& operator=(const ChemistryServer&) = delete;
+
+    //! Answer requests until stop() is called, or a client calls
+    //! ChemistryClient::shutdownServer().
+    void serve();
+
+    //! Answer all pending requests once, without waiting for new ones.
+    //! Returns the number of requests answered.
+    size_t poll();
+
+    //! Make serve() return after answering the current request. Can be called
+    //! from any thread.
+    void stop();
+
+    //! Set the tolerances of the reactor network used for reactor requests
+    void setTolerances(double rtol, double atol);
+
+    //! Name of the shared memory segment
+    const std::string& name() const {
+        return m_name;
+    }
+
+protected:
+    //! Evaluate the request in slot *n* and publish the results
+    void answer(size_t n);
+
+    //! Advance the reactor of each point in the request of slot *n*
+    void advanceReactors(size_t n);
+
+    std::string m_name;
+    ThermoPhase& m_thermo;
+    Kinetics& m_kin;
+    Transport* m_trans;
+
+    //! Reactor and network used for reactor requests, created on first use
+    std::unique_ptr<Reactor> m_reactor;
+    std::unique_ptr<ReactorNet> m_net;
+    double m_rtol, m_atol;
+
+    //! Start and length of the mapped segment
+    char* m_map;
+    size_t m_mapSize;
+
+    //! Set by stop()
+    std::atomic<bool> m_stop;
+};
+
+//! Client of a ChemistryServer, usually running in another process.
+/*!
+ * All arrays of states use the same layout: the values for point `i` start
+ * at `i*nSpecies()` for mass fractions and species quantities, and at `i` for
+ * scalars. The methods block until the server has answered, and throw an
+ * exception if the server reports an error or does not answer within the
+ * timeout set with setTimeout().
+ *
+ * One client should only be used by one thread at a time. Threads that need
+ * to make concurrent requests should each use their own client.
+ *
+ * @ingroup ZeroD
+ */
+class ChemistryClient
+{
+public:
+    //! Create a client that is not attached to any server. Used only as a
+    //! placeholder.
+    ChemistryClient();
+
+    //! Attach to the server that created the segment *name*
+    explicit ChemistryClient(const std::string& name);
+    ~ChemistryClient();
+    ChemistryClient(const ChemistryClient&) = delete;
+    ChemistryClient& operator=(const ChemistryClient&) = delete;
+
+    //! Number of species in the phase of the server
+    size_t nSpecies() const {
+        return m_nsp;
+    }
+
+    //! Name of species *k*
+    const std::string& speciesName(size_t k) const;
+
+    //! Index of the species *name*, or `npos` if there is no such species
+    size_t speciesIndex(const std::string& name) const;
+
+    //! Maximum number of points the server evaluates in one request
+    size_t maxPoints() const {
+        return m_maxPoints;
+    }
+
+    //! Set the time in seconds to wait for an answer before throwing an
+    //! exception. A value of zero disables the timeout. The default is 60 s.
+    //! After a timeout, the slot of the client is released by the server once
+    //! it has dealt with the pending request, and the client is no longer
+    //! attached to the server.
+    void setTimeout(double seconds) {
+        m_timeout = seconds;
+    }
+
+    //! Net production rates [kmol/m^3/s] of each species at *n* states.
+    //! @param n     Number of states
+    //! @param T     Temperatures [K]. Length *n*.
+    //! @param P     Pressures [Pa]. Length *n*.
+    //! @param Y     Mass fractions. Length `n*nSpecies()`.
+    //! @param[out] wdot  Net production rates. Length `n*nSpecies()`.
+    void getNetProductionRates(size_t n, const double* T, const double* P,
+                               const double* Y, double* wdot);
+
+    //! Thermodynamic and transport properties at *n* states. For each state,
+    //! the properties are the density [kg/m^3], the mass specific heat
+    //! capacity at constant pressure [J/kg/K], the mass specific enthalpy
+    //! [J/kg], the viscosity [Pa*s] and the thermal conductivity [W/m/K],
+    //! followed by the mixture-averaged diffusion coefficients of each
+    //! species [m^2/s].
+    //! @param[out] props  Length `n*(nServerProperties + nSpecies())`
+    void getProperties(size_t n, const double* T, const double* P,
+                       const double* Y, double* props);
+
+    //! Advance *n* adiabatic, constant pressure reactors by the time *dt*.
+    //! @param[in,out] T  Initial and final temperatures
+    //! @param P          Pressures
+    //! @param[in,out] Y  Initial and final mass fractions
+    void advanceReactors(size_t n, double dt, double* T, const double* P,
+                         double* Y);
+
+    //! Ask the server to stop answering requests
+    void shutdownServer();
+
+protected:
+    //! Send one batch of at most maxPoints() points of the request *type*
+    //! and wait for the answer
+    void request(int type, size_t n, double dt, const double* T,
+                 const double* P, const double* Y, double* out,
+                 size_t outStride);
+
+    void checkAttached(const std::string& method) const;
+
+    size_t m_nsp;
+    size_t m_maxPoints;
+    std::vector<std::string> m_speciesNames;
+    double m_timeout;
+
+    //! Start and length of the mapped segment
+    char* m_map;
+    size_t m_mapSize;
+
+    //! Slot assigned to this client
+    size_t m_slot;
+};
+
+}
+
+#endif
@@ -0,0 +1,106 @@
+//! @file IgnitionDelayModel.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_IGNITIONDELAYMODEL_H
+#define CT_IGNITIONDELAYMODEL_H
+
+#include "cantera/kinetics/UncertaintyEnsemble.h"
+#include "cantera/zeroD/IdealGasConstPressureReactor.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/IdealGasMix.h"
+
+namespace Cantera
+{
+
+//! Ignition delay of an adiabatic, constant pressure ideal gas reactor, for
+//! use with UncertaintyEnsemble.
+/*!
+ * The ignition delay is the time at which the temperature first exceeds the
+ * initial temperature by a given amount. The integration is stopped at that
+ * point. For the samples, the integration is also stopped after a multiple of
+ * the nominal ignition delay set by setHorizon(), and the integration of each
+ * sample starts with the first step taken for the nominal case (see
+ * ReactorNet::setInitialStepSize), so that the result of a sample does not
+ * depend on the samples solved before it by the same model. Samples that do
+ * not ignite within the horizon throw a CensoredSampleError, and are listed
+ * by UncertaintyEnsemble::censoredSamples().
+ *
+ * The only output of the model is the ignition delay [s].
+ *
+ * @ingroup ZeroD
+ */
+class IgnitionDelayModel : public EnsembleModel
+{
+public:
+    //! Constructor.
+    //! @param infile  Input file defining the gas phase
+    //! @param id      ID of the phase in *infile*
+    //! @param T0      Initial temperature [K]
+    //! @param P0      Pressure [Pa]
+    //! @param X0      Initial mole fractions, in a form accepted by
+    //!                ThermoPhase::setMoleFractionsByName
+    //! @param deltaT  Temperature rise defining ignition [K]
+    //! @param tMax    Longest integration time for the nominal case [s]
+    IgnitionDelayModel(const std::string& infile, const std::string& id,
+                       double T0, double P0, const std::string& X0,
+                       double deltaT=400.0, double tMax=10.0);
+
+    virtual Kinetics& kinetics() {
+        return m_gas;
+    }
+
+    virtual size_t nOutputs() const {
+        return 1;
+    }
+
+    virtual void solveNominal(double* outputs);
+    virtual bool copyNominal(const EnsembleModel& other);
+    virtual void solve(double* outputs);
+
+    //! Stop the integration of the samples after *factor* times the nominal
+    //! ignition delay, or after the longest integration time given to the
+    //! constructor if that is shorter. The default is 10. Increasing the
+    //! horizon reduces the number of censored samples, at the cost of longer
+    //! integrations for the samples that do not ignite.
+    void setHorizon(double factor);
+
+    //! Multiple of the nominal ignition delay after which the integration of
+    //! the samples is stopped
+    double horizon() const {
+        return m_horizon;
+    }
+
+    //! The reactor network, for setting tolerances and other options
+    ReactorNet& network() {
+        return m_net;
+    }
+
+protected:
+    //! Integrate from the initial state until ignition or *tEnd*, and return
+    //! the ignition delay. Throws a CensoredSampleError if there is no
+    //! ignition before *tEnd*. If *h0* is given, it is set to the size of the
+    //! first step.
+    double ignitionDelay(double tEnd, double* h0=nullptr);
+
+    IdealGasMix m_gas;
+    IdealGasConstPressureReactor m_reactor;
+    ReactorNet m_net;
+
+    double m_T0, m_P0;
+    vector_fp m_Y0;
+    double m_deltaT;
+    double m_tMax;
+    double m_horizon;
+
+    //! Nominal ignition delay
+    double m_tau0;
+
+    //! Size of the first step of the nominal integration
+    double m_h0;
+};
+
+}
+
+#endif
@@ -0,0 +1,74 @@
+//! @file RCCEReactor.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_RCCE_REACTOR_H
+#define CT_RCCE_REACTOR_H
+
+#include "Reactor.h"
+#include "cantera/equil/RCCE.h"
+
+namespace Cantera
+{
+
+/**
+ * Class RCCEReactor is a closed, constant-pressure reactor for ideal gas
+ * mixtures, where the composition is computed using rate-controlled
+ * constrained equilibrium (see class RCCE). Instead of the mass fractions of
+ * all species, the state variables are the temperature and the potentials of
+ * the element constraints and of any additional constraints added with
+ * addConstraint(), so that the number of equations is independent of the
+ * number of species.
+ *
+ * When the reactor is initialized, the contents are set to the
+ * constrained-equilibrium state with the same constraint values, enthalpy and
+ * pressure as the initial state. Heat transfer through walls is included, but
+ * inlets, outlets and surface reactions are not supported.
+ */
+class RCCEReactor : public Reactor
+{
+public:
+    RCCEReactor() {}
+
+    virtual int type() const {
+        return RCCEReactorType;
+    }
+
+    virtual void setThermoMgr(ThermoPhase& thermo);
+
+    //! Add a constraint on a linear combination of the species abundances.
+    //! @see RCCE::addConstraint
+    void addConstraint(const std::string& name, const compositionMap& coeffs);
+
+    //! The object used to compute the constrained-equilibrium states. Only
+    //! available after the reactor has been initialized.
+    RCCE& rcce();
+
+    virtual void getState(doublereal* y);
+
+    virtual void initialize(doublereal t0 = 0.0);
+    virtual void evalEqs(doublereal t, doublereal* y,
+                         doublereal* ydot, doublereal* params);
+
+    virtual void updateState(doublereal* y);
+
+    //! Return the index in the solution vector for this reactor of the
+    //! component named *nm*. Possible values for *nm* are "mass",
+    //! "temperature", or the name of a constraint.
+    virtual size_t componentIndex(const std::string& nm) const;
+    std::string componentName(size_t k);
+
+protected:
+    //! Additional constraints, added to #m_rcce when the reactor is
+    //! initialized
+    std::vector<std::pair<std::string, compositionMap>> m_constraints;
+
+    std::unique_ptr<RCCE> m_rcce;
+
+    //! Rates of change of the constraints
+    vector_fp m_cdot;
+};
+}
+
+#endif
@@ -110,6 +110,13 @@ public:
     //! Set the state of the reactor to correspond to the state vector *y*.
     virtual void updateState(doublereal* y);
 
+    //! Set the mass fractions of the quasi-steady-state species in the
+    //! contents of the reactor to their quasi-steady-state values at the
+    //! current state (see Kinetics::applyQSSConcentrations). Called by
+    //! ReactorNet after each step. The state vector of the reactor keeps
+    //! one component for each of these species, which is not updated.
+    void updateQSSState();
+
     //! Number of sensitivity parameters associated with this reactor
     //! (including walls)
     virtual size_t nSensParams();
@@ -22,6 +22,7 @@ const int FlowReactorType = 3;
 const int ConstPressureReactorType = 4;
 const int IdealGasReactorType = 5;
 const int IdealGasConstPressureReactorType = 6;
+const int RCCEReactorType = 7;
 
 enum class SensParameterType {
     reaction,
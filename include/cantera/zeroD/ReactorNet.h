@@ -37,6 +37,18 @@ public:
     //! Set the maximum time step.
     void setMaxTimeStep(double maxstep);
 
+    //! Select the integrator used to advance the network.
+    /*!
+     * @param itype  Type of the integrator, as used by newIntegrator():
+     *     `"CVODE"` (the default), `"Rosenbrock"` or `"Extrapolation"`. The
+     *     Rosenbrock and extrapolation integrators use evalJacobian() and do
+     *     not support sensitivity analysis.
+     *
+     * Options of the previous integrator set with setWarmRestart() or
+     * setInitialStepSize() are not transferred to the new one.
+     */
+    void setIntegrator(const std::string& itype);
+
     //! Set the maximum number of error test failures permitted by the CVODES
     //! integrator in a single time step.
     void setMaxErrTestFails(int nmax);
@@ -44,6 +56,39 @@ public:
     //! Set the relative and absolute tolerances for the integrator.
     void setTolerances(double rtol, double atol);
 
+    //! Enable or disable warm restarts of the integrator.
+    /*!
+     * With warm restarts, reinitialize() and setInitialTime() keep the last
+     * step size and, for small changes in the state, the Jacobian from the
+     * previous integration. This reduces the cost of the many short
+     * integrations used in operator-split coupling with CFD codes.
+     *
+     * Changes to the reactors which are not part of the state, such as new
+     * reaction rate multipliers or a different heat transfer coefficient,
+     * are not detected. Call invalidateJacobian() after such changes.
+     *
+     * @param warm      Enable warm restarts
+     * @param jacTol    Largest relative change in any component of the state
+     *     for which the previous Jacobian is reused
+     * @param maxJacAge Maximum number of restarts for which the same
+     *     Jacobian is reused before a new one is evaluated
+     * @see Integrator::setWarmRestart
+     */
+    void setWarmRestart(bool warm, double jacTol=0.05, int maxJacAge=20);
+
+    //! Discard the Jacobian kept for warm restarts, so that a new one is
+    //! evaluated at the next restart. @see Integrator::invalidateJacobian
+    void invalidateJacobian() {
+        m_integ->invalidateJacobian();
+    }
+
+    //! Set the size of the first step after the integrator is initialized or
+    //! reinitialized. Zero, the default, lets the integrator estimate it.
+    //! @see Integrator::setInitialStepSize
+    void setInitialStepSize(double h0) {
+        m_integ->setInitialStepSize(h0);
+    }
+
     //! Set the relative and absolute tolerances for integrating the
     //! sensitivity equations.
     void setSensitivityTolerances(double rtol, double atol);
@@ -150,9 +195,10 @@ public:
      *  @param[out] ydot Time derivative of the state vector evaluated at *t*.
      *  @param[in] p sensitivity parameter vector (unused?)
      *  @param[out] j Jacobian matrix, size neq() by neq().
+     *  @returns `true`
      */
-    void evalJacobian(doublereal t, doublereal* y,
-                      doublereal* ydot, doublereal* p, Array2D* j);
+    virtual bool evalJacobian(doublereal t, doublereal* y,
+                              doublereal* ydot, doublereal* p, Array2D* j);
 
     // overloaded methods of class FuncEval
     virtual size_t neq() {
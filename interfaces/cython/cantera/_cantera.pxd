@@ -56,6 +56,14 @@ cdef extern from "cantera/base/global.h" namespace "Cantera":
     cdef void Cxx_suppress_thermo_warnings "Cantera::suppress_thermo_warnings" (cbool)
     cdef string CxxGitCommit "Cantera::gitCommit" ()
 
+cdef extern from "cantera/base/Tracer.h" namespace "Cantera":
+    cdef void CxxStartTracing "Cantera::startTracing" ()
+    cdef void CxxStopTracing "Cantera::stopTracing" ()
+    cdef void CxxClearTrace "Cantera::clearTrace" ()
+    cdef size_t CxxTraceEventCount "Cantera::traceEventCount" ()
+    cdef void CxxSetTraceThreadName "Cantera::setTraceThreadName" (string)
+    cdef void CxxWriteTrace "Cantera::writeTrace" (string) except +translate_exception
+
 cdef extern from "<memory>":
     cppclass shared_ptr "std::shared_ptr" [T]:
         T* get()
@@ -114,7 +122,7 @@ cdef extern from "cantera/thermo/ThermoPhase.h" namespace "Cantera":
         double maxTemp() except +translate_exception
         double refPressure() except +translate_exception
         cbool getElementPotentials(double*) except +translate_exception
-        void equilibrate(string, string, double, int, int, int, int) except +translate_exception
+        void equilibrate(string, string, double, int, int, int, int) nogil except +translate_exception
         void saveState(size_t, double*)
         void restoreState(size_t, double*)
 
@@ -425,7 +433,7 @@ cdef extern from "cantera/equil/MultiPhase.h" namespace "Cantera":
         void init() except +translate_exception
         void updatePhases() except +translate_exception
 
-        void equilibrate(string, string, double, int, int, int, int) except +translate_exception
+        void equilibrate(string, string, double, int, int, int, int) nogil except +translate_exception
 
         size_t nSpecies()
         size_t nElements()
@@ -566,8 +574,8 @@ cdef extern from "cantera/zeroD/ReactorNet.h":
     cdef cppclass CxxReactorNet "Cantera::ReactorNet":
         CxxReactorNet()
         void addReactor(CxxReactor&)
-        void advance(double) except +translate_exception
-        double step() except +translate_exception
+        void advance(double) nogil except +translate_exception
+        double step() nogil except +translate_exception
         void reinitialize() except +translate_exception
         double time()
         void setInitialTime(double)
@@ -576,6 +584,9 @@ cdef extern from "cantera/zeroD/ReactorNet.h":
         double atol()
         void setMaxTimeStep(double)
         void setMaxErrTestFails(int)
+        void setWarmRestart(cbool, double, int)
+        void invalidateJacobian()
+        void setIntegrator(string) except +translate_exception
         cbool verbose()
         void setVerbose(cbool)
         size_t neq()
@@ -628,6 +639,8 @@ cdef extern from "cantera/oneD/Domain1D.h":
         double transient_rtol(size_t)
         double transient_atol(size_t)
         double grid(size_t)
+        vector[double]& grid()
+        size_t loc()
         void setupGrid(size_t, double*) except +translate_exception
         void setID(string)
         string& id()
@@ -665,6 +678,8 @@ cdef extern from "cantera/oneD/Inlet1D.h":
         CxxRreactingSurf1D()
         void setKineticsMgr(CxxInterfaceKinetics*) except +translate_exception
         void enableCoverageEquations(cbool) except +translate_exception
+        void enableQuasiSteadyCoverages(cbool) except +translate_exception
+        void enableAnalyticJacobian(cbool)
 
 
 cdef extern from "cantera/oneD/StFlow.h":
@@ -679,6 +694,8 @@ cdef extern from "cantera/oneD/StFlow.h":
         double pressure()
         void setFixedTempProfile(vector[double]&, vector[double]&)
         void setBoundaryEmissivities(double, double)
+        void setAbsorptionCoeffs(string, vector[double]&, vector[double]&) except +translate_exception
+        void setSootVolumeFraction(vector[double]&, vector[double]&) except +translate_exception
         void solveEnergyEqn()
         void fixTemperature()
         cbool doEnergy(size_t)
@@ -692,6 +709,21 @@ cdef extern from "cantera/oneD/StFlow.h":
         CxxAxiStagnFlow(CxxIdealGasPhase*, int, int)
 
 
+cdef extern from "cantera/oneD/MultiJac.h":
+    cdef cppclass CxxMultiJac "Cantera::MultiJac":
+        size_t nColumns()
+        size_t nSubDiagonals()
+        size_t nSuperDiagonals()
+        size_t ldim()
+        double* ptrColumn(size_t)
+
+
+cdef extern from "cantera/oneD/OneDim.h":
+    cdef cppclass CxxOneDim "Cantera::OneDim":
+        CxxMultiJac& jacobian()
+        shared_ptr[CxxMultiJac] sharedJacobian()
+
+
 cdef extern from "cantera/oneD/Sim1D.h":
     cdef cppclass CxxSim1D "Cantera::Sim1D":
         CxxSim1D(vector[CxxDomain1D*]&) except +translate_exception
@@ -705,11 +737,12 @@ cdef extern from "cantera/oneD/Sim1D.h":
         void setMaxTimeStepCount(int)
         int maxTimeStepCount()
         void getInitialSoln() except +translate_exception
-        void solve(int, cbool) except +translate_exception
+        void solve(int, cbool) nogil except +translate_exception
         void refine(int) except +translate_exception
         void setRefineCriteria(size_t, double, double, double, double) except +translate_exception
         void save(string, string, string, int) except +translate_exception
         void restore(string, string, int) except +translate_exception
+        void mapSolution(CxxSim1D&, cbool, int) except +translate_exception
         void writeStats(int) except +translate_exception
         void clearStats()
         void resize() except +translate_exception
@@ -725,6 +758,7 @@ cdef extern from "cantera/oneD/Sim1D.h":
         double workValue(size_t, size_t, size_t) except +translate_exception
         void eval(double ) except +translate_exception
         size_t size()
+        vector[double]& solutionVector()
         void solveAdjoint(const double*, double*) except +translate_exception
         void getResidual(double, double*) except +translate_exception
         void setJacAge(int, int)
@@ -1036,6 +1070,20 @@ cdef class Sim1D:
     cdef Func1 interrupt
     cdef Func1 time_step_callback
     cdef Func1 steady_callback
+    cdef object _solution_views
+    cdef _solve(self, int loglevel, cbool refine_grid)
+    cdef _detach_views(self)
+
+cdef class _ArrayView:
+    cdef object owner
+    cdef dict interface
+    cdef object __weakref__
+
+cdef class _ArrayBuffer:
+    cdef vector[double] data
+
+cdef class _JacobianBuffer:
+    cdef shared_ptr[CxxMultiJac] jac
 
 cdef class ReactionPathDiagram:
     cdef CxxReactionPathDiagram diagram
@@ -1048,6 +1096,7 @@ cdef class ReactionPathDiagram:
 # free functions
 cdef string stringify(x) except *
 cdef pystr(string x)
+cdef np.ndarray array_view(object owner, double* data, size_t n, cbool writable)
 cdef np.ndarray get_species_array(Kinetics kin, kineticsMethod1d method)
 cdef np.ndarray get_reaction_array(Kinetics kin, kineticsMethod1d method)
 cdef np.ndarray get_transport_1d(Transport tran, transportMethod1d method)
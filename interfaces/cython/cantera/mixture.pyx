@@ -325,5 +325,11 @@ cdef class Mixture:
             process. 0 indicates no output, while larger numbers produce
             successively more verbose information.
         """
-        self.mix.equilibrate(stringify(XY.upper()), stringify(solver), rtol,
-                             max_steps, max_iter, estimate_equil, log_level)
+        cdef string cxx_XY = stringify(XY.upper())
+        cdef string cxx_solver = stringify(solver)
+        cdef double cxx_rtol = rtol
+        cdef int cxx_steps = max_steps, cxx_iter = max_iter
+        cdef int cxx_estimate = estimate_equil, cxx_log = log_level
+        with nogil:
+            self.mix.equilibrate(cxx_XY, cxx_solver, cxx_rtol, cxx_steps,
+                                 cxx_iter, cxx_estimate, cxx_log)
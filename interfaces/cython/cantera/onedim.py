@@ -134,6 +134,20 @@ class FlameBase(Sim1D):
     def set_boundary_emissivities(self, e_left, e_right):
         self.flame.set_boundary_emissivities(e_left, e_right)
 
+    def set_absorption_coeffs(self, species, T, kP):
+        """
+        Set the Planck-mean absorption coefficient [1/m/atm] of *species* as
+        a function of the temperature *T* [K] for the radiation model.
+        """
+        self.flame.set_absorption_coeffs(species, T, kP)
+
+    def set_soot_volume_fraction(self, z, fv):
+        """
+        Set the soot volume fraction profile *fv* at positions *z* [m] for the
+        radiation model.
+        """
+        self.flame.set_soot_volume_fraction(z, fv)
+
     @property
     def grid(self):
         """ Array of grid point positions along the flame. """
@@ -240,10 +254,9 @@ class FlameBase(Sim1D):
         *point*.
         """
         k0 = self.flame.component_index(self.gas.species_name(0))
-        Y = [self.solution(k, point)
-             for k in range(k0, k0 + self.gas.n_species)]
-        self.gas.set_unnormalized_mass_fractions(Y)
-        self.gas.TP = self.value(self.flame, 'T', point), self.P
+        x = self.solution_view(self.flame)[:, point]
+        self.gas.set_unnormalized_mass_fractions(x[k0:k0 + self.gas.n_species])
+        self.gas.TP = x[self.flame.component_index('T')], self.P
 
     @property
     def heat_release_rate(self):
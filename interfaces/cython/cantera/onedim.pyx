@@ -2,6 +2,7 @@
 # at http://www.cantera.org/license.txt for license and copyright information.
 
 import interrupts
+import weakref
 
 # Need a pure-python class to store weakrefs to
 class _WeakrefProxy(object):
@@ -206,11 +207,10 @@ cdef class Domain1D:
     property grid:
         """ The grid for this domain """
         def __get__(self):
-            cdef np.ndarray[np.double_t, ndim=1] grid = np.empty(self.n_points)
-            cdef int i
-            for i in range(self.n_points):
-                grid[i] = self.domain.grid(i)
-            return grid
+            if self.n_points == 0:
+                return np.empty(0)
+            return array_view(self, &self.domain.grid()[0], self.n_points,
+                              False).copy()
 
         def __set__(self, grid):
             cdef np.ndarray[np.double_t, ndim=1] data = \
@@ -382,6 +382,24 @@ cdef class ReactingSurface1D(Boundary1D):
         def __set__(self, value):
             self.surf.enableCoverageEquations(<cbool>value)
 
+    property quasi_steady_coverages:
+        """
+        If `True`, the surface coverages are not solved for by the Newton
+        solver, but are set to the quasi-steady-state coverages for the local
+        gas composition each time the residual is evaluated.
+        """
+        def __set__(self, value):
+            self.surf.enableQuasiSteadyCoverages(<cbool>value)
+
+    property analytic_jacobian:
+        """
+        Controls whether the Jacobian columns of the surface coverages are
+        computed analytically, if the mechanism allows it, instead of by
+        finite differences. Enabled by default.
+        """
+        def __set__(self, value):
+            self.surf.enableAnalyticJacobian(<cbool>value)
+
 
 cdef class _FlowBase(Domain1D):
     """ Base class for 1D flow domains """
@@ -460,6 +478,42 @@ cdef class _FlowBase(Domain1D):
     def set_boundary_emissivities(self, e_left, e_right):
         self.flow.setBoundaryEmissivities(e_left, e_right)
 
+    def set_absorption_coeffs(self, species, T, kP):
+        """
+        Set the Planck-mean absorption coefficient of a species used by the
+        radiation model, e.g. for the vapor of a liquid fuel. Tables for CO2,
+        H2O, CO and CH4 are included by default.
+
+        :param species:
+            Name of the species
+        :param T:
+            Array of temperatures [K] in increasing order
+        :param kP:
+            Array of absorption coefficients [1/m/atm] at each temperature
+        """
+        cdef vector[double] cxx_T, cxx_kP
+        for t in T:
+            cxx_T.push_back(t)
+        for k in kP:
+            cxx_kP.push_back(k)
+        self.flow.setAbsorptionCoeffs(stringify(species), cxx_T, cxx_kP)
+
+    def set_soot_volume_fraction(self, z, fv):
+        """
+        Set the soot volume fraction profile used by the radiation model.
+
+        :param z:
+            Array of positions [m]
+        :param fv:
+            Array of soot volume fractions at each position
+        """
+        cdef vector[double] cxx_z, cxx_fv
+        for x in z:
+            cxx_z.push_back(x)
+        for f in fv:
+            cxx_fv.push_back(f)
+        self.flow.setSootVolumeFraction(cxx_z, cxx_fv)
+
     property radiation_enabled:
         """ Determines whether or not to include radiative heat transfer """
         def __get__(self):
@@ -514,6 +568,15 @@ cdef class AxisymmetricStagnationFlow(_FlowBase):
         self.flow = <CxxStFlow*>(new CxxAxiStagnFlow(gas, thermo.n_species, 2))
 
 
+cdef class _JacobianBuffer:
+    """
+    Keeps the Jacobian evaluator of a `Sim1D` alive while arrays created by
+    `Sim1D.jacobian_view` refer to its storage, including after the evaluator
+    has been replaced because the problem was resized.
+    """
+    pass
+
+
 cdef class Sim1D:
     """
     Class Sim1D is a container for one-dimensional domains. It also holds the
@@ -538,6 +601,7 @@ cdef class Sim1D:
         self._initialized = False
         self._initial_guess_args = ()
         self._initial_guess_kwargs = {}
+        self._solution_views = weakref.WeakSet()
 
     def set_interrupt(self, f):
         """
@@ -682,12 +746,97 @@ cdef class Sim1D:
         >>> T = s.profile(flow, 'T')
         """
         idom, kcomp = self._get_indices(domain, component)
-        dom = self.domains[idom]
-        cdef int j
-        cdef np.ndarray[np.double_t, ndim=1] data = np.empty(dom.n_points)
-        for j in range(dom.n_points):
-            data[j] = self.sim.value(idom, kcomp, j)
-        return data
+        return self.solution_view(idom)[kcomp].copy()
+
+    def solution_view(self, domain=None, writable=False):
+        """
+        Array sharing memory with the solution vector, without copying. If
+        *domain* is None, this is the full solution vector. Otherwise, it is a
+        2D array of size `n_components` x `n_points` containing the solution in
+        the specified domain.
+
+        :param domain:
+            Domain1D object, name, or index
+        :param writable:
+            If True, changes to the array modify the solution vector.
+            Otherwise, the array is read-only.
+
+        Calls which may reallocate the solution vector, such as `solve`,
+        `refine`, `restore` or `set_initial_guess`, detach the existing views
+        from it. Detached views keep the values they had before the call, but
+        no longer share memory with the solution vector, so a new view is
+        needed to see the updated solution. Views created from callbacks
+        during `solve` are only valid until the callback returns.
+
+        >>> T = s.solution_view(flame)[flame.component_index('T')]
+        """
+        cdef vector[double]* x = &self.sim.solutionVector()
+        cdef np.ndarray data
+        if x.size() == 0:
+            data = np.empty(0)
+        else:
+            data = array_view(self, x.data(), x.size(), writable)
+            self._solution_views.add((<object>data).base)
+        if domain is None:
+            return data
+
+        cdef Domain1D dom = self.domains[self.domain_index(domain)]
+        cdef size_t start = dom.domain.loc()
+        cdef size_t nv = dom.n_components
+        cdef size_t npts = dom.n_points
+        return data[start:start + nv * npts].reshape(npts, nv).T
+
+    def residual(self, rdt=0.0,
+                 np.ndarray[np.double_t, ndim=1, mode="c"] out=None):
+        """
+        Evaluate the governing equations using the current solution estimate
+        and return the residual vector.
+
+        :param rdt:
+           Reciprocal of the time-step
+        :param out:
+            Optional array of length `size` in which the residual is stored,
+            to avoid allocating a new array for each call.
+        """
+        cdef size_t n = self.sim.size()
+        if out is None:
+            out = np.empty(n)
+        elif out.shape[0] != n:
+            raise ValueError('Output array has length {}, but the solution '
+                             'vector has length {}'.format(out.shape[0], n))
+        if n == 0:
+            return out
+        self.sim.getResidual(rdt, &out[0])
+        return out
+
+    def jacobian_view(self, writable=False):
+        """
+        Array sharing memory with the most recently evaluated Jacobian matrix,
+        without copying. The Jacobian is stored in LAPACK banded format, as an
+        array of size `ldim` x `size` where element `(i, j)` of the Jacobian is
+        located at `[kl + ku + i - j, j]`, with `kl` and `ku` being the number
+        of sub- and super-diagonals, and `ldim = 2*kl + ku + 1`. If the last
+        Jacobian was evaluated while time stepping, it includes the transient
+        terms.
+
+        The array follows each new evaluation of the Jacobian as long as the
+        size of the problem does not change. Calls which resize the problem,
+        such as `solve` with grid refinement, `refine` or `restore`, replace
+        the Jacobian evaluator. Existing views then keep the last Jacobian of
+        the previous grid, and a new view is needed to see the new one.
+
+        :param writable:
+            If True, changes to the array modify the stored Jacobian.
+            Otherwise, the array is read-only.
+        """
+        cdef _JacobianBuffer buf = _JacobianBuffer()
+        buf.jac = (<CxxOneDim*>self.sim).sharedJacobian()
+        cdef size_t ldim = buf.jac.get().ldim()
+        cdef size_t n = buf.jac.get().nColumns()
+        if n == 0:
+            return np.empty((ldim, 0))
+        data = array_view(buf, buf.jac.get().ptrColumn(0), ldim * n, writable)
+        return data.reshape(n, ldim).T
 
     def set_profile(self, domain, component, positions, values):
         """
@@ -776,6 +925,7 @@ cdef class Sim1D:
         Load the initial solution from each domain into the global solution
         vector.
         """
+        self._detach_views()
         self.sim.resize()
         self.sim.getInitialSoln()
 
@@ -786,6 +936,30 @@ cdef class Sim1D:
         """
         return False
 
+    cdef _detach_views(self):
+        # Hand over the memory of the solution vector to the arrays returned
+        # by solution_view, and give the solution vector a copy, before a call
+        # which may reallocate it. This keeps the arrays valid.
+        cdef _ArrayBuffer buf
+        cdef _ArrayView view
+        cdef vector[double]* x = &self.sim.solutionVector()
+        views = list(self._solution_views)
+        if not views:
+            return
+        buf = _ArrayBuffer()
+        buf.data.swap(x[0])
+        x[0] = buf.data
+        for view in views:
+            view.owner = buf
+        self._solution_views.clear()
+
+    cdef _solve(self, int loglevel, cbool refine_grid):
+        self._detach_views()
+        # Call the steady-state solver with the GIL released. Python callbacks
+        # (interrupts, time step callbacks) re-acquire it as needed.
+        with nogil:
+            self.sim.solve(loglevel, refine_grid)
+
     def solve(self, loglevel=1, refine_grid=True, auto=False):
         """
         Solve the problem.
@@ -808,7 +982,7 @@ cdef class Sim1D:
         if not auto:
             if not self._initialized:
                 self.set_initial_guess()
-            self.sim.solve(loglevel, <cbool>refine_grid)
+            self._solve(loglevel, <cbool>refine_grid)
             return
 
         have_user_tolerances = any(dom.have_user_tolerances for dom in self.domains)
@@ -855,7 +1029,7 @@ cdef class Sim1D:
             log('Solving on {} point grid with energy equation enabled', N)
             self.energy_enabled = True
             try:
-                self.sim.solve(loglevel, <cbool>False)
+                self._solve(loglevel, <cbool>False)
                 solved = True
             except CanteraError as e:
                 log(str(e))
@@ -868,7 +1042,7 @@ cdef class Sim1D:
                 log('Initial solve failed; Retrying with energy equation disabled')
                 self.energy_enabled = False
                 try:
-                    self.sim.solve(loglevel, <cbool>False)
+                    self._solve(loglevel, <cbool>False)
                     solved = True
                 except CanteraError as e:
                     log(str(e))
@@ -878,7 +1052,7 @@ cdef class Sim1D:
                     log('Solving on {} point grid with energy equation re-enabled', N)
                     self.energy_enabled = True
                     try:
-                        self.sim.solve(loglevel, <cbool>False)
+                        self._solve(loglevel, <cbool>False)
                         solved = True
                     except CanteraError as e:
                         log(str(e))
@@ -888,7 +1062,7 @@ cdef class Sim1D:
                 # Found a non-extinct solution on the fixed grid
                 log('Solving with grid refinement enabled')
                 try:
-                    self.sim.solve(loglevel, <cbool>True)
+                    self._solve(loglevel, <cbool>True)
                     solved = True
                 except CanteraError as e:
                     log(str(e))
@@ -921,7 +1095,7 @@ cdef class Sim1D:
 
         # Final call with expensive options enabled
         if have_user_tolerances or solve_multi:
-            self.sim.solve(loglevel, <cbool>True)
+            self._solve(loglevel, <cbool>True)
 
 
     def refine(self, loglevel=1):
@@ -929,6 +1103,7 @@ cdef class Sim1D:
         Refine the grid, adding points where solution is not adequately
         resolved.
         """
+        self._detach_views()
         self.sim.refine(loglevel)
 
     def set_refine_criteria(self, domain, ratio=10.0, slope=0.8, curve=0.8,
@@ -1003,6 +1178,7 @@ cdef class Sim1D:
         Set the temperature used to fix the spatial location of a freely
         propagating flame.
         """
+        self._detach_views()
         self.sim.setFixedTemperature(T)
 
     def save(self, filename='soln.xml', name='solution', description='none',
@@ -1037,15 +1213,45 @@ cdef class Sim1D:
 
         >>> s.restore(filename='save.xml', name='energy_off')
         """
+        self._detach_views()
         self.sim.restore(stringify(filename), stringify(name), loglevel)
         self._initialized = True
 
+    def map_solution(self, Sim1D other, use_other_grid=True, loglevel=1):
+        """
+        Set the solution vector by mapping the solution of another simulation
+        consisting of the same types of domains, which may use a different
+        reaction mechanism and different grids.
+
+        Solution components are matched by name, and are linearly interpolated
+        onto the new grid. Species which do not exist in the mechanism of
+        *other* are estimated from the local equilibrium composition, such
+        that the mass fractions at each point sum to one and the elemental
+        composition of the mapped species is conserved.
+
+        :param other:
+            Simulation to map the solution from
+        :param use_other_grid:
+            If True, each domain adopts the grid of the corresponding domain of
+            *other*. Otherwise, the solution is interpolated onto the current
+            grid of each domain.
+        :param loglevel:
+            Amount of logging information to display while mapping,
+            from 0 (disabled) to 2 (most verbose).
+
+        >>> detailed.map_solution(skeletal)
+        """
+        self._detach_views()
+        self.sim.mapSolution(deref(other.sim), use_other_grid, loglevel)
+        self._initialized = True
+
     def restore_time_stepping_solution(self):
         """
         Set the current solution vector to the last successful time-stepping
         solution. This can be used to examine the solver progress after a failed
         integration.
         """
+        self._detach_views()
         self.sim.restoreTimeSteppingSolution()
 
     def restore_steady_solution(self):
@@ -1054,6 +1260,7 @@ cdef class Sim1D:
         solution. This can be used to examine the solver progress after a
         failure during grid refinement.
         """
+        self._detach_views()
         self.sim.restoreSteadySolution()
 
     def show_stats(self, print_time=True):
@@ -847,15 +847,21 @@ cdef class ReactorNet:
         """
         Advance the state of the reactor network in time from the current
         time to time *t* [s], taking as many integrator timesteps as necessary.
+        The GIL is released during integration, so independent networks can
+        be advanced concurrently from multiple threads.
         """
-        self.net.advance(t)
+        with nogil:
+            self.net.advance(t)
 
     def step(self):
         """
         Take a single internal time step. The time after taking the step is
         returned.
         """
-        return self.net.step()
+        cdef double t
+        with nogil:
+            t = self.net.step()
+        return t
 
     def reinitialize(self):
         """
@@ -884,6 +890,41 @@ cdef class ReactorNet:
         """
         self.net.setMaxTimeStep(t)
 
+    def set_warm_restart(self, warm=True, jacobian_tol=0.05,
+                         max_jacobian_age=20):
+        """
+        Enable or disable warm restarts. With warm restarts, the integrator
+        keeps the last step size when it is reinitialized, and reuses the
+        Jacobian from the previous integration if no component of the state
+        has changed by more than the relative amount *jacobian_tol*, up to
+        *max_jacobian_age* times. This reduces the cost of repeatedly
+        integrating over short intervals with small changes in the state, as
+        in operator-split coupling with a flow solver.
+
+        Changes which are not part of the state, such as new reaction rate
+        multipliers, are not detected; call `invalidate_jacobian` after them.
+        """
+        self.net.setWarmRestart(warm, jacobian_tol, max_jacobian_age)
+
+    def invalidate_jacobian(self):
+        """
+        Discard the Jacobian kept for warm restarts, so that a new one is
+        evaluated at the next restart.
+        """
+        self.net.invalidateJacobian()
+
+    def set_integrator(self, integrator_type):
+        """
+        Select the integrator used to advance the network. *integrator_type*
+        is ``'CVODE'`` (the default), ``'Rosenbrock'`` for the fourth-order
+        Rosenbrock method RODAS4, or ``'Extrapolation'`` for an extrapolated
+        linearly implicit Euler method. The last two carry no history between
+        steps, which makes them cheaper than CVODE for short integrations
+        that are restarted often. They do not support sensitivity analysis.
+        Integrator options set by `set_warm_restart` are reset.
+        """
+        self.net.setIntegrator(stringify(integrator_type))
+
     property max_err_test_fails:
         """
         The maximum number of error test failures permitted by the CVODES
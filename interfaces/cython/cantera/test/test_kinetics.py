@@ -1,6 +1,7 @@
 import numpy as np
 import re
 import itertools
+import json
 from os.path import join as pjoin
 import os
 
@@ -49,6 +50,31 @@ class TestKinetics(utilities.CanteraTest):
         self.assertArrayNear(0.5 * fwd_rates0, fwd_rates2)
         self.assertArrayNear(0.5 * rev_rates0, rev_rates2)
 
+    def test_tracing(self):
+        ct.clear_trace()
+        ct.start_tracing()
+        self.phase.TP = 900, ct.one_atm
+        self.phase.net_production_rates
+        ct.stop_tracing()
+        n = ct.trace_event_count()
+        self.assertGreater(n, 0)
+        self.phase.TP = 1000, ct.one_atm
+        self.phase.net_production_rates
+        self.assertEqual(ct.trace_event_count(), n)
+
+        ct.set_trace_thread_name('main "thread"')
+        filename = pjoin(self.test_work_dir, 'kinetics-trace.json')
+        ct.write_trace(filename)
+        ct.clear_trace()
+        self.assertEqual(ct.trace_event_count(), 0)
+        with open(filename) as f:
+            trace = json.load(f)
+        names = [e['name'] for e in trace['traceEvents'] if e['ph'] == 'X']
+        self.assertIn('GasKinetics::updateROP', names)
+        self.assertIn('main "thread"',
+                      [e['args']['name'] for e in trace['traceEvents']
+                       if e['ph'] == 'M'])
+
     def test_reaction_type(self):
         self.assertNear(self.phase.reaction_type(0), 2) # 3rd body
         self.assertNear(self.phase.reaction_type(2), 1) # elementary
@@ -424,6 +424,49 @@ class TestFreeFlame(utilities.CanteraTest):
             k1 = gas1.species_index(species)
             self.assertArrayNear(Y1[k1], Y2[k2])
 
+    def test_map_solution(self):
+        reactants = 'H2:1.1, O2:1, AR:5'
+        p = 2 * ct.one_atm
+        Tin = 400
+
+        self.create_sim(p, Tin, reactants, mech='h2o2.xml')
+        gas1 = self.gas
+        sim1 = self.sim
+        self.solve_fixed_T()
+        self.solve_mix(ratio=5, slope=0.5, curve=0.3)
+        T1 = sim1.T
+        Y1 = sim1.Y
+        Su1 = sim1.u[0]
+
+        gas2 = ct.Solution('h2o2-plus.xml')
+        gas2.TPX = Tin, p, reactants
+        sim2 = ct.FreeFlame(gas2, width=0.01)
+        sim2.map_solution(sim1, loglevel=0)
+        self.assertArrayNear(sim1.grid, sim2.grid)
+        self.assertArrayNear(T1, sim2.T)
+        self.assertNear(sim1.P, sim2.P)
+        for k1, species in enumerate(gas1.species_names):
+            k2 = gas2.species_index(species)
+            self.assertArrayNear(Y1[k1], sim2.Y[k2])
+        self.assertTrue(all(sim2.Y[gas2.species_index('N2')] >= 0))
+
+        # The mapped solution should be close to the solution with the new
+        # mechanism, so that little or no time stepping is needed. The flame
+        # speeds differ slightly since h2o2-plus.xml lacks the H + O2 + M
+        # reaction.
+        sim2.set_refine_criteria(ratio=5, slope=0.5, curve=0.3)
+        sim2.solve(loglevel=0)
+        self.assertNear(Su1, sim2.u[0], 2e-2)
+        self.assertArrayNear(np.sum(sim2.Y, axis=0), np.ones(len(sim2.grid)))
+
+        # Map onto the existing grid of a simulation with a different width
+        self.create_sim(p, Tin, reactants, mech='h2o2-plus.xml', width=0.04)
+        grid = self.sim.grid
+        self.sim.map_solution(sim1, use_other_grid=False, loglevel=0)
+        self.assertArrayNear(self.sim.grid, grid)
+        self.assertArrayNear(self.sim.T,
+                             np.interp(self.sim.grid, sim1.grid, T1))
+
     def test_write_csv(self):
         filename = pjoin(self.test_work_dir, 'onedim-write_csv{0}.csv'.format(utilities.python_version))
         if os.path.exists(filename):
@@ -478,6 +521,82 @@ class TestFreeFlame(utilities.CanteraTest):
         self.sim.max_grid_points = 10
         self.assertEqual(self.sim.max_grid_points, 10)
 
+    def test_solution_views(self):
+        self.create_sim(ct.one_atm, 300.0, 'H2:1.1, O2:1, AR:5')
+        self.solve_fixed_T()
+        flame = self.sim.flame
+        kT = flame.component_index('T')
+
+        x = self.sim.solution_view()
+        self.assertEqual(len(x), sum(d.n_components * d.n_points
+                                     for d in self.sim.domains))
+        data = self.sim.solution_view(flame)
+        self.assertEqual(data.shape, (flame.n_components, flame.n_points))
+        self.assertArrayNear(data[kT], self.sim.T)
+        for j in (0, 3, flame.n_points - 1):
+            self.assertNear(data[kT, j], self.sim.value(flame, 'T', j))
+
+        # Read-only by default
+        with self.assertRaises(ValueError):
+            data[kT, 0] = 500.0
+
+        # Writable views modify the solution vector
+        data = self.sim.solution_view(flame, writable=True)
+        data[kT, 1] = 350.0
+        self.assertNear(self.sim.value(flame, 'T', 1), 350.0)
+
+        # Residual stored in a user-provided array
+        self.sim.eval()
+        r = np.empty(len(x))
+        self.assertIs(self.sim.residual(out=r), r)
+        j = flame.n_points // 2
+        start = self.sim.inlet.n_components * self.sim.inlet.n_points
+        self.assertNear(r[start + j * flame.n_components + kT],
+                        self.sim.work_value(flame, 'T', j))
+
+        J = self.sim.jacobian_view()
+        self.assertEqual(J.shape[1], len(x))
+        self.assertTrue(np.shares_memory(J, self.sim.jacobian_view()))
+        with self.assertRaises(ValueError):
+            J[0, 0] = 1.0
+
+    def test_solution_view_lifetime(self):
+        self.create_sim(ct.one_atm, 300.0, 'H2:1.1, O2:1, AR:5')
+        self.solve_fixed_T()
+        flame = self.sim.flame
+        kT = flame.component_index('T')
+        data = self.sim.solution_view(flame, writable=True)
+        T0 = data[kT].copy()
+        n0 = flame.n_points
+        size0 = len(self.sim.solution_view())
+        J = self.sim.jacobian_view()
+
+        # Grid refinement reallocates the solution vector. The old view keeps
+        # its values, but no longer shares memory with the solution.
+        self.solve_mix(ratio=2.0, slope=0.1, curve=0.1)
+        self.assertGreater(flame.n_points, n0)
+        self.assertEqual(data.shape, (flame.n_components, n0))
+        self.assertArrayNear(data[kT], T0)
+        data[kT, 1] = 123.0
+        self.assertNotEqual(self.sim.value(flame, 'T', 1), 123.0)
+
+        # The old Jacobian view keeps the last Jacobian of the previous grid
+        J1 = self.sim.jacobian_view()
+        self.assertEqual(J.shape[1], size0)
+        self.assertGreater(J1.shape[1], size0)
+        self.assertFalse(np.shares_memory(J, J1))
+
+        data = self.sim.solution_view(flame)
+        self.assertEqual(data.shape, (flame.n_components, flame.n_points))
+        self.assertArrayNear(data[kT], self.sim.T)
+
+        # Fixing the temperature adds a grid point
+        T1 = data[kT].copy()
+        n1 = flame.n_points
+        self.sim.set_fixed_temperature(0.5 * (T1[0] + T1[-1]))
+        self.assertEqual(data.shape, (flame.n_components, n1))
+        self.assertArrayNear(data[kT], T1)
+
 
 class TestDiffusionFlame(utilities.CanteraTest):
     # Note: to re-create the reference file:
@@ -645,6 +764,23 @@ class TestDiffusionFlame(utilities.CanteraTest):
                                             rtol=1e-2, atol=1e-8, xtol=1e-2)
             self.assertFalse(bad, bad)
 
+    def test_radiation_absorbers(self):
+        self.create_sim(p=ct.one_atm)
+        self.solve_fixed_T()
+        self.sim.radiation_enabled = True
+        self.solve_mix()
+        Tmax = max(self.sim.T)
+
+        # Additional absorbers increase the radiative heat loss
+        self.sim.set_absorption_coeffs('H2', [300, 3000], [5.0, 5.0])
+        self.sim.set_soot_volume_fraction([0, 0.5 * self.sim.grid[-1]],
+                                          [1e-6, 1e-6])
+        self.sim.solve(loglevel=0, refine_grid=False)
+        self.assertLess(max(self.sim.T), Tmax - 1.0)
+
+        with self.assertRaises(ct.CanteraError):
+            self.sim.set_absorption_coeffs('H2', [300, 200], [1.0, 1.0])
+
     def test_strain_rate(self):
         # This doesn't test that the values are correct, just that they can be
         # computed without error
@@ -564,6 +564,75 @@ class TestReactor(utilities.CanteraTest):
         self.assertNear(T1a, T1b)
         self.assertNear(T2a, T2b)
 
+    def test_warm_restart(self):
+        # Operator-split style integration: restart the integrator for every
+        # short interval, with and without warm restarts
+        states = []
+        for warm in (False, True):
+            self.make_reactors(T1=1100, P1=ct.one_atm,
+                               X1='H2:2, O2:1, AR:4', n_reactors=1)
+            self.net.set_warm_restart(warm, 0.05, 10)
+            t = 0.0
+            for i in range(50):
+                self.net.set_initial_time(t)
+                t += 2e-5
+                self.net.advance(t)
+            states.append((self.r1.T, self.r1.thermo.Y))
+
+        self.assertGreater(states[0][0], 2000)
+        self.assertNear(states[0][0], states[1][0], 1e-6)
+        self.assertArrayNear(states[0][1], states[1][1], 1e-6, 1e-10)
+
+    def test_integrator_types(self):
+        states = []
+        for itype in ('CVODE', 'Rosenbrock', 'Extrapolation'):
+            self.make_reactors(T1=1100, P1=ct.one_atm,
+                               X1='H2:2, O2:1, AR:4', n_reactors=1)
+            self.net.set_integrator(itype)
+            t = 0.0
+            for i in range(20):
+                t += 5e-5
+                self.net.advance(t)
+            states.append((self.r1.T, self.r1.thermo.Y))
+
+        self.assertGreater(states[0][0], 2000)
+        for T, Y in states[1:]:
+            self.assertNear(states[0][0], T, 1e-6)
+            self.assertArrayNear(states[0][1], Y, 1e-5, 1e-10)
+
+        with self.assertRaises(ct.CanteraError):
+            self.net.set_integrator('RK45')
+
+    def test_threads(self):
+        # Independent networks integrated concurrently, with the GIL released
+        # by ReactorNet.advance, give the same results as serial integration
+        import threading
+
+        def run(T0, results, i):
+            gas = ct.Solution('h2o2.xml')
+            gas.TPX = T0, ct.one_atm, 'H2:2, O2:1, AR:4'
+            r = self.reactorClass(gas)
+            net = ct.ReactorNet([r])
+            for j in range(1, 11):
+                net.advance(1e-4 * j)
+            results[i] = r.T
+
+        temps = [1000, 1050, 1100, 1150]
+        serial = [None] * len(temps)
+        for i, T0 in enumerate(temps):
+            run(T0, serial, i)
+
+        parallel = [None] * len(temps)
+        threads = [threading.Thread(target=run, args=(T0, parallel, i))
+                   for i, T0 in enumerate(temps)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+
+        for i in range(len(temps)):
+            self.assertNear(serial[i], parallel[i], 1e-12)
+
     def test_unpicklable(self):
         self.make_reactors()
         import pickle
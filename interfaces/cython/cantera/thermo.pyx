@@ -339,9 +339,16 @@ cdef class ThermoPhase(_SolutionBase):
             and an estimate is formulated.
         :param loglevel:
             Set to a value > 0 to write diagnostic output.
+
+        The GIL is released while the equilibrium solver is running, so
+        different `ThermoPhase` objects can be equilibrated concurrently from
+        multiple threads.
             """
-        self.thermo.equilibrate(stringify(XY.upper()), stringify(solver), rtol,
-                                maxsteps, maxiter, estimate_equil, loglevel)
+        cdef string cxx_XY = stringify(XY.upper())
+        cdef string cxx_solver = stringify(solver)
+        with nogil:
+            self.thermo.equilibrate(cxx_XY, cxx_solver, rtol, maxsteps,
+                                    maxiter, estimate_equil, loglevel)
 
     ####### Composition, species, and elements ########
 
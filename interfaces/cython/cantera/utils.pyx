@@ -52,6 +52,38 @@ def make_deprecation_warnings_fatal():
 def suppress_thermo_warnings(pybool suppress=True):
     Cxx_suppress_thermo_warnings(suppress)
 
+def start_tracing():
+    """
+    Start recording tracing spans around expensive operations, such as
+    reaction rate, thermodynamic property and transport property updates and
+    the steps of the 1D solver. Use `write_trace` to export the spans.
+    """
+    CxxStartTracing()
+
+def stop_tracing():
+    """ Stop recording tracing spans. """
+    CxxStopTracing()
+
+def clear_trace():
+    """ Discard all recorded tracing spans. """
+    CxxClearTrace()
+
+def trace_event_count():
+    """ Number of tracing spans recorded by all threads. """
+    return CxxTraceEventCount()
+
+def set_trace_thread_name(name):
+    """ Set the name shown for the calling thread in exported traces. """
+    CxxSetTraceThreadName(stringify(name))
+
+def write_trace(filename):
+    """
+    Write the recorded tracing spans to *filename* in the Chrome trace event
+    format, which can be viewed with ``chrome://tracing`` or
+    https://ui.perfetto.dev.
+    """
+    CxxWriteTrace(stringify(filename))
+
 cdef Composition comp_map(X) except *:
     if isinstance(X, (str, unicode, bytes)):
         return parseCompString(stringify(X))
@@ -69,3 +101,36 @@ class CanteraError(RuntimeError):
     pass
 
 cdef public PyObject* pyCanteraError = <PyObject*>CanteraError
+
+cdef class _ArrayView:
+    """
+    Exposes memory owned by a C++ object to NumPy through the array interface
+    protocol. The view holds a reference to *owner*, the Python wrapper of the
+    C++ object, so the memory is not deallocated while the array exists. If
+    the C++ object needs to reallocate the memory, the owner is replaced by an
+    `_ArrayBuffer` which takes over the memory (see `Sim1D._detach_views`).
+    """
+    property __array_interface__:
+        def __get__(self):
+            return self.interface
+
+cdef class _ArrayBuffer:
+    """
+    Owns memory which was detached from a C++ object while arrays created by
+    `array_view` still referred to it.
+    """
+    pass
+
+cdef np.ndarray array_view(object owner, double* data, size_t n, cbool writable):
+    """
+    Create a one-dimensional NumPy array of length *n* which shares the memory
+    starting at *data*. The array is read-only unless *writable* is True.
+    """
+    if n == 0:
+        return np.empty(0)
+    cdef _ArrayView view = _ArrayView()
+    view.owner = owner
+    view.interface = {'version': 3, 'shape': (n,),
+                      'typestr': np.dtype(np.double).str,
+                      'data': (<size_t>data, not writable)}
+    return np.asarray(view)
@@ -0,0 +1,347 @@
+/*!
+ * @file kernel_perf.cpp
+ *
+ * Microbenchmarks for the per-state kinetics, thermodynamic and transport
+ * property kernels. Each kernel is evaluated for a fixed set of randomized
+ * gas states using mechanisms of increasing size. The cost is reported in
+ * nanoseconds per state, and relative to the cost of a fixed reference
+ * workload timed in the same run. Run without arguments to list the
+ * available kernels.
+ *
+ *     kernel_perf --case <name> [--output <file>] [--min-time <seconds>]
+ *
+ * Property caches are keyed on the state, so every kernel first sets the
+ * state of the phase. The kernels which take a full state therefore include
+ * the cost of `setState_TPY`, which is reported as a separate kernel.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/IdealGasMix.h"
+#include "cantera/transport.h"
+#include "cantera/equil/ChemEquil.h"
+#include "cantera/base/stringUtils.h"
+#include "perf_utils.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+using namespace Cantera;
+
+namespace {
+
+//! Number of randomized states evaluated by each kernel
+const size_t nStates = 200;
+
+//! Seed for the random states, so that all runs use the same states
+const unsigned int stateSeed = 20170901;
+
+//! Minimum total time [s] spent evaluating each kernel for each mechanism
+double minTime = 0.5;
+
+//! A gas mechanism together with the transport managers and a set of
+//! randomized states at which the kernels are evaluated
+struct KernelContext
+{
+    KernelContext(const std::string& mech, const std::string& id) :
+        gas(mech, id)
+    {
+        size_t nsp = gas.nSpecies();
+        wdot.resize(nsp);
+        work.resize(nsp * nsp);
+
+        std::mt19937 rng(stateSeed);
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        T.resize(nStates);
+        P.resize(nStates);
+        Y.resize(nStates * nsp);
+        h.resize(nStates);
+        for (size_t i = 0; i < nStates; i++) {
+            T[i] = 800.0 + 1700.0 * unit(rng);
+            P[i] = OneAtm * (0.5 + 9.5 * unit(rng));
+            double* y = &Y[i * nsp];
+            for (size_t k = 0; k < nsp; k++) {
+                y[k] = unit(rng);
+            }
+            // Specific enthalpy of the same composition at a higher
+            // temperature, used as the target for setState_HP
+            gas.setState_TPY(T[i] + 200.0, P[i], y);
+            h[i] = gas.enthalpy_mass();
+            gas.getMassFractions(y);
+        }
+    }
+
+    //! Set the gas to the state with index `i`
+    void setState(size_t i) {
+        gas.setState_TPY(T[i], P[i], &Y[i * gas.nSpecies()]);
+    }
+
+    Transport& mixTransport() {
+        if (!mix) {
+            mix.reset(newTransportMgr("Mix", &gas));
+        }
+        return *mix;
+    }
+
+    Transport& multiTransport() {
+        if (!multi) {
+            multi.reset(newTransportMgr("Multi", &gas));
+        }
+        return *multi;
+    }
+
+    IdealGasMix gas;
+    std::unique_ptr<Transport> mix, multi;
+    ChemEquil equil;
+    vector_fp T, P, Y, h;
+    vector_fp wdot, work;
+};
+
+typedef void (*Kernel)(KernelContext&, size_t);
+
+void netProductionRates(KernelContext& c, size_t i)
+{
+    c.setState(i);
+    c.gas.getNetProductionRates(c.wdot.data());
+}
+
+void updateROP(KernelContext& c, size_t i)
+{
+    c.setState(i);
+    c.gas.updateROP();
+}
+
+//! Reference-state thermodynamic properties (IdealGasPhase::_updateThermo).
+//! Only the temperature is changed, which is sufficient to invalidate the
+//! cached values.
+void updateThermo(KernelContext& c, size_t i)
+{
+    c.gas.setTemperature(c.T[i]);
+    c.gas.getEnthalpy_RT(c.wdot.data());
+}
+
+void setStateTPY(KernelContext& c, size_t i)
+{
+    c.setState(i);
+}
+
+void setStateHP(KernelContext& c, size_t i)
+{
+    c.setState(i);
+    c.gas.setState_HP(c.h[i], c.P[i]);
+}
+
+void mixViscosity(KernelContext& c, size_t i)
+{
+    Transport& tr = c.mixTransport();
+    c.setState(i);
+    tr.viscosity();
+}
+
+void mixThermalConductivity(KernelContext& c, size_t i)
+{
+    Transport& tr = c.mixTransport();
+    c.setState(i);
+    tr.thermalConductivity();
+}
+
+void mixDiffCoeffs(KernelContext& c, size_t i)
+{
+    Transport& tr = c.mixTransport();
+    c.setState(i);
+    tr.getMixDiffCoeffs(c.wdot.data());
+}
+
+void multiDiffCoeffs(KernelContext& c, size_t i)
+{
+    Transport& tr = c.multiTransport();
+    c.setState(i);
+    tr.getMultiDiffCoeffs(c.gas.nSpecies(), c.work.data());
+}
+
+void equilibrateTP(KernelContext& c, size_t i)
+{
+    c.setState(i);
+    c.equil.equilibrate(c.gas, "TP");
+}
+
+const std::vector<std::pair<std::string, Kernel>> kernels {
+    {"net-production-rates", netProductionRates},
+    {"update-rop", updateROP},
+    {"update-thermo", updateThermo},
+    {"setState-TPY", setStateTPY},
+    {"setState-HP", setStateHP},
+    {"mix-viscosity", mixViscosity},
+    {"mix-thermal-conductivity", mixThermalConductivity},
+    {"mix-diff-coeffs", mixDiffCoeffs},
+    {"multi-diff-coeffs", multiDiffCoeffs},
+    {"equilibrate-TP", equilibrateTP},
+};
+
+struct Mechanism
+{
+    std::string label, file, id;
+};
+
+//! Mechanisms of increasing size. The large mechanism is not distributed with
+//! Cantera, and is only used if the environment variable
+//! CANTERA_PERF_LARGE_MECH is set (with an optional phase id in
+//! CANTERA_PERF_LARGE_PHASE).
+std::vector<Mechanism> mechanisms()
+{
+    std::vector<Mechanism> mechs {
+        {"h2o2", "h2o2.xml", "ohmech"},
+        {"gri30", "gri30.xml", "gri30"},
+    };
+    const char* large = getenv("CANTERA_PERF_LARGE_MECH");
+    if (large) {
+        const char* id = getenv("CANTERA_PERF_LARGE_PHASE");
+        mechs.push_back({"large", large, id ? id : ""});
+    }
+    return mechs;
+}
+
+//! Time `kernel(i)` for all state indices `i`, repeating full passes over
+//! the states until at least `minTime` has elapsed. Returns the cost [ns] of
+//! a single evaluation in the fastest pass, which is less affected by other
+//! processes running on the machine than the mean.
+template <class F>
+double timeKernel(F kernel)
+{
+    // Untimed pass to initialize lazily-constructed objects and caches
+    for (size_t i = 0; i < nStates; i++) {
+        kernel(i);
+    }
+    PerfTimer timer;
+    double elapsed = 0.0;
+    double fastest = BigNumber;
+    do {
+        double start = timer.elapsed();
+        for (size_t i = 0; i < nStates; i++) {
+            kernel(i);
+        }
+        elapsed = timer.elapsed();
+        fastest = std::min(fastest, elapsed - start);
+    } while (elapsed < minTime);
+    return 1e9 * fastest / nStates;
+}
+
+//! Cost [ns] of a fixed workload which does not use Cantera: evaluating 500
+//! modified Arrhenius expressions at a temperature. The costs of the kernels
+//! divided by this cost depend much less on the machine than the costs
+//! themselves.
+double referenceCost()
+{
+    const size_t n = 500;
+    std::mt19937 rng(stateSeed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    vector_fp logA(n), b(n), Ta(n), k(n), T(nStates);
+    for (size_t i = 0; i < n; i++) {
+        logA[i] = 20.0 + 10.0 * unit(rng);
+        b[i] = 2.0 * unit(rng) - 1.0;
+        Ta[i] = 20000.0 * unit(rng);
+    }
+    for (size_t i = 0; i < nStates; i++) {
+        T[i] = 800.0 + 1700.0 * unit(rng);
+    }
+    double sum = 0.0;
+    double cost = timeKernel([&](size_t i) {
+        double logT = std::log(T[i]);
+        double recipT = 1.0 / T[i];
+        for (size_t j = 0; j < n; j++) {
+            k[j] = std::exp(logA[j] + b[j] * logT - Ta[j] * recipT);
+        }
+        sum += k[i % n];
+    });
+    // Keep the compiler from discarding the loop
+    if (sum < 0.0) {
+        fmt::print("{}\n", sum);
+    }
+    return cost;
+}
+
+//! Evaluate `kernel` for each mechanism. The cost of each mechanism is also
+//! reported relative to the reference workload ('relative_cost') and to the
+//! smallest mechanism ('cost_ratio'). If there are at least three
+//! mechanisms, the exponent `a` in `cost = b * nSpecies^a` is fitted using
+//! least squares in log-log space.
+void runKernel(Kernel kernel, PerfRecord& rec)
+{
+    vector_fp logK, logCost;
+    double refMin = BigNumber;
+    for (const auto& mech : mechanisms()) {
+        KernelContext c(mech.file, mech.id);
+        // The reference workload is timed just before and after the kernel,
+        // so that both see the same load on the machine
+        double ref = referenceCost();
+        double cost = timeKernel([&](size_t i) { kernel(c, i); });
+        ref = std::min(ref, referenceCost());
+        refMin = std::min(refMin, ref);
+        rec.set(mech.label + ".ns_per_state", cost);
+        rec.set(mech.label + ".relative_cost", cost / ref);
+        if (!logCost.empty()) {
+            rec.set(mech.label + ".cost_ratio", cost / exp(logCost[0]));
+        }
+        rec.set(mech.label + ".n_species", c.gas.nSpecies());
+        rec.set(mech.label + ".n_reactions", c.gas.nReactions());
+        logK.push_back(log(c.gas.nSpecies()));
+        logCost.push_back(log(cost));
+    }
+    rec.set("reference.ns_per_state", refMin);
+
+    size_t n = logK.size();
+    if (n < 3) {
+        return;
+    }
+    double sx = 0, sy = 0, sxx = 0, sxy = 0;
+    for (size_t i = 0; i < n; i++) {
+        sx += logK[i];
+        sy += logCost[i];
+        sxx += logK[i] * logK[i];
+        sxy += logK[i] * logCost[i];
+    }
+    rec.set("scaling_exponent", (n * sxy - sx * sy) / (n * sxx - sx * sx));
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    std::string name, output;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--case") == 0 && i + 1 < argc) {
+            name = argv[++i];
+        } else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            minTime = fpValueCheck(argv[++i]);
+        }
+    }
+
+    if (name.empty()) {
+        for (const auto& k : kernels) {
+            fmt::print("{}\n", k.first);
+        }
+        return 0;
+    }
+
+    for (const auto& k : kernels) {
+        if (k.first != name) {
+            continue;
+        }
+        PerfRecord rec(name);
+        try {
+            runKernel(k.second, rec);
+        } catch (CanteraError& err) {
+            rec.fail(err.getMessage());
+        }
+        rec.write(output);
+        appdelete();
+        return (rec.status() == "failed") ? 1 : 0;
+    }
+    fmt::print("Unknown kernel '{}'\n", name);
+    return 2;
+}
@@ -0,0 +1,144 @@
+//! @file perf_utils.h Utilities shared by the performance benchmark programs
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_PERF_UTILS_H
+#define CT_PERF_UTILS_H
+
+#include "cantera/base/ct_defs.h"
+#include "cantera/base/global.h"
+
+#include <chrono>
+#include <map>
+#include <fstream>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+namespace Cantera
+{
+
+//! Wall-clock stopwatch used to time benchmark cases
+class PerfTimer
+{
+public:
+    PerfTimer() {
+        restart();
+    }
+
+    void restart() {
+        m_start = std::chrono::steady_clock::now();
+    }
+
+    //! Elapsed wall-clock time [s] since construction or the last restart()
+    double elapsed() const {
+        std::chrono::duration<double> dt = std::chrono::steady_clock::now() - m_start;
+        return dt.count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point m_start;
+};
+
+//! Peak resident set size of the current process [bytes]. Returns 0 on
+//! platforms where this information is not available.
+inline double peakMemory()
+{
+#ifdef _WIN32
+    return 0.0;
+#else
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return static_cast<double>(usage.ru_maxrss); // reported in bytes
+#else
+    return 1024.0 * usage.ru_maxrss; // reported in kilobytes
+#endif
+#endif
+}
+
+//! Metrics collected for a single benchmark case. The record is written as a
+//! flat JSON object so that it can be compared against the stored baseline by
+//! the SCons `perf` target.
+class PerfRecord
+{
+public:
+    explicit PerfRecord(const std::string& name) :
+        m_name(name), m_status("ok") {}
+
+    //! Set the value of the metric `key`
+    void set(const std::string& key, double value) {
+        m_values[key] = value;
+    }
+
+    //! Add `value` to the metric `key`
+    void add(const std::string& key, double value) {
+        m_values[key] += value;
+    }
+
+    //! Mark the case as skipped, e.g. because required input is not available
+    void skip(const std::string& reason) {
+        m_status = "skipped";
+        m_reason = reason;
+    }
+
+    //! Mark the case as failed
+    void fail(const std::string& reason) {
+        m_status = "failed";
+        m_reason = reason;
+    }
+
+    const std::string& status() const {
+        return m_status;
+    }
+
+    std::string toJSON() const {
+        std::string out = fmt::format("{{\n  \"case\": \"{}\",\n"
+                                      "  \"status\": \"{}\"", m_name, m_status);
+        if (!m_reason.empty()) {
+            out += fmt::format(",\n  \"reason\": \"{}\"", escape(m_reason));
+        }
+        for (const auto& item : m_values) {
+            out += fmt::format(",\n  \"{}\": {:.10g}", item.first, item.second);
+        }
+        out += "\n}\n";
+        return out;
+    }
+
+    //! Write the record to `fname`, or to the screen if `fname` is empty
+    void write(const std::string& fname) const {
+        if (fname.empty()) {
+            writelog(toJSON());
+        } else {
+            std::ofstream out(fname);
+            out << toJSON();
+        }
+    }
+
+private:
+    static std::string escape(const std::string& s) {
+        std::string out;
+        for (char c : s) {
+            if (c == '"' || c == '\\') {
+                out += '\\';
+                out += c;
+            } else if (c == '\n') {
+                out += "\\n";
+            } else {
+                out += c;
+            }
+        }
+        return out;
+    }
+
+    std::string m_name;
+    std::string m_status;
+    std::string m_reason;
+    std::map<std::string, double> m_values;
+};
+
+}
+
+#endif
@@ -0,0 +1,525 @@
+/*!
+ * @file solver_perf.cpp
+ *
+ * End-to-end solver performance cases. Each case sets up a fixed,
+ * deterministic problem, solves it, and reports the wall time, solver work
+ * counters and peak memory as a JSON record. If Cantera was compiled with
+ * `track_allocations=y`, the number of heap allocations made in each phase
+ * of the 1D solver is also reported. Run without arguments to list
+ * the available cases.
+ *
+ *     solver_perf --case <name> [--output <file>]
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/oneD/Sim1D.h"
+#include "cantera/oneD/Inlet1D.h"
+#include "cantera/oneD/StFlow.h"
+#include "cantera/oneD/MultiNewton.h"
+#include "cantera/IdealGasMix.h"
+#include "cantera/Interface.h"
+#include "cantera/transport.h"
+#include "cantera/zerodim.h"
+#include "cantera/base/AllocationCounter.h"
+#include "perf_utils.h"
+
+#include <cstdlib>
+#include <cstring>
+
+using namespace Cantera;
+
+namespace {
+
+//! Accumulate the 1D solver statistics of `sim` into `rec`
+void recordOneDimStats(Sim1D& sim, PerfRecord& rec)
+{
+    const vector_int& nfunc = sim.evalCountStats();
+    const vector_int& njac = sim.jacobianCountStats();
+    const vector_int& nsteps = sim.timeStepStats();
+    for (size_t i = 0; i < nfunc.size(); i++) {
+        rec.add("residual_evals", nfunc[i]);
+        rec.add("jacobian_evals", njac[i]);
+        rec.add("time_steps", nsteps[i]);
+    }
+    rec.add("newton_iterations", sim.newton().nIterations());
+}
+
+//! Accumulate the integrator statistics of `net` into `rec`
+void recordReactorStats(ReactorNet& net, PerfRecord& rec)
+{
+    Integrator& integ = net.integrator();
+    rec.set("residual_evals", integ.nEvals());
+    rec.set("jacobian_evals", integ.nJacEvals());
+    rec.set("newton_iterations", integ.nNonlinIters());
+    rec.set("time_steps", integ.nSteps());
+}
+
+vector_fp uniformGrid(size_t n, double width)
+{
+    vector_fp z(n);
+    for (size_t i = 0; i < n; i++) {
+        z[i] = width * i / (n - 1.0);
+    }
+    return z;
+}
+
+//! Freely-propagating, stoichiometric methane/air flame (GRI 3.0)
+void freeFlame(PerfRecord& rec)
+{
+    IdealGasMix gas("gri30.xml", "gri30_mix");
+    double T_in = 300.0;
+    gas.setState_TPX(T_in, OneAtm, "CH4:1.0, O2:2.0, N2:7.52");
+    size_t nsp = gas.nSpecies();
+    double rho_in = gas.density();
+    vector_fp y_in(nsp), y_out(nsp);
+    gas.getMassFractions(y_in.data());
+    gas.equilibrate("HP");
+    gas.getMassFractions(y_out.data());
+    double T_ad = gas.temperature();
+    double rho_out = gas.density();
+
+    FreeFlame flow(&gas);
+    vector_fp z = uniformGrid(6, 0.1);
+    flow.setupGrid(z.size(), z.data());
+    std::unique_ptr<Transport> tr(newTransportMgr("Mix", &gas));
+    flow.setTransport(*tr);
+    flow.setKinetics(gas);
+    flow.setPressure(OneAtm);
+
+    double u_in = 0.3;
+    Inlet1D inlet;
+    inlet.setMoleFractions("CH4:1.0, O2:2.0, N2:7.52");
+    inlet.setMdot(u_in * rho_in);
+    inlet.setTemperature(T_in);
+    Outlet1D outlet;
+
+    std::vector<Domain1D*> domains { &inlet, &flow, &outlet };
+    Sim1D flame(domains);
+    vector_fp locs{0.0, 0.3, 0.7, 1.0};
+    vector_fp value{u_in, u_in, u_in*rho_in/rho_out, u_in*rho_in/rho_out};
+    flame.setInitialGuess("u", locs, value);
+    value = {T_in, T_in, T_ad, T_ad};
+    flame.setInitialGuess("T", locs, value);
+    for (size_t k = 0; k < nsp; k++) {
+        value = {y_in[k], y_in[k], y_out[k], y_out[k]};
+        flame.setInitialGuess(gas.speciesName(k), locs, value);
+    }
+    flame.setRefineCriteria(1, 10.0, 0.1, 0.2);
+    flame.setFixedTemperature(0.5 * (T_in + T_ad));
+    flow.solveEnergyEqn();
+
+    PerfTimer timer;
+    flame.solve(0, true);
+    rec.set("wall_time", timer.elapsed());
+    recordOneDimStats(flame, rec);
+    rec.set("grid_points", flow.nPoints());
+    rec.set("flame_speed", flame.value(1, flow.componentIndex("u"), 0));
+}
+
+//! Counterflow methane/air diffusion flame (GRI 3.0)
+void counterflowDiffusion(PerfRecord& rec)
+{
+    IdealGasMix gas("gri30.xml", "gri30_mix");
+    size_t nsp = gas.nSpecies();
+    double T_in = 300.0;
+    double mdot_f = 0.24;
+    double mdot_o = 0.72;
+    double width = 0.02;
+
+    gas.setState_TPX(T_in, OneAtm, "CH4:1.0");
+    double u_f = mdot_f / gas.density();
+    vector_fp y_f(nsp);
+    gas.getMassFractions(y_f.data());
+    gas.setState_TPX(T_in, OneAtm, "O2:0.21, N2:0.78, AR:0.01");
+    double u_o = mdot_o / gas.density();
+    vector_fp y_o(nsp);
+    gas.getMassFractions(y_o.data());
+
+    AxiStagnFlow flow(&gas);
+    vector_fp z = uniformGrid(24, width);
+    flow.setupGrid(z.size(), z.data());
+    std::unique_ptr<Transport> tr(newTransportMgr("Mix", &gas));
+    flow.setTransport(*tr);
+    flow.setKinetics(gas);
+    flow.setPressure(OneAtm);
+
+    // The initial guess assumes infinitely fast chemistry, with the
+    // equilibrium composition at the stoichiometric mixture fraction and an
+    // error function profile of the mixture fraction around the stagnation
+    // point, as in the Python CounterflowDiffusionFlame class
+    double Z_st = 0.055;
+    vector_fp y_st(nsp);
+    for (size_t k = 0; k < nsp; k++) {
+        y_st[k] = Z_st * y_f[k] + (1.0 - Z_st) * y_o[k];
+    }
+    gas.setState_TPY(T_in, OneAtm, y_st.data());
+    gas.equilibrate("HP");
+    gas.getMassFractions(y_st.data());
+    double T_ad = gas.temperature();
+    vector_fp D(nsp);
+    tr->getMixDiffCoeffs(D.data());
+    double a = (u_o + u_f) / width;
+    double f = sqrt(a / (2.0 * D[gas.speciesIndex("O2")]));
+    double z0 = sqrt(mdot_f * u_f) * width /
+                (sqrt(mdot_f * u_f) + sqrt(mdot_o * u_o));
+
+    vector_fp zrel(z.size()), T(z.size());
+    Array2D Y(z.size(), nsp);
+    for (size_t j = 0; j < z.size(); j++) {
+        zrel[j] = z[j] / width;
+        double Z = 0.5 * (1.0 - std::erf(f * (z[j] - z0)));
+        if (Z > Z_st) {
+            double w = (Z - Z_st) / (1.0 - Z_st);
+            T[j] = T_ad + (T_in - T_ad) * w;
+            for (size_t k = 0; k < nsp; k++) {
+                Y(j,k) = y_st[k] + (y_f[k] - y_st[k]) * w;
+            }
+        } else {
+            double w = Z / Z_st;
+            T[j] = T_in + (T_ad - T_in) * w;
+            for (size_t k = 0; k < nsp; k++) {
+                Y(j,k) = y_o[k] + (y_st[k] - y_o[k]) * w;
+            }
+        }
+    }
+    T.front() = T.back() = T_in;
+
+    Inlet1D fuel, oxidizer;
+    fuel.setMoleFractions("CH4:1.0");
+    fuel.setMdot(mdot_f);
+    fuel.setTemperature(T_in);
+    oxidizer.setMoleFractions("O2:0.21, N2:0.78, AR:0.01");
+    oxidizer.setMdot(mdot_o);
+    oxidizer.setTemperature(T_in);
+
+    std::vector<Domain1D*> domains { &fuel, &flow, &oxidizer };
+    Sim1D flame(domains);
+    vector_fp locs{0.0, 1.0};
+    vector_fp value{u_f, -u_o};
+    flame.setInitialGuess("u", locs, value);
+    locs = {0.0, z0 / width, 1.0};
+    value = {0.0, a, 0.0};
+    flame.setInitialGuess("V", locs, value);
+    flame.setInitialGuess("T", zrel, T);
+    for (size_t k = 0; k < nsp; k++) {
+        value.assign(&Y(0,k), &Y(0,k) + z.size());
+        flame.setInitialGuess(gas.speciesName(k), zrel, value);
+    }
+    flame.setRefineCriteria(1, 10.0, 0.2, 0.3, 0.05);
+    flow.solveEnergyEqn();
+
+    // Converge on the initial grid before refining it
+    PerfTimer timer;
+    flame.solve(0, false);
+    flame.solve(0, true);
+    rec.set("wall_time", timer.elapsed());
+    recordOneDimStats(flame, rec);
+    rec.set("grid_points", flow.nPoints());
+    double T_max = 0.0;
+    for (size_t j = 0; j < flow.nPoints(); j++) {
+        T_max = std::max(T_max, flame.value(1, flow.componentIndex("T"), j));
+    }
+    rec.set("T_max", T_max);
+    if (T_max < T_in + 500.0) {
+        rec.fail(fmt::format("Flame is extinct (T_max = {} K)", T_max));
+    }
+}
+
+//! Water spray evaporating in a counterflow of cold and hot air. The gas and
+//! liquid phases are advanced alternately with a fixed number of coupling
+//! iterations, followed by a steady-state solve of the gas phase. The liquid
+//! phase is not solved for steady state, since its equations are singular
+//! where the droplets have evaporated completely. The case fails if the
+//! droplets do not evaporate.
+void sprayCounterflow(PerfRecord& rec)
+{
+    IdealGasMix gas("gri30.xml", "gri30_mix");
+    size_t nsp = gas.nSpecies();
+    double T_cold = 300.0;
+    double T_hot = 1200.0;
+    double mdot_l = 0.5;
+    double mdot_r = 0.5;
+    double width = 0.02;
+    std::string air = "O2:0.21, N2:0.79";
+
+    gas.setState_TPX(T_cold, OneAtm, air);
+    double rho_l = gas.density();
+    vector_fp y_air(nsp);
+    gas.getMassFractions(y_air.data());
+    gas.setState_TPX(T_hot, OneAtm, air);
+    double rho_r = gas.density();
+
+    vector_fp z = uniformGrid(21, width);
+    SprayGas flow(&gas);
+    flow.setupGrid(z.size(), z.data());
+    std::unique_ptr<Transport> tr(newTransportMgr("Mix", &gas));
+    flow.setTransport(*tr);
+    flow.setKinetics(gas);
+    flow.setPressure(OneAtm);
+    flow.updateFuelSpecies("H2O");
+
+    Inlet1D left, right;
+    left.setMoleFractions(air);
+    left.setMdot(mdot_l);
+    left.setTemperature(T_cold);
+    right.setMoleFractions(air);
+    right.setMdot(mdot_r);
+    right.setTemperature(T_hot);
+
+    SprayLiquid liquid;
+    liquid.setupGrid(z.size(), z.data());
+    SprayInlet1D spray_in;
+    SprayOutlet1D spray_out;
+
+    flow.setLiquidDomain(&liquid);
+    liquid.setGasDomain(&flow);
+    liquid.setAVCoefficients({1e-6, 1e-6, 1e-6, 1e-6, 1e-6});
+
+    std::vector<Domain1D*> gas_domains { &left, &flow, &right };
+    std::vector<Domain1D*> liq_domains { &spray_in, &liquid, &spray_out };
+    Sim1D gas_sim(gas_domains);
+    Sim1D liq_sim(liq_domains);
+
+    double u_l = mdot_l / rho_l;
+    double droplet_diameter = 20e-6;
+    double rho_water = 1000.0;
+    spray_in.setDropletInjectionVel(u_l);
+    spray_in.setDropletSpreadVel(0.0);
+    spray_in.setDropletTemperature(T_cold);
+    spray_in.setDropletMass(Pi / 6.0 * rho_water * pow(droplet_diameter, 3));
+    spray_in.setNumberDensity(1e9);
+
+    vector_fp locs{0.0, 1.0};
+    vector_fp value{u_l, -mdot_r / rho_r};
+    gas_sim.setInitialGuess("u", locs, value);
+    value = {T_cold, T_hot};
+    gas_sim.setInitialGuess("T", locs, value);
+    for (size_t k = 0; k < nsp; k++) {
+        value = {y_air[k], y_air[k]};
+        gas_sim.setInitialGuess(gas.speciesName(k), locs, value);
+    }
+    value = {u_l, u_l};
+    liq_sim.setInitialGuess("vl", locs, value);
+    value = {T_cold, T_cold};
+    liq_sim.setInitialGuess("Tl", locs, value);
+    value = {1.0, 1.0};
+    liq_sim.setInitialGuess("ml", locs, value);
+    liq_sim.setInitialGuess("nl", locs, value);
+    flow.solveEnergyEqn();
+
+    PerfTimer timer;
+    double dt_gas = 1e-5;
+    double dt_liq = 1e-5;
+    for (int iter = 0; iter < 20; iter++) {
+        dt_liq = liq_sim.take_step(0, 5, dt_liq);
+        dt_gas = gas_sim.take_step(0, 5, dt_gas);
+    }
+    // Sim1D::solve discards the time steps which have not been recorded yet
+    gas_sim.saveStats();
+    gas_sim.solve(0, false);
+    rec.set("wall_time", timer.elapsed());
+    recordOneDimStats(gas_sim, rec);
+    recordOneDimStats(liq_sim, rec);
+    rec.set("grid_points", flow.nPoints());
+
+    // Highest temperature of the droplets, before they have evaporated
+    // completely. The droplet mass is scaled by the injected mass.
+    double T_liq_max = 0.0;
+    double ml_min = 1.0;
+    for (size_t j = 0; j < liquid.nPoints(); j++) {
+        double ml = liq_sim.value(1, liquid.componentIndex("ml"), j);
+        if (ml > 0.01) {
+            T_liq_max = std::max(T_liq_max,
+                liq_sim.value(1, liquid.componentIndex("Tl"), j));
+        }
+        ml_min = std::min(ml_min, ml);
+    }
+    rec.set("T_liquid_max", T_liq_max);
+    if (ml_min > 0.5) {
+        rec.fail(fmt::format("Droplets did not evaporate (minimum scaled "
+                             "droplet mass {})", ml_min));
+    }
+}
+
+//! Constant-pressure ignition of a stoichiometric mixture. Integration stops
+//! once the temperature has risen by 400 K. The case fails if that does not
+//! happen within 1 s of simulated time or 100000 time steps.
+void ignition(PerfRecord& rec, const std::string& mech, const std::string& id,
+              const std::string& mixture, double T0)
+{
+    IdealGasMix gas(mech, id);
+    gas.setState_TPX(T0, OneAtm, mixture);
+    IdealGasConstPressureReactor reactor;
+    reactor.insert(gas);
+    ReactorNet net;
+    net.addReactor(reactor);
+    // The step and Jacobian counts of CVODES differ between the supported
+    // Sundials versions, so the in-tree integrator is used to make them
+    // reproducible
+    net.setIntegrator("Rosenbrock");
+    net.setTolerances(1e-9, 1e-15);
+
+    const double t_max = 1.0;
+    const int max_steps = 100000;
+    PerfTimer timer;
+    int nsteps = 0;
+    while (reactor.temperature() < T0 + 400.0 && net.time() < t_max
+           && nsteps < max_steps) {
+        net.step();
+        nsteps++;
+    }
+    rec.set("wall_time", timer.elapsed());
+    recordReactorStats(net, rec);
+    if (reactor.temperature() < T0 + 400.0) {
+        rec.fail(fmt::format("No ignition after {} steps (t = {} s, T = {} K)",
+                             nsteps, net.time(), reactor.temperature()));
+        return;
+    }
+    rec.set("ignition_delay", net.time());
+}
+
+void ignitionGri30(PerfRecord& rec)
+{
+    ignition(rec, "gri30.xml", "gri30", "CH4:1.0, O2:2.0, N2:7.52", 1200.0);
+}
+
+//! Ignition using a large mechanism which is not distributed with Cantera.
+//! The input file is taken from the environment variable
+//! CANTERA_PERF_LARGE_MECH (with an optional phase id in
+//! CANTERA_PERF_LARGE_PHASE) and the initial composition from
+//! CANTERA_PERF_LARGE_MIX.
+void ignitionLarge(PerfRecord& rec)
+{
+    const char* mech = getenv("CANTERA_PERF_LARGE_MECH");
+    if (!mech) {
+        rec.skip("CANTERA_PERF_LARGE_MECH is not set");
+        return;
+    }
+    const char* id = getenv("CANTERA_PERF_LARGE_PHASE");
+    const char* mix = getenv("CANTERA_PERF_LARGE_MIX");
+    ignition(rec, mech, id ? id : "", mix ? mix : "nc7h16:1, o2:11, n2:41.36",
+             1000.0);
+}
+
+//! Catalytic combustion of methane in a stagnation flow over a platinum
+//! surface, with the surface coverages solved as part of the 1D problem
+void surfaceStagnation(PerfRecord& rec)
+{
+    IdealGasMix gas("ptcombust.cti", "gas");
+    Interface surf("ptcombust.cti", "Pt_surf", {&gas});
+    size_t nsp = gas.nSpecies();
+    double p = 0.05 * OneAtm;
+    double T_in = 300.0;
+    double T_surf = 900.0;
+    double mdot = 0.06;
+    std::string comp = "CH4:0.095, O2:0.21, AR:0.79";
+
+    gas.setState_TPX(T_in, p, comp);
+    vector_fp y_in(nsp);
+    gas.getMassFractions(y_in.data());
+    double rho_in = gas.density();
+
+    // Integrate the coverage equations in time to a converged initial state
+    surf.setState_TP(T_surf, p);
+    surf.advanceCoverages(1.0);
+
+    AxiStagnFlow flow(&gas);
+    vector_fp z = uniformGrid(11, 0.1);
+    flow.setupGrid(z.size(), z.data());
+    std::unique_ptr<Transport> tr(newTransportMgr("Mix", &gas));
+    flow.setTransport(*tr);
+    flow.setKinetics(gas);
+    flow.setPressure(p);
+
+    Inlet1D inlet;
+    inlet.setMoleFractions(comp);
+    inlet.setMdot(mdot);
+    inlet.setTemperature(T_in);
+    ReactingSurf1D surface;
+    surface.setKineticsMgr(&surf);
+    surface.enableCoverageEquations(true);
+    surface.setTemperature(T_surf);
+
+    std::vector<Domain1D*> domains { &inlet, &flow, &surface };
+    Sim1D sim(domains);
+    vector_fp locs{0.0, 1.0};
+    vector_fp value{mdot/rho_in, 0.0};
+    sim.setInitialGuess("u", locs, value);
+    value = {T_in, T_surf};
+    sim.setInitialGuess("T", locs, value);
+    for (size_t k = 0; k < nsp; k++) {
+        value = {y_in[k], y_in[k]};
+        sim.setInitialGuess(gas.speciesName(k), locs, value);
+    }
+    sim.setRefineCriteria(1, 10.0, 0.2, 0.2);
+    flow.solveEnergyEqn();
+
+    PerfTimer timer;
+    sim.solve(0, true);
+    rec.set("wall_time", timer.elapsed());
+    recordOneDimStats(sim, rec);
+    rec.set("grid_points", flow.nPoints());
+    rec.set("Y_CH4_surface", sim.value(1, flow.componentIndex("CH4"),
+                                       flow.nPoints() - 1));
+}
+
+typedef void (*PerfCase)(PerfRecord&);
+
+const std::vector<std::pair<std::string, PerfCase>> perfCases {
+    {"free-flame", freeFlame},
+    {"counterflow-diffusion", counterflowDiffusion},
+    {"spray-counterflow", sprayCounterflow},
+    {"ignition-gri30", ignitionGri30},
+    {"ignition-large", ignitionLarge},
+    {"surface-stagnation", surfaceStagnation},
+};
+
+}
+
+int main(int argc, char** argv)
+{
+    std::string name, output;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--case") == 0 && i + 1 < argc) {
+            name = argv[++i];
+        } else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        }
+    }
+
+    if (name.empty()) {
+        for (const auto& c : perfCases) {
+            fmt::print("{}\n", c.first);
+        }
+        return 0;
+    }
+
+    for (const auto& c : perfCases) {
+        if (c.first != name) {
+            continue;
+        }
+        PerfRecord rec(name);
+        resetAllocationCounts();
+        try {
+            c.second(rec);
+        } catch (CanteraError& err) {
+            rec.fail(err.getMessage());
+        }
+        rec.set("peak_memory", peakMemory());
+        if (allocationTrackingEnabled()) {
+            for (int i = 0; i < static_cast<int>(SolverPhase::nPhases); i++) {
+                SolverPhase phase = static_cast<SolverPhase>(i);
+                rec.set(fmt::format("{}.heap_allocations",
+                                    solverPhaseName(phase)),
+                        allocationCount(phase));
+            }
+        }
+        rec.write(output);
+        appdelete();
+        return (rec.status() == "failed") ? 1 : 0;
+    }
+    fmt::print("Unknown case '{}'\n", name);
+    return 2;
+}
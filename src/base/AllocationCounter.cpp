@@ -0,0 +1,154 @@
+//! @file AllocationCounter.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/AllocationCounter.h"
+
+#if CT_TRACK_ALLOCATIONS
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#endif
+
+namespace Cantera
+{
+
+const char* solverPhaseName(SolverPhase phase)
+{
+    switch (phase) {
+    case SolverPhase::None:
+        return "none";
+    case SolverPhase::Newton:
+        return "newton";
+    case SolverPhase::TimeStep:
+        return "time_step";
+    case SolverPhase::Residual:
+        return "residual";
+    case SolverPhase::Refine:
+        return "refine";
+    default:
+        return "unknown";
+    }
+}
+
+#if CT_TRACK_ALLOCATIONS
+
+namespace
+{
+
+const size_t nPhases = static_cast<size_t>(SolverPhase::nPhases);
+
+// Zero-initialized before any dynamic initialization, so allocations made
+// during static initialization are counted safely
+std::atomic<size_t> s_counts[nPhases];
+thread_local SolverPhase t_phase = SolverPhase::None;
+
+void* countedAllocation(std::size_t size)
+{
+    s_counts[static_cast<size_t>(t_phase)].fetch_add(
+        1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+}
+
+bool allocationTrackingEnabled()
+{
+    return true;
+}
+
+size_t allocationCount(SolverPhase phase)
+{
+    return s_counts[static_cast<size_t>(phase)].load();
+}
+
+void resetAllocationCounts()
+{
+    for (auto& count : s_counts) {
+        count.store(0);
+    }
+}
+
+AllocationPhase::AllocationPhase(SolverPhase phase) :
+    m_previous(t_phase)
+{
+    t_phase = phase;
+}
+
+AllocationPhase::~AllocationPhase()
+{
+    t_phase = m_previous;
+}
+
+#else
+
+bool allocationTrackingEnabled()
+{
+    return false;
+}
+
+size_t allocationCount(SolverPhase phase)
+{
+    return 0;
+}
+
+void resetAllocationCounts()
+{
+}
+
+#endif
+
+}
+
+#if CT_TRACK_ALLOCATIONS
+
+// Replacements of the global allocation functions. Since this file also
+// defines the functions used by the solvers to mark their phases, these
+// replacements are linked into any program which uses the 1D solver.
+
+void* operator new(std::size_t size)
+{
+    void* p = Cantera::countedAllocation(size);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Cantera::countedAllocation(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Cantera::countedAllocation(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+#endif
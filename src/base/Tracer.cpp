@@ -0,0 +1,171 @@
+//! @file Tracer.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/Tracer.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <chrono>
+#include <fstream>
+#include <mutex>
+
+namespace Cantera
+{
+
+namespace
+{
+
+struct TraceEvent
+{
+    const char* name;
+    const char* category;
+    long long start; // [ns]
+    long long duration; // [ns]
+};
+
+// Spans recorded by one thread. Only the owning thread appends to the
+// buffer; the mutex is needed for reading and clearing from other threads.
+struct ThreadTrace
+{
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+    int tid;
+    std::string name;
+};
+
+// Buffers of all threads which have recorded spans. The buffers are kept
+// after their threads exit, so their spans can still be exported.
+std::mutex s_registry_mutex;
+std::vector<std::unique_ptr<ThreadTrace>> s_registry;
+
+thread_local ThreadTrace* t_trace = nullptr;
+
+ThreadTrace& threadTrace()
+{
+    if (!t_trace) {
+        std::unique_ptr<ThreadTrace> trace(new ThreadTrace());
+        std::lock_guard<std::mutex> lock(s_registry_mutex);
+        trace->tid = static_cast<int>(s_registry.size()) + 1;
+        trace->name = fmt::format("thread {}", trace->tid);
+        t_trace = trace.get();
+        s_registry.push_back(std::move(trace));
+    }
+    return *t_trace;
+}
+
+long long now()
+{
+    using namespace std::chrono;
+    static const steady_clock::time_point epoch = steady_clock::now();
+    return duration_cast<nanoseconds>(steady_clock::now() - epoch).count();
+}
+
+std::string jsonEscape(const std::string& s)
+{
+    std::string out;
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out += fmt::format("\\u{:04x}", static_cast<int>(c));
+        } else {
+            out += c;
+        }
+    }
+    return out;
+}
+
+}
+
+std::atomic<bool> TraceSpan::s_enabled(false);
+
+void TraceSpan::begin(const char* name, const char* category)
+{
+    m_name = name;
+    m_category = category;
+    m_start = now();
+}
+
+void TraceSpan::end()
+{
+    long long stop = now();
+    ThreadTrace& trace = threadTrace();
+    std::lock_guard<std::mutex> lock(trace.mutex);
+    trace.events.push_back({m_name, m_category, m_start, stop - m_start});
+}
+
+void startTracing()
+{
+    now(); // set the time origin of the trace
+    TraceSpan::s_enabled.store(true);
+}
+
+void stopTracing()
+{
+    TraceSpan::s_enabled.store(false);
+}
+
+void clearTrace()
+{
+    std::lock_guard<std::mutex> lock(s_registry_mutex);
+    for (auto& trace : s_registry) {
+        std::lock_guard<std::mutex> trace_lock(trace->mutex);
+        trace->events.clear();
+    }
+}
+
+size_t traceEventCount()
+{
+    std::lock_guard<std::mutex> lock(s_registry_mutex);
+    size_t n = 0;
+    for (auto& trace : s_registry) {
+        std::lock_guard<std::mutex> trace_lock(trace->mutex);
+        n += trace->events.size();
+    }
+    return n;
+}
+
+void setTraceThreadName(const std::string& name)
+{
+    ThreadTrace& trace = threadTrace();
+    std::lock_guard<std::mutex> lock(trace.mutex);
+    trace.name = name;
+}
+
+void writeTrace(const std::string& filename)
+{
+    std::ofstream out(filename);
+    if (!out) {
+        throw CanteraError("writeTrace",
+            "Could not open file '{}' for writing.", filename);
+    }
+    out << "{\"traceEvents\": [";
+    std::string sep = "\n";
+    std::lock_guard<std::mutex> lock(s_registry_mutex);
+    for (auto& trace : s_registry) {
+        std::vector<TraceEvent> events;
+        std::string name;
+        {
+            std::lock_guard<std::mutex> trace_lock(trace->mutex);
+            events = trace->events;
+            name = trace->name;
+        }
+        out << sep << fmt::format("{{\"name\": \"thread_name\", \"ph\": \"M\", "
+            "\"pid\": 1, \"tid\": {}, \"args\": {{\"name\": \"{}\"}}}}",
+            trace->tid, jsonEscape(name));
+        sep = ",\n";
+        // Timestamps and durations are in microseconds
+        for (const auto& event : events) {
+            out << sep << fmt::format("{{\"name\": \"{}\", \"cat\": \"{}\", "
+                "\"ph\": \"X\", \"ts\": {:.3f}, \"dur\": {:.3f}, \"pid\": 1, "
+                "\"tid\": {}}}", jsonEscape(event.name),
+                jsonEscape(event.category), 1e-3 * event.start,
+                1e-3 * event.duration, trace->tid);
+        }
+    }
+    out << "\n],\n\"displayTimeUnit\": \"ms\"}\n";
+}
+
+}
@@ -0,0 +1,132 @@
+/**
+ * @file ctserver.cpp
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#define CANTERA_USE_INTERNAL
+#include "cantera/clib/ctserver.h"
+
+#include "cantera/zeroD/ChemistryServer.h"
+#include "Cabinet.h"
+
+using namespace Cantera;
+using namespace std;
+
+typedef Cabinet<ChemistryClient> ClientCabinet;
+template<> ClientCabinet* ClientCabinet::s_storage = 0;
+
+extern "C" {
+
+    int chemclient_new(const char* name)
+    {
+        try {
+            return ClientCabinet::add(new ChemistryClient(name));
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
+    int chemclient_del(int i)
+    {
+        try {
+            ClientCabinet::del(i);
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
+    size_t chemclient_nSpecies(int i)
+    {
+        try {
+            return ClientCabinet::item(i).nSpecies();
+        } catch (...) {
+            return handleAllExceptions(npos, npos);
+        }
+    }
+
+    int chemclient_getSpeciesName(int i, size_t k, size_t lennm, char* nm)
+    {
+        try {
+            return copyString(ClientCabinet::item(i).speciesName(k), nm, lennm);
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
+    size_t chemclient_maxPoints(int i)
+    {
+        try {
+            return ClientCabinet::item(i).maxPoints();
+        } catch (...) {
+            return handleAllExceptions(npos, npos);
+        }
+    }
+
+    int chemclient_setTimeout(int i, double seconds)
+    {
+        try {
+            ClientCabinet::item(i).setTimeout(seconds);
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
+    int chemclient_getNetProductionRates(int i, size_t n, const double* T,
+                                         const double* P, const double* Y,
+                                         double* wdot)
+    {
+        try {
+            ClientCabinet::item(i).getNetProductionRates(n, T, P, Y, wdot);
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
+    int chemclient_getProperties(int i, size_t n, const double* T,
+                                 const double* P, const double* Y,
+                                 double* props)
+    {
+        try {
+            ClientCabinet::item(i).getProperties(n, T, P, Y, props);
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
+    int chemclient_advanceReactors(int i, size_t n, double dt, double* T,
+                                   const double* P, double* Y)
+    {
+        try {
+            ClientCabinet::item(i).advanceReactors(n, dt, T, P, Y);
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
+    int chemclient_shutdownServer(int i)
+    {
+        try {
+            ClientCabinet::item(i).shutdownServer();
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
+    int ct_clearChemClients()
+    {
+        try {
+            ClientCabinet::clear();
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+}
@@ -9,6 +9,7 @@
 
 #include "cantera/equil/ChemEquil.h"
 #include "cantera/base/stringUtils.h"
+#include "cantera/base/Tracer.h"
 #include "cantera/equil/MultiPhaseEquil.h"
 
 using namespace std;
@@ -321,6 +322,7 @@ int ChemEquil::equilibrate(thermo_t& s, const char* XYstr,
                            bool useThermoPhaseElementPotentials,
                            int loglevel)
 {
+    TraceSpan span("ChemEquil::equilibrate", "equil");
     int fail = 0;
     bool tempFixed = true;
     int XY = _equilflag(XYstr);
@@ -948,7 +950,7 @@ int ChemEquil::estimateEP_Brinkley(thermo_t& s, vector_fp& x,
         writelog("  eName       eCurrent       eGoal\n");
         for (size_t m = 0; m < m_mm; m++) {
             writelogf("%5s   %13.5g  %13.5g\n",
-                      s.elementName(m), eMolesFix[m], elMoles[m]);
+                      elementName(m), eMolesFix[m], elMoles[m]);
         }
     }
     for (size_t m = 0; m < m_mm; m++) {
@@ -986,7 +988,7 @@ int ChemEquil::estimateEP_Brinkley(thermo_t& s, vector_fp& x,
             writelogf("(iter %d) element moles bal:   Goal  Calculated\n", iter);
             for (size_t m = 0; m < m_mm; m++) {
                 writelogf("              %8s: %10.5g %10.5g \n",
-                          s.elementName(m), elMoles[m], eMolesCalc[m]);
+                          elementName(m), elMoles[m], eMolesCalc[m]);
             }
         }
 
@@ -1086,7 +1088,7 @@ int ChemEquil::estimateEP_Brinkley(thermo_t& s, vector_fp& x,
                 }
                 if (ChemEquil_print_lvl > 0) {
                     writelogf("               %5s %3d : %5d  %5d\n",
-                              s.elementName(m), lumpSum[m], kMSp, kMSp2);
+                              elementName(m), lumpSum[m], kMSp, kMSp2);
                 }
             }
 
@@ -1315,7 +1317,7 @@ int ChemEquil::estimateEP_Brinkley(thermo_t& s, vector_fp& x,
             writelogf("(it %d)    OLD_SOLUTION  NEW SOLUTION    (undamped updated)\n", iter);
             for (size_t m = 0; m < m_mm; m++) {
                 writelogf("     %5s   %10.5g   %10.5g   %10.5g\n",
-                          s.elementName(m), x_old[m], x[m], resid[m]);
+                          elementName(m), x_old[m], x[m], resid[m]);
             }
             writelogf("       n_t    %10.5g   %10.5g  %10.5g \n", x_old[m_mm], n_t, exp(resid[m_mm]));
         }
@@ -0,0 +1,314 @@
+/**
+ *  @file RCCE.cpp Rate-controlled constrained equilibrium.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/equil/RCCE.h"
+#include "cantera/base/global.h"
+#include "cantera/base/utilities.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+RCCE::RCCE(thermo_t& s) :
+    m_nu(0.0)
+{
+    if (s.type() != "IdealGas") {
+        throw CanteraError("RCCE::RCCE",
+                           "Incompatible phase type '{}'", s.type());
+    }
+    initialize(s);
+    m_n.resize(m_kk);
+    m_x.resize(m_kk);
+    m_hk.resize(m_kk);
+    m_cpk.resize(m_kk);
+    m_jac.resize(m_mm + 2, m_mm + 2);
+    m_rhs.resize(m_mm + 2);
+    fill(m_lambda.begin(), m_lambda.end(), 0.0);
+}
+
+size_t RCCE::addConstraint(const string& name, const compositionMap& coeffs)
+{
+    if (constraintIndex(name) != npos) {
+        throw CanteraError("RCCE::addConstraint",
+                           "Duplicate constraint name '{}'", name);
+    }
+    vector_fp a(m_kk, 0.0);
+    for (const auto& c : coeffs) {
+        size_t k = m_phase->speciesIndex(c.first);
+        if (k == npos) {
+            throw CanteraError("RCCE::addConstraint",
+                               "Unknown species '{}'", c.first);
+        }
+        a[k] = c.second;
+    }
+
+    // Insert the new column into the species-constraint matrix
+    size_t mm = m_mm + 1;
+    vector_fp comp(m_kk * mm);
+    for (size_t k = 0; k < m_kk; k++) {
+        for (size_t m = 0; m < m_mm; m++) {
+            comp[k*mm + m] = nAtoms(k, m);
+        }
+        comp[k*mm + m_mm] = a[k];
+    }
+    m_comp = comp;
+    m_names.push_back(name);
+    m_mm = mm;
+    m_nComponents = mm;
+    m_lambda.push_back(0.0);
+    m_elementmolefracs.resize(mm);
+    m_jwork1.resize(mm + 2);
+    m_jwork2.resize(mm + 2);
+    m_startSoln.resize(mm + 1);
+    m_component.resize(mm, npos);
+    m_orderVectorElements.push_back(mm - 1);
+    m_jac.resize(mm + 2, mm + 2);
+    m_rhs.resize(mm + 2);
+    return mm - 1;
+}
+
+string RCCE::constraintName(size_t j) const
+{
+    size_t nel = m_phase->nElements();
+    if (j < nel) {
+        return m_phase->elementName(j);
+    } else if (j < m_mm) {
+        return m_names[j - nel];
+    }
+    throw IndexError("RCCE::constraintName", "constraints", j, m_mm-1);
+}
+
+size_t RCCE::constraintIndex(const string& name) const
+{
+    for (size_t j = 0; j < m_mm; j++) {
+        if (constraintName(j) == name) {
+            return j;
+        }
+    }
+    return npos;
+}
+
+void RCCE::getConstraints(double* c) const
+{
+    const double* Y = m_phase->massFractions();
+    const vector_fp& mw = m_phase->molecularWeights();
+    for (size_t j = 0; j < m_mm; j++) {
+        c[j] = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            c[j] += nAtoms(k, j) * Y[k] / mw[k];
+        }
+    }
+}
+
+void RCCE::getConstraintRates(const double* wdot, double* cdot) const
+{
+    double rrho = 1.0 / m_phase->density();
+    for (size_t j = 0; j < m_mm; j++) {
+        cdot[j] = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            cdot[j] += nAtoms(k, j) * wdot[k] * rrho;
+        }
+    }
+}
+
+void RCCE::setToConstrainedEquilState(const double* c, bool holdTemperature,
+                                      int loglevel)
+{
+    thermo_t& s = *m_phase;
+    double T = s.temperature();
+    double P = s.pressure();
+    double h0 = s.enthalpy_mass();
+
+    // Estimate the potentials at the initial temperature, treating the
+    // constraints as additional elements
+    vector_fp cgoal(c, c + m_mm);
+    vector_fp x(m_lambda);
+    x.push_back(log(T));
+    int info = estimateEP_Brinkley(s, x, cgoal);
+    if (info != 0 && loglevel > 0) {
+        writelog("RCCE::setToConstrainedEquilState: initial estimate did "
+                 "not converge\n");
+    }
+    copy(x.begin(), x.begin() + m_mm, m_lambda.begin());
+    s.setState_TP(T, P);
+    updateSpeciesProperties(true);
+    double mmw = 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        mmw += m_x[k] * s.molecularWeight(k);
+    }
+    m_nu = - log(mmw);
+
+    double ctot = 0.0;
+    for (size_t j = 0; j < m_mm; j++) {
+        ctot += fabs(c[j]);
+    }
+
+    // Newton iteration on the constraints, the enthalpy, and the
+    // normalization of the mole fractions
+    for (int iter = 0; iter < options.maxIterations; iter++) {
+        s.setState_TP(T, P);
+        updateSpeciesProperties(true);
+        updateJacobian();
+        double RT = GasConstant * T;
+        double h = 0.0, xsum = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            h += m_n[k] * m_hk[k];
+            xsum += m_x[k];
+        }
+        for (size_t j = 0; j < m_mm; j++) {
+            double cj = 0.0;
+            for (size_t k = 0; k < m_kk; k++) {
+                cj += nAtoms(k, j) * m_n[k];
+            }
+            m_rhs[j] = c[j] - cj;
+            if (fabs(c[j]) <= options.absElemTol * ctot) {
+                // Constraint on species which are absent
+                for (size_t n = 0; n < m_mm + 2; n++) {
+                    m_jac(j, n) = 0.0;
+                }
+                m_jac(j, j) = 1.0;
+                m_rhs[j] = 0.0;
+            }
+        }
+        m_rhs[m_mm] = h0 / RT - h;
+        m_rhs[m_mm + 1] = 1.0 - xsum;
+        if (holdTemperature) {
+            for (size_t n = 0; n < m_mm + 2; n++) {
+                m_jac(m_mm, n) = 0.0;
+            }
+            m_jac(m_mm, m_mm + 1) = 1.0;
+            m_rhs[m_mm] = 0.0;
+        }
+        solveJacobian();
+
+        // Limit the step in the potentials and the temperature
+        double dmax = 0.0;
+        for (size_t n = 0; n <= m_mm; n++) {
+            dmax = std::max(dmax, fabs(m_rhs[n]));
+        }
+        dmax = std::max(dmax, 5.0 * fabs(m_rhs[m_mm + 1]) / T);
+        double damp = std::min(1.0, options.maxStepSize / 5.0 / dmax);
+        for (size_t j = 0; j < m_mm; j++) {
+            m_lambda[j] += damp * m_rhs[j];
+        }
+        m_nu += damp * m_rhs[m_mm];
+        T += damp * m_rhs[m_mm + 1];
+        if (loglevel > 0) {
+            writelogf("RCCE: iteration %d: T = %g, max. step = %g\n",
+                      iter, T, dmax);
+        }
+        if (dmax < options.relTolerance && damp == 1.0) {
+            options.iterations = iter;
+            setState_Potentials(m_lambda.data(), T);
+            return;
+        }
+    }
+    throw CanteraError("RCCE::setToConstrainedEquilState",
+                       "No convergence after {} iterations",
+                       options.maxIterations);
+}
+
+void RCCE::setState_Potentials(const double* lambda, double T)
+{
+    copy(lambda, lambda + m_mm, m_lambda.begin());
+    double P = m_phase->pressure();
+    m_phase->setState_TP(T, P);
+    updateSpeciesProperties(true);
+    m_phase->setState_TPX(T, P, m_x.data());
+}
+
+double RCCE::getPotentialRates(const double* cdot, double hdot,
+                               double* lambdaDot, bool holdTemperature)
+{
+    updateSpeciesProperties(false);
+    updateJacobian();
+    copy(cdot, cdot + m_mm, m_rhs.begin());
+    m_rhs[m_mm] = hdot / (GasConstant * m_phase->temperature());
+    m_rhs[m_mm + 1] = 0.0;
+    if (holdTemperature) {
+        for (size_t n = 0; n < m_mm + 2; n++) {
+            m_jac(m_mm, n) = 0.0;
+        }
+        m_jac(m_mm, m_mm + 1) = 1.0;
+        m_rhs[m_mm] = 0.0;
+    }
+    solveJacobian();
+    copy(m_rhs.begin(), m_rhs.begin() + m_mm, lambdaDot);
+    return m_rhs[m_mm + 1];
+}
+
+void RCCE::updateSpeciesProperties(bool fromPotentials)
+{
+    m_phase->getEnthalpy_RT(m_hk.data());
+    m_phase->getCp_R(m_cpk.data());
+    if (fromPotentials) {
+        m_phase->getGibbs_RT(m_muSS_RT.data());
+        for (size_t k = 0; k < m_kk; k++) {
+            double tmp = - m_muSS_RT[k];
+            for (size_t m = 0; m < m_mm; m++) {
+                tmp += nAtoms(k, m) * m_lambda[m];
+            }
+            m_x[k] = exp(std::min(tmp, 100.0));
+            m_n[k] = exp(m_nu) * m_x[k];
+        }
+    } else {
+        const double* Y = m_phase->massFractions();
+        m_phase->getMoleFractions(m_x.data());
+        for (size_t k = 0; k < m_kk; k++) {
+            m_n[k] = Y[k] / m_phase->molecularWeight(k);
+        }
+    }
+}
+
+void RCCE::updateJacobian()
+{
+    double rT = 1.0 / m_phase->temperature();
+    m_jac.zero();
+    for (size_t k = 0; k < m_kk; k++) {
+        double n = m_n[k];
+        double hk = m_hk[k];
+        for (size_t j = 0; j < m_mm; j++) {
+            double a = nAtoms(k, j);
+            if (a == 0.0) {
+                continue;
+            }
+            for (size_t i = 0; i < m_mm; i++) {
+                m_jac(j, i) += a * nAtoms(k, i) * n;
+            }
+            m_jac(j, m_mm) += a * n;
+            m_jac(j, m_mm + 1) += a * n * hk * rT;
+            m_jac(m_mm, j) += hk * a * n;
+            m_jac(m_mm + 1, j) += a * m_x[k];
+        }
+        m_jac(m_mm, m_mm) += hk * n;
+        m_jac(m_mm, m_mm + 1) += (m_cpk[k] + hk * hk) * n * rT;
+        m_jac(m_mm + 1, m_mm + 1) += m_x[k] * hk * rT;
+    }
+}
+
+void RCCE::solveJacobian()
+{
+    for (size_t m = 0; m < m_mm + 2; m++) {
+        double rmax = 0.0;
+        for (size_t n = 0; n < m_mm + 2; n++) {
+            rmax = std::max(rmax, fabs(m_jac(m, n)));
+        }
+        if (rmax == 0.0) {
+            throw CanteraError("RCCE::solveJacobian",
+                               "Constraint '{}' does not involve any species",
+                               elementName(m));
+        }
+        for (size_t n = 0; n < m_mm + 2; n++) {
+            m_jac(m, n) /= rmax;
+        }
+        m_rhs[m] /= rmax;
+    }
+    solve(m_jac, m_rhs.data());
+}
+
+}
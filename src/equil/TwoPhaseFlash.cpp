@@ -0,0 +1,407 @@
+//! @file TwoPhaseFlash.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/equil/TwoPhaseFlash.h"
+#include "cantera/thermo/RedlichKwongMFTP.h"
+#include "cantera/base/utilities.h"
+#include <limits>
+
+using namespace std;
+
+namespace
+{
+const double Inf = std::numeric_limits<double>::infinity();
+
+//! Largest |ln K| for which the phases are considered identical
+const double trivialLnK = 1e-4;
+
+//! Number of substitution steps between extrapolation steps
+const int accelerationInterval = 5;
+}
+
+namespace Cantera
+{
+
+TwoPhaseFlash::TwoPhaseFlash(ThermoPhase& vapor, ThermoPhase& liquid) :
+    m_vap(vapor),
+    m_liq(liquid),
+    m_liqIndex(vapor.nSpecies(), npos),
+    m_lnK(vapor.nSpecies(), 0.0),
+    m_beta(0.5),
+    m_x(vapor.nSpecies(), 0.0),
+    m_y(vapor.nSpecies(), 0.0),
+    m_K(vapor.nSpecies()),
+    m_xl(liquid.nSpecies()),
+    m_muV(vapor.nSpecies()),
+    m_muL(liquid.nSpecies()),
+    m_lnKold(vapor.nSpecies()),
+    m_dlnK(vapor.nSpecies()),
+    m_dlnKold(vapor.nSpecies()),
+    m_tol(1e-10),
+    m_maxiter(500),
+    m_warm(false)
+{
+    for (size_t k = 0; k < liquid.nSpecies(); k++) {
+        size_t kv = vapor.speciesIndex(liquid.speciesName(k));
+        if (kv == npos) {
+            throw CanteraError("TwoPhaseFlash::TwoPhaseFlash",
+                "Liquid species '{}' is not a species of the vapor phase "
+                "'{}'.", liquid.speciesName(k), vapor.name());
+        }
+        m_liqIndex[kv] = k;
+    }
+    if (liquid.nSpecies() == 0) {
+        throw CanteraError("TwoPhaseFlash::TwoPhaseFlash",
+                           "Liquid phase has no species.");
+    }
+    for (size_t k = 0; k < nComponents(); k++) {
+        if (m_liqIndex[k] == npos) {
+            m_lnK[k] = Inf;
+        }
+    }
+}
+
+int TwoPhaseFlash::flash(double T, double P, const double* z)
+{
+    size_t nc = nComponents();
+    double zc = 0.0;
+    for (size_t k = 0; k < nc; k++) {
+        if (m_liqIndex[k] != npos) {
+            zc += z[k];
+        }
+    }
+    if (zc <= 0.0) {
+        // Only non-condensable components
+        m_beta = 1.0;
+        copy(z, z + nc, m_y.begin());
+        fill(m_x.begin(), m_x.end(), 0.0);
+        setPhaseState(m_vap, false, T, P, m_y.data());
+        return 0;
+    }
+
+    if (!m_warm) {
+        // Use Wilson's correlation (with a zero acentric factor) for liquid
+        // phases that provide critical properties, such as cubic equations
+        // of state. Otherwise, use the fugacity of each pure liquid component
+        // relative to its fugacity in the vapor at the overall composition,
+        // which reduces to Raoult's law for ideal phases.
+        setPhaseState(m_vap, false, T, P, z);
+        m_vap.getChemPotentials(m_muV.data());
+        vector_fp& e = m_K;
+        for (size_t k = 0; k < nc; k++) {
+            size_t kl = m_liqIndex[k];
+            if (kl == npos) {
+                continue;
+            }
+            fill(e.begin(), e.end(), 0.0);
+            e[k] = 1.0;
+            setPhaseState(m_liq, true, T, P, e.data());
+            try {
+                double Tc = m_liq.critTemperature();
+                double Pc = m_liq.critPressure();
+                m_lnK[k] = log(Pc / P) + 5.373 * (1.0 - Tc / T);
+            } catch (NotImplementedError&) {
+                m_liq.getChemPotentials(m_muL.data());
+                double y = std::max(m_vap.moleFraction(k), SmallNumber);
+                m_lnK[k] = (m_muL[kl] - m_muV[k]) / (GasConstant * T)
+                           + log(y);
+            }
+        }
+        m_beta = 0.5;
+    }
+
+    int iter = 0;
+    bool converged = false;
+    bool trivial = false;
+    try {
+        for (iter = 1; iter <= m_maxiter; iter++) {
+            splitComposition(z);
+            setPhaseState(m_vap, false, T, P, m_y.data());
+            setPhaseState(m_liq, true, T, P, m_x.data());
+            m_lnKold = m_lnK;
+            m_dlnKold.swap(m_dlnK);
+            double dmax = updateKValues(m_lnK);
+
+            double lnKmax = 0.0;
+            for (size_t k = 0; k < nc; k++) {
+                if (m_liqIndex[k] != npos) {
+                    m_dlnK[k] = m_lnK[k] - m_lnKold[k];
+                    lnKmax = std::max(lnKmax, std::abs(m_lnK[k]));
+                } else {
+                    m_dlnK[k] = 0.0;
+                    lnKmax = Inf;
+                }
+            }
+            if (lnKmax < trivialLnK) {
+                // Both phases have converged to the same composition
+                trivial = true;
+                break;
+            } else if (dmax < m_tol) {
+                converged = true;
+                break;
+            }
+
+            if (iter % accelerationInterval == 0) {
+                // Extrapolate along the dominant eigenvector of the
+                // substitution (Crowe and Nishio, AIChE J. 21 (1975) 528)
+                double gg = 0.0, gg0 = 0.0;
+                for (size_t k = 0; k < nc; k++) {
+                    gg += m_dlnK[k] * m_dlnK[k];
+                    gg0 += m_dlnKold[k] * m_dlnK[k];
+                }
+                double lambda = (gg0 != 0.0) ? gg / gg0 : 0.0;
+                if (lambda > 0.0 && lambda < 0.99) {
+                    for (size_t k = 0; k < nc; k++) {
+                        m_lnK[k] += m_dlnK[k] * lambda / (1.0 - lambda);
+                    }
+                }
+            }
+        }
+        if (!converged && !trivial) {
+            throw CanteraError("TwoPhaseFlash::flash",
+                "No convergence after {} iterations at T = {}, P = {}",
+                m_maxiter, T, P);
+        }
+        if (!trivial && m_beta > 0.0 && m_beta < 1.0) {
+            m_warm = true;
+            return iter;
+        }
+
+        // Single phase. Report the composition of the incipient phase.
+        if (trivial) {
+            m_beta = 1.0;
+        }
+        double sx = 0.0, sy = 0.0;
+        for (size_t k = 0; k < nc; k++) {
+            if (z[k] <= 0.0) {
+                // Avoid 0*Inf for absent non-condensable components
+                m_x[k] = m_y[k] = 0.0;
+                continue;
+            }
+            double K = exp(m_lnK[k]);
+            m_x[k] = (m_beta >= 1.0) ? z[k] / K : z[k];
+            m_y[k] = (m_beta >= 1.0) ? z[k] : z[k] * K;
+            sx += m_x[k];
+            sy += m_y[k];
+        }
+        scale(m_x.begin(), m_x.end(), m_x.begin(), 1.0 / sx);
+        scale(m_y.begin(), m_y.end(), m_y.begin(), 1.0 / sy);
+        m_beta = (m_beta >= 1.0) ? 1.0 : 0.0;
+        setPhaseState(m_vap, false, T, P, m_y.data());
+        setPhaseState(m_liq, true, T, P, m_x.data());
+    } catch (CanteraError&) {
+        m_warm = false;
+        throw;
+    }
+    m_warm = !trivial;
+    return iter;
+}
+
+void TwoPhaseFlash::flash(size_t n, const double* T, const double* P,
+                          const double* z, double* beta, double* x,
+                          double* y, double* lnK)
+{
+    size_t nc = nComponents();
+    for (size_t i = 0; i < n; i++) {
+        if (lnK) {
+            setLogKValues(lnK + i*nc);
+        }
+        flash(T[i], P[i], z + i*nc);
+        beta[i] = m_beta;
+        if (x) {
+            getLiquidMoleFractions(x + i*nc);
+        }
+        if (y) {
+            getVaporMoleFractions(y + i*nc);
+        }
+        if (lnK) {
+            getLogKValues(lnK + i*nc);
+        }
+    }
+}
+
+void TwoPhaseFlash::getLiquidMoleFractions(double* x) const
+{
+    copy(m_x.begin(), m_x.end(), x);
+}
+
+void TwoPhaseFlash::getVaporMoleFractions(double* y) const
+{
+    copy(m_y.begin(), m_y.end(), y);
+}
+
+void TwoPhaseFlash::getLogKValues(double* lnK) const
+{
+    copy(m_lnK.begin(), m_lnK.end(), lnK);
+}
+
+void TwoPhaseFlash::setLogKValues(const double* lnK)
+{
+    for (size_t k = 0; k < nComponents(); k++) {
+        if (m_liqIndex[k] != npos) {
+            m_lnK[k] = lnK[k];
+        }
+    }
+    m_warm = true;
+}
+
+double TwoPhaseFlash::solveRachfordRice(size_t n, const double* z,
+                                        const double* K, double beta)
+{
+    // Interval on which all compositions are positive
+    double lo = -Inf, hi = Inf;
+    for (size_t k = 0; k < n; k++) {
+        if (z[k] <= 0.0) {
+            continue;
+        } else if (K[k] > 1.0) {
+            lo = std::max(lo, (K[k] == Inf) ? 0.0 : 1.0 / (1.0 - K[k]));
+        } else if (K[k] < 1.0) {
+            hi = std::min(hi, 1.0 / (1.0 - K[k]));
+        }
+    }
+    if (lo == -Inf && hi == Inf) {
+        // All ratios are one
+        return beta;
+    } else if (hi == Inf) {
+        return Inf;
+    } else if (lo == -Inf) {
+        return -Inf;
+    }
+
+    if (!(beta > lo && beta < hi)) {
+        beta = 0.5 * (lo + hi);
+    }
+    for (int iter = 0; iter < 100; iter++) {
+        // The function is monotonically decreasing
+        double f = 0.0, df = 0.0;
+        for (size_t k = 0; k < n; k++) {
+            if (z[k] <= 0.0) {
+                continue;
+            } else if (K[k] == Inf) {
+                f += z[k] / beta;
+                df -= z[k] / (beta * beta);
+            } else {
+                double t = (K[k] - 1.0) / (1.0 + beta * (K[k] - 1.0));
+                f += z[k] * t;
+                df -= z[k] * t * t;
+            }
+        }
+        if (f > 0.0) {
+            lo = beta;
+        } else {
+            hi = beta;
+        }
+        double betaNew = (df < 0.0) ? beta - f / df : 0.5 * (lo + hi);
+        if (!(betaNew > lo && betaNew < hi)) {
+            betaNew = 0.5 * (lo + hi);
+        }
+        if (std::abs(betaNew - beta) <= 1e-14 * std::max(1.0, std::abs(beta))
+            || f == 0.0) {
+            return betaNew;
+        }
+        beta = betaNew;
+    }
+    return beta;
+}
+
+void TwoPhaseFlash::splitComposition(const double* z)
+{
+    size_t nc = nComponents();
+    for (size_t k = 0; k < nc; k++) {
+        m_K[k] = exp(m_lnK[k]);
+    }
+    m_beta = solveRachfordRice(nc, z, m_K.data(), m_beta);
+    double sx = 0.0, sy = 0.0;
+    for (size_t k = 0; k < nc; k++) {
+        if (z[k] <= 0.0) {
+            // Absent components, which may have an infinite ratio
+            m_x[k] = m_y[k] = 0.0;
+        } else if (m_beta == Inf) {
+            // Vapor, with an incipient liquid
+            m_y[k] = z[k];
+            m_x[k] = z[k] / m_K[k];
+        } else if (m_beta == -Inf) {
+            // Liquid, with an incipient vapor
+            m_x[k] = z[k];
+            m_y[k] = z[k] * m_K[k];
+        } else if (m_K[k] == Inf) {
+            m_x[k] = 0.0;
+            m_y[k] = z[k] / m_beta;
+        } else {
+            m_x[k] = z[k] / (1.0 + m_beta * (m_K[k] - 1.0));
+            m_y[k] = m_K[k] * m_x[k];
+        }
+        sx += m_x[k];
+        sy += m_y[k];
+    }
+    scale(m_x.begin(), m_x.end(), m_x.begin(), 1.0 / sx);
+    scale(m_y.begin(), m_y.end(), m_y.begin(), 1.0 / sy);
+}
+
+void TwoPhaseFlash::setPhaseState(ThermoPhase& phase, bool liquid, double T,
+                                  double P, const double* xc)
+{
+    if (&phase == &m_liq) {
+        fill(m_xl.begin(), m_xl.end(), 0.0);
+        for (size_t k = 0; k < nComponents(); k++) {
+            if (m_liqIndex[k] != npos) {
+                m_xl[m_liqIndex[k]] = xc[k];
+            }
+        }
+        phase.setMoleFractions(m_xl.data());
+    } else {
+        phase.setMoleFractions(xc);
+    }
+
+    RedlichKwongMFTP* rk = dynamic_cast<RedlichKwongMFTP*>(&phase);
+    if (rk) {
+        // Select the root of the equation of state explicitly, rather than
+        // the one closest to the current density
+        double rho;
+        rk->getDensities(1, &T, &P, liquid ? FLUID_LIQUID_0 : FLUID_GAS,
+                         &rho);
+        if (rho < 0.0) {
+            rk->getDensities(1, &T, &P, FLUID_UNDEFINED, &rho);
+        }
+        if (rho < 0.0) {
+            throw CanteraError("TwoPhaseFlash::setPhaseState",
+                "No density for phase '{}' at T = {}, P = {}", phase.name(),
+                T, P);
+        }
+        rk->setState_TR(T, rho);
+    } else {
+        phase.setState_TP(T, P);
+    }
+}
+
+double TwoPhaseFlash::updateKValues(vector_fp& lnK)
+{
+    m_vap.getChemPotentials(m_muV.data());
+    m_liq.getChemPotentials(m_muL.data());
+    double RT = GasConstant * m_vap.temperature();
+    double dmax = 0.0;
+    for (size_t k = 0; k < nComponents(); k++) {
+        size_t kl = m_liqIndex[k];
+        if (kl == npos) {
+            continue;
+        }
+        // The phases evaluate the ideal mixing term with the same lower
+        // bound on the mole fractions, so it is removed exactly here
+        double y = std::max(m_vap.moleFraction(k), SmallNumber);
+        double x = std::max(m_liq.moleFraction(kl), SmallNumber);
+        double v = (m_muL[kl] - m_muV[k]) / RT + log(y / x);
+        if (!std::isfinite(v)) {
+            throw CanteraError("TwoPhaseFlash::updateKValues",
+                "Non-finite equilibrium ratio for component '{}' at T = {}, "
+                "P = {}", m_vap.speciesName(k), m_vap.temperature(),
+                m_vap.pressure());
+        }
+        dmax = std::max(dmax, std::abs(v - m_lnK[k]));
+        lnK[k] = v;
+    }
+    return dmax;
+}
+
+}
@@ -17,7 +17,8 @@ BulkKinetics::BulkKinetics(thermo_t* thermo) :
 }
 
 bool BulkKinetics::isReversible(size_t i) {
-    return std::find(m_revindex.begin(), m_revindex.end(), i) < m_revindex.end();
+    checkReactionIndex(i);
+    return m_reactions[i]->reversible;
 }
 
 void BulkKinetics::getDeltaGibbs(doublereal* deltaG)
@@ -122,6 +123,12 @@ bool BulkKinetics::addReaction(shared_ptr<Reaction> r)
     return true;
 }
 
+void BulkKinetics::reserveReactions(size_t n)
+{
+    Kinetics::reserveReactions(n);
+    m_dn.reserve(n);
+}
+
 void BulkKinetics::addElementaryReaction(ElementaryReaction& r)
 {
     m_rates.install(nReactions()-1, r.rate);
@@ -6,6 +6,7 @@
 // at http://www.cantera.org/license.txt for license and copyright information.
 
 #include "cantera/kinetics/GasKinetics.h"
+#include "cantera/base/Tracer.h"
 
 using namespace std;
 
@@ -16,7 +17,9 @@ GasKinetics::GasKinetics(thermo_t* thermo) :
     m_logp_ref(0.0),
     m_logc_ref(0.0),
     m_logStandConc(0.0),
-    m_pres(0.0)
+    m_pres(0.0),
+    m_qssReady(false),
+    m_qssLinear(true)
 {
 }
 
@@ -43,6 +46,20 @@ void GasKinetics::update_rates_T()
         m_ROP_ok = false;
     }
 
+    if (P != m_pres) {
+        // The pressure-dependent parts of the P-log and Chebyshev rates are
+        // only updated when the pressure changes. At constant pressure, each
+        // rate is then evaluated as a function of temperature only.
+        if (m_plog_rates.nReactions()) {
+            double logP = log(P);
+            m_plog_rates.update_C(&logP);
+        }
+        if (m_cheb_rates.nReactions()) {
+            double log10P = log10(P);
+            m_cheb_rates.update_C(&log10P);
+        }
+    }
+
     if (T != m_temp || P != m_pres) {
         if (m_plog_rates.nReactions()) {
             m_plog_rates.update(T, logT, m_rfn.data());
@@ -73,18 +90,6 @@ void GasKinetics::update_rates_C()
         m_falloff_concm.update(m_conc, ctot, concm_falloff_values.data());
     }
 
-    // P-log reactions
-    if (m_plog_rates.nReactions()) {
-        double logP = log(thermo().pressure());
-        m_plog_rates.update_C(&logP);
-    }
-
-    // Chebyshev reactions
-    if (m_cheb_rates.nReactions()) {
-        double log10P = log10(thermo().pressure());
-        m_cheb_rates.update_C(&log10P);
-    }
-
     m_ROP_ok = false;
 }
 
@@ -154,6 +159,7 @@ void GasKinetics::processFalloffReactions()
 
 void GasKinetics::updateROP()
 {
+    TraceSpan span("GasKinetics::updateROP", "kinetics");
     update_rates_C();
     update_rates_T();
     if (m_ROP_ok) {
@@ -182,11 +188,15 @@ void GasKinetics::updateROP()
     // rates copied into m_ropr by the reciprocals of the equilibrium constants
     multiply_each(m_ropr.begin(), m_ropr.end(), m_rkcn.begin());
 
-    // multiply ropf by concentration products
-    m_reactantStoich.multiply(m_conc.data(), m_ropf.data());
+    if (m_qss.empty()) {
+        // multiply ropf by concentration products
+        m_reactantStoich.multiply(m_conc.data(), m_ropf.data());
 
-    // for reversible reactions, multiply ropr by concentration products
-    m_revProductStoich.multiply(m_conc.data(), m_ropr.data());
+        // for reversible reactions, multiply ropr by concentration products
+        m_revProductStoich.multiply(m_conc.data(), m_ropr.data());
+    } else {
+        solveQSS();
+    }
 
     for (size_t j = 0; j != nReactions(); ++j) {
         m_ropnet[j] = m_ropf[j] - m_ropr[j];
@@ -235,6 +245,7 @@ bool GasKinetics::addReaction(shared_ptr<Reaction> r)
     if (!added) {
         return false;
     }
+    m_qssReady = false;
 
     switch (r->reaction_type) {
     case ELEMENTARY_RXN:
@@ -317,11 +328,15 @@ void GasKinetics::addThreeBodyReaction(ThreeBodyReaction& r)
 void GasKinetics::addPlogReaction(PlogReaction& r)
 {
     m_plog_rates.install(nReactions()-1, r.rate);
+    // Pressure-dependent parts of the new rate need to be evaluated
+    m_pres += 0.13579;
 }
 
 void GasKinetics::addChebyshevReaction(ChebyshevReaction& r)
 {
     m_cheb_rates.install(nReactions()-1, r.rate);
+    // Pressure-dependent parts of the new rate need to be evaluated
+    m_pres += 0.13579;
 }
 
 void GasKinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
@@ -386,6 +401,234 @@ void GasKinetics::init()
     m_logp_ref = log(thermo().refPressure()) - log(GasConstant);
 }
 
+void GasKinetics::setQSSSpecies(const std::vector<std::string>& names)
+{
+    std::vector<size_t> qss;
+    for (const auto& name : names) {
+        size_t k = kineticsSpeciesIndex(name);
+        if (k == npos) {
+            throw CanteraError("GasKinetics::setQSSSpecies",
+                               "Unknown species '{}'", name);
+        }
+        if (!hasDestructionPath(k)) {
+            throw CanteraError("GasKinetics::setQSSSpecies",
+                "Species '{}' is not consumed by any reaction, so its "
+                "quasi-steady-state concentration is undefined", name);
+        }
+        qss.push_back(k);
+    }
+    std::sort(qss.begin(), qss.end());
+    qss.erase(std::unique(qss.begin(), qss.end()), qss.end());
+    m_qss = qss;
+    m_qssIndex.assign(m_kk, npos);
+    for (size_t q = 0; q < m_qss.size(); q++) {
+        m_qssIndex[m_qss[q]] = q;
+    }
+    m_qssReady = false;
+    m_ROP_ok = false;
+}
+
+std::vector<std::string> GasKinetics::qssSpecies() const
+{
+    std::vector<std::string> names;
+    for (size_t k : m_qss) {
+        names.push_back(kineticsSpeciesName(k));
+    }
+    return names;
+}
+
+size_t GasKinetics::selectQSSSpecies(double tau)
+{
+    setQSSSpecies({});
+    vector_fp ddot(m_kk), conc(m_kk);
+    getDestructionRates(ddot.data());
+    thermo().getConcentrations(conc.data());
+    std::vector<std::string> names;
+    for (size_t k = 0; k < m_kk; k++) {
+        if (ddot[k] > 0.0 && conc[k] < tau * ddot[k] && hasDestructionPath(k)) {
+            names.push_back(kineticsSpeciesName(k));
+        }
+    }
+    setQSSSpecies(names);
+    return names.size();
+}
+
+bool GasKinetics::hasDestructionPath(size_t k) const
+{
+    const std::string& name = kineticsSpeciesName(k);
+    for (const auto& R : m_reactions) {
+        double nr = getValue(R->reactants, name, 0.0);
+        double np = getValue(R->products, name, 0.0);
+        if (nr > np && getValue(R->orders, name, nr) != 0.0) {
+            return true;
+        } else if (np > nr && R->reversible) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void GasKinetics::getQSSConcentrations(double* conc)
+{
+    if (m_qss.empty()) {
+        return;
+    }
+    updateROP();
+    std::copy(m_qssConc.begin(), m_qssConc.end(), conc);
+}
+
+void GasKinetics::initQSS()
+{
+    size_t nq = m_qss.size();
+    m_qssIndex.resize(m_kk, npos);
+    m_qssTerms.clear();
+    m_qssLinear = true;
+    for (size_t i = 0; i < nReactions(); i++) {
+        const Reaction& R = *m_reactions[i];
+        QSSTerm fwd, rev;
+        fwd.rxn = rev.rxn = i;
+        fwd.reverse = false;
+        rev.reverse = true;
+
+        // Net production of each QSS species by the reaction
+        std::map<size_t, double> net;
+        for (const auto& sp : R.reactants) {
+            size_t q = m_qssIndex[kineticsSpeciesIndex(sp.first)];
+            if (q != npos) {
+                net[q] -= sp.second;
+                double order = getValue(R.orders, sp.first, sp.second);
+                if (order != 0.0) {
+                    fwd.orders.emplace_back(q, order);
+                }
+            }
+        }
+        for (const auto& sp : R.orders) {
+            size_t q = m_qssIndex[kineticsSpeciesIndex(sp.first)];
+            if (q != npos && !R.reactants.count(sp.first) && sp.second != 0.0) {
+                fwd.orders.emplace_back(q, sp.second);
+            }
+        }
+        for (const auto& sp : R.products) {
+            size_t q = m_qssIndex[kineticsSpeciesIndex(sp.first)];
+            if (q != npos) {
+                net[q] += sp.second;
+                if (R.reversible) {
+                    rev.orders.emplace_back(q, sp.second);
+                }
+            }
+        }
+        for (const auto& n : net) {
+            if (n.second != 0.0) {
+                fwd.stoich.emplace_back(n.first, n.second);
+                rev.stoich.emplace_back(n.first, -n.second);
+            }
+        }
+
+        for (QSSTerm* term : {&fwd, &rev}) {
+            if ((term->reverse && !R.reversible) ||
+                (term->orders.empty() && term->stoich.empty())) {
+                continue;
+            }
+            if (term->orders.size() > 1 ||
+                (term->orders.size() == 1 && term->orders[0].second != 1.0)) {
+                m_qssLinear = false;
+            }
+            m_qssTerms.push_back(*term);
+        }
+    }
+
+    m_qssJac.resize(nq, nq);
+    m_qssRhs.resize(nq);
+    m_qssConc.resize(nq);
+    m_qssWork.resize(m_kk);
+    m_qssReady = true;
+}
+
+void GasKinetics::solveQSS()
+{
+    if (!m_qssReady) {
+        initQSS();
+    }
+    size_t nq = m_qss.size();
+
+    // Concentration products excluding the QSS species, which are included
+    // below using the QSS concentrations
+    m_qssWork = m_conc;
+    for (size_t q = 0; q < nq; q++) {
+        m_qssWork[m_qss[q]] = 1.0;
+        m_qssConc[q] = std::max(m_conc[m_qss[q]], 0.0);
+    }
+    m_reactantStoich.multiply(m_qssWork.data(), m_ropf.data());
+    m_revProductStoich.multiply(m_qssWork.data(), m_ropr.data());
+
+    // Solve the species balances, which are linear in the concentration of
+    // the first QSS species appearing in each rate of progress. Any other
+    // factors are evaluated using the previous estimate.
+    double dmax = 0.0;
+    for (int iter = 0; iter < 50; iter++) {
+        m_qssJac.zero();
+        fill(m_qssRhs.begin(), m_qssRhs.end(), 0.0);
+        for (const auto& term : m_qssTerms) {
+            double rop = term.reverse ? m_ropr[term.rxn] : m_ropf[term.rxn];
+            if (term.orders.empty()) {
+                for (const auto& s : term.stoich) {
+                    m_qssRhs[s.first] -= s.second * rop;
+                }
+                continue;
+            }
+            size_t p = term.orders[0].first;
+            rop *= pow(std::max(m_qssConc[p], SmallNumber),
+                       term.orders[0].second - 1.0);
+            for (size_t n = 1; n < term.orders.size(); n++) {
+                rop *= pow(m_qssConc[term.orders[n].first],
+                           term.orders[n].second);
+            }
+            for (const auto& s : term.stoich) {
+                m_qssJac(s.first, p) += s.second * rop;
+            }
+        }
+        solve(m_qssJac, m_qssRhs.data());
+
+        dmax = 0.0;
+        for (size_t q = 0; q < nq; q++) {
+            double c = std::max(m_qssRhs[q], 0.0);
+            dmax = std::max(dmax, fabs(c - m_qssConc[q]) / (c + SmallNumber));
+            m_qssConc[q] = c;
+        }
+        if (m_qssLinear || dmax < 1e-10) {
+            break;
+        }
+    }
+    if (!m_qssLinear && !(dmax < 1e-10)) {
+        throw CanteraError("GasKinetics::solveQSS", "Fixed-point iteration "
+            "for the quasi-steady-state concentrations did not converge "
+            "(largest relative change in the last iteration: {})", dmax);
+    }
+
+    for (const auto& term : m_qssTerms) {
+        double& rop = term.reverse ? m_ropr[term.rxn] : m_ropf[term.rxn];
+        for (const auto& order : term.orders) {
+            rop *= pow(m_qssConc[order.first], order.second);
+        }
+    }
+}
+
+void GasKinetics::applyQSSConcentrations()
+{
+    if (m_qss.empty()) {
+        return;
+    }
+    updateROP();
+    ThermoPhase& phase = thermo();
+    double rho = phase.density();
+    phase.getMassFractions(m_qssWork.data());
+    for (size_t q = 0; q < m_qss.size(); q++) {
+        size_t k = m_qss[q];
+        m_qssWork[k] = m_qssConc[q] * phase.molecularWeight(k) / rho;
+    }
+    phase.setMassFractions_NoNorm(m_qssWork.data());
+}
+
 void GasKinetics::invalidateCache()
 {
     BulkKinetics::invalidateCache();
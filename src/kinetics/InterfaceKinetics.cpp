@@ -57,9 +57,14 @@ void InterfaceKinetics::_update_rates_T()
         m_redo_rates = true;
     }
 
-    // Go find the temperature from the surface
+    // Go find the temperature from the surface. The rate constants and
+    // equilibrium constants also depend on the state of the other phases,
+    // through their standard chemical potentials and standard concentrations.
+    // If only the compositions have changed, the cached values are reused.
     doublereal T = thermo(surfacePhaseIndex()).temperature();
-    m_redo_rates = true;
+    if (rateStateChanged()) {
+        m_redo_rates = true;
+    }
     if (T != m_temp || m_redo_rates) {
         m_logtemp = log(T);
 
@@ -82,6 +87,36 @@ void InterfaceKinetics::_update_rates_T()
     }
 }
 
+bool InterfaceKinetics::rateStateChanged()
+{
+    bool changed = false;
+    size_t np = nPhases();
+    if (m_rateState.size() != 2*np + 1) {
+        m_rateState.assign(2*np + 1, -1.0);
+        changed = true;
+    }
+    for (size_t n = 0; n < np; n++) {
+        double T = thermo(n).temperature();
+        double P = thermo(n).pressure();
+        if (T != m_rateState[2*n]) {
+            m_rateState[2*n] = T;
+            changed = true;
+        }
+        // Ignore round-off level changes in the pressure, which occur when
+        // the pressure is computed from the density
+        if (fabs(P - m_rateState[2*n+1]) > 1e-13 * fabs(P)) {
+            m_rateState[2*n+1] = P;
+            changed = true;
+        }
+    }
+    double n0 = m_surf ? m_surf->siteDensity() : 0.0;
+    if (n0 != m_rateState[2*np]) {
+        m_rateState[2*np] = n0;
+        changed = true;
+    }
+    return changed;
+}
+
 void InterfaceKinetics::_update_rates_phi()
 {
     // Store electric potentials for each phase in the array m_phi[].
@@ -603,6 +638,7 @@ bool InterfaceKinetics::addReaction(shared_ptr<Reaction> r_base)
     m_deltaG0.push_back(0.0);
     m_deltaG.push_back(0.0);
     m_ProdStanConcReac.push_back(0.0);
+    m_redo_rates = true;
 
     return true;
 }
@@ -797,6 +833,97 @@ void InterfaceKinetics::solvePseudoSteadyStateProblem(
     m_integrator->solvePseudoSteadyStateProblem(ifuncOverride, timeScaleOverride);
 }
 
+void InterfaceKinetics::getNetProductionRatesCoverageDerivatives(
+    doublereal* dwdot)
+{
+    if (!coverageDerivativesAvailable()) {
+        throw CanteraError("InterfaceKinetics::"
+            "getNetProductionRatesCoverageDerivatives", "Coverage derivatives "
+            "are not available for mechanisms with coverage-dependent rates, "
+            "electrochemical reactions, or non-existent phases");
+    }
+    size_t nr = nReactions();
+    if (m_fwdOrders.size() != nr) {
+        m_fwdOrders.assign(nr, {});
+        m_revOrders.assign(nr, {});
+        m_netStoich.assign(nr, {});
+        for (size_t i = 0; i < nr; i++) {
+            const Reaction& r = *m_reactions[i];
+            Composition fwd = r.reactants;
+            for (const auto& order : r.orders) {
+                fwd[order.first] = order.second;
+            }
+            for (const auto& sp : fwd) {
+                m_fwdOrders[i].emplace_back(kineticsSpeciesIndex(sp.first),
+                                            sp.second);
+            }
+            map<size_t, double> net;
+            for (const auto& sp : r.products) {
+                size_t k = kineticsSpeciesIndex(sp.first);
+                if (r.reversible) {
+                    m_revOrders[i].emplace_back(k, sp.second);
+                }
+                net[k] += sp.second;
+            }
+            for (const auto& sp : r.reactants) {
+                net[kineticsSpeciesIndex(sp.first)] -= sp.second;
+            }
+            m_netStoich[i].assign(net.begin(), net.end());
+        }
+    }
+
+    // Make sure that the rate constants and concentrations are current
+    updateROP();
+
+    size_t nt = nTotalSpecies();
+    size_t ns = m_surf->nSpecies();
+    size_t ks = m_start[surfacePhaseIndex()];
+    double n0 = m_surf->siteDensity();
+    std::fill(dwdot, dwdot + nt * ns, 0.0);
+    vector_fp dropdtheta(ns);
+
+    // Derivative of the product of activity concentrations in a rate
+    // expression with respect to the coverage of surface species n
+    auto dprod = [&](const std::vector<std::pair<size_t, double>>& orders,
+                     size_t n) {
+        double d = 1.0;
+        bool found = false;
+        for (const auto& sp : orders) {
+            double a = m_actConc[sp.first];
+            if (sp.first == ks + n) {
+                found = true;
+                double o = sp.second;
+                a = (o < 1.0) ? std::max(a, Tiny) : a;
+                d *= o * pow(a, o - 1.0) * n0 / m_surf->size(n);
+            } else {
+                d *= pow(a, sp.second);
+            }
+        }
+        return found ? d : 0.0;
+    };
+
+    for (size_t i = 0; i < nr; i++) {
+        double kf = m_rfn[i] * m_perturb[i];
+        double kr = kf * m_rkcn[i];
+        bool any = false;
+        for (size_t n = 0; n < ns; n++) {
+            dropdtheta[n] = kf * dprod(m_fwdOrders[i], n);
+            if (kr != 0.0) {
+                dropdtheta[n] -= kr * dprod(m_revOrders[i], n);
+            }
+            any |= (dropdtheta[n] != 0.0);
+        }
+        if (!any) {
+            continue;
+        }
+        for (const auto& sp : m_netStoich[i]) {
+            for (size_t n = 0; n < ns; n++) {
+                dwdot[n * nt + sp.first] += sp.second * dropdtheta[n];
+            }
+        }
+    }
+}
+
 void InterfaceKinetics::setPhaseExistence(const size_t iphase, const int exists)
 {
     if (iphase >= m_thermo.size()) {
@@ -25,7 +25,8 @@ Kinetics::Kinetics() :
     m_rxnphase(npos),
     m_mindim(4),
     m_skipUndeclaredSpecies(false),
-    m_skipUndeclaredThirdBodies(false)
+    m_skipUndeclaredThirdBodies(false),
+    m_bulkAssembly(false)
 {
 }
 
@@ -284,15 +285,25 @@ string Kinetics::kineticsSpeciesName(size_t k) const
 
 size_t Kinetics::kineticsSpeciesIndex(const std::string& nm) const
 {
+    if (m_bulkAssembly) {
+        auto iter = m_speciesLookup.find(nm);
+        if (iter != m_speciesLookup.end()) {
+            return iter->second;
+        }
+    }
+    size_t kGlobal = npos;
     for (size_t n = 0; n < m_thermo.size(); n++) {
-        string id = thermo(n).id();
         // Check the ThermoPhase object for a match
         size_t k = thermo(n).speciesIndex(nm);
         if (k != npos) {
-            return k + m_start[n];
+            kGlobal = k + m_start[n];
+            break;
         }
     }
-    return npos;
+    if (m_bulkAssembly) {
+        m_speciesLookup[nm] = kGlobal;
+    }
+    return kGlobal;
 }
 
 size_t Kinetics::kineticsSpeciesIndex(const std::string& nm,
@@ -456,11 +467,13 @@ void Kinetics::resizeSpecies()
 
 bool Kinetics::addReaction(shared_ptr<Reaction> r)
 {
-    r->validate();
-    if (m_kk == 0) {
-        init();
+    if (!m_bulkAssembly) {
+        r->validate();
+        if (m_kk == 0) {
+            init();
+        }
+        resizeSpecies();
     }
-    resizeSpecies();
 
     // If reaction orders are specified, then this reaction does not follow
     // mass-action kinetics, and is not an elementary reaction. So check that it
@@ -554,6 +567,47 @@ bool Kinetics::addReaction(shared_ptr<Reaction> r)
     return true;
 }
 
+size_t Kinetics::addReactions(const std::vector<shared_ptr<Reaction>>& reactions)
+{
+    if (reactions.empty()) {
+        return 0;
+    }
+    for (const auto& r : reactions) {
+        r->validate();
+    }
+    if (m_kk == 0) {
+        init();
+    }
+    resizeSpecies();
+    reserveReactions(nReactions() + reactions.size());
+
+    size_t nAdded = 0;
+    m_bulkAssembly = true;
+    try {
+        for (const auto& r : reactions) {
+            nAdded += addReaction(r);
+        }
+    } catch (...) {
+        m_bulkAssembly = false;
+        m_speciesLookup.clear();
+        throw;
+    }
+    m_bulkAssembly = false;
+    m_speciesLookup.clear();
+    return nAdded;
+}
+
+void Kinetics::reserveReactions(size_t n)
+{
+    m_reactions.reserve(n);
+    m_rfn.reserve(n);
+    m_rkcn.reserve(n);
+    m_ropf.reserve(n);
+    m_ropr.reserve(n);
+    m_ropnet.reserve(n);
+    m_perturb.reserve(n);
+}
+
 void Kinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
 {
     checkReactionIndex(i);
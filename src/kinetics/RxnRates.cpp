@@ -65,6 +65,7 @@ Plog::Plog(const std::multimap<double, Arrhenius>& rates)
     , logP1_(1000)
     , logP2_(-1000)
     , rDeltaP_(-1.0)
+    , single_(false)
 {
     size_t j = 0;
     rates_.reserve(rates.size());
@@ -0,0 +1,303 @@
+//! @file UncertaintyEnsemble.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/UncertaintyEnsemble.h"
+#include "cantera/kinetics/Kinetics.h"
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <thread>
+
+using namespace std;
+
+namespace Cantera
+{
+
+EnsembleStatistics::EnsembleStatistics(size_t nOutputs, size_t nParameters) :
+    m_count(0),
+    m_mean(nOutputs, 0.0),
+    m_M2(nOutputs, 0.0),
+    m_min(nOutputs, Undef),
+    m_max(nOutputs, Undef),
+    m_pmean(nParameters, 0.0),
+    m_pM2(nParameters, 0.0),
+    m_C(nOutputs * nParameters, 0.0)
+{
+}
+
+void EnsembleStatistics::add(const double* y, const double* p)
+{
+    size_t ny = nOutputs();
+    size_t np = nParameters();
+    m_count++;
+    double n = static_cast<double>(m_count);
+    vector_fp dy(ny);
+    for (size_t i = 0; i < ny; i++) {
+        dy[i] = y[i] - m_mean[i];
+        m_mean[i] += dy[i] / n;
+        m_M2[i] += dy[i] * (y[i] - m_mean[i]);
+        if (m_count == 1) {
+            m_min[i] = m_max[i] = y[i];
+        } else {
+            m_min[i] = std::min(m_min[i], y[i]);
+            m_max[i] = std::max(m_max[i], y[i]);
+        }
+    }
+    for (size_t j = 0; j < np; j++) {
+        double dp = p[j] - m_pmean[j];
+        m_pmean[j] += dp / n;
+        double dp_new = p[j] - m_pmean[j];
+        m_pM2[j] += dp * dp_new;
+        // Co-moments use the deviation of the output from its old mean and
+        // of the parameter from its new mean
+        for (size_t i = 0; i < ny; i++) {
+            m_C[i*np + j] += dy[i] * dp_new;
+        }
+    }
+}
+
+void EnsembleStatistics::merge(const EnsembleStatistics& other)
+{
+    if (other.nOutputs() != nOutputs() ||
+        other.nParameters() != nParameters()) {
+        throw CanteraError("EnsembleStatistics::merge",
+            "Statistics have different numbers of outputs or parameters.");
+    }
+    if (other.m_count == 0) {
+        return;
+    } else if (m_count == 0) {
+        *this = other;
+        return;
+    }
+    size_t ny = nOutputs();
+    size_t np = nParameters();
+    double na = static_cast<double>(m_count);
+    double nb = static_cast<double>(other.m_count);
+    double n = na + nb;
+    vector_fp dy(ny), dp(np);
+    for (size_t i = 0; i < ny; i++) {
+        dy[i] = other.m_mean[i] - m_mean[i];
+    }
+    for (size_t j = 0; j < np; j++) {
+        dp[j] = other.m_pmean[j] - m_pmean[j];
+    }
+    for (size_t i = 0; i < ny; i++) {
+        for (size_t j = 0; j < np; j++) {
+            m_C[i*np + j] += other.m_C[i*np + j] + dy[i] * dp[j] * na * nb / n;
+        }
+        m_mean[i] += dy[i] * nb / n;
+        m_M2[i] += other.m_M2[i] + dy[i] * dy[i] * na * nb / n;
+        m_min[i] = std::min(m_min[i], other.m_min[i]);
+        m_max[i] = std::max(m_max[i], other.m_max[i]);
+    }
+    for (size_t j = 0; j < np; j++) {
+        m_pmean[j] += dp[j] * nb / n;
+        m_pM2[j] += other.m_pM2[j] + dp[j] * dp[j] * na * nb / n;
+    }
+    m_count += other.m_count;
+}
+
+double EnsembleStatistics::variance(size_t i) const
+{
+    return (m_count > 1) ? m_M2[i] / (m_count - 1) : 0.0;
+}
+
+double EnsembleStatistics::covariance(size_t i, size_t j) const
+{
+    return (m_count > 1) ? m_C[i*nParameters() + j] / (m_count - 1) : 0.0;
+}
+
+double EnsembleStatistics::correlation(size_t i, size_t j) const
+{
+    double d = std::sqrt(m_M2[i] * m_pM2[j]);
+    return (d > 0) ? m_C[i*nParameters() + j] / d : 0.0;
+}
+
+// ---------- UncertaintyEnsemble ----------
+
+UncertaintyEnsemble::UncertaintyEnsemble(size_t nReactions) :
+    m_sigma(nReactions, 0.0),
+    m_seed(0),
+    m_nThreads(1)
+{
+}
+
+void UncertaintyEnsemble::setUncertaintyFactor(size_t i, double f)
+{
+    if (i >= nParameters()) {
+        throw IndexError("UncertaintyEnsemble::setUncertaintyFactor",
+                         "reactions", i, nParameters()-1);
+    } else if (f < 1.0) {
+        throw CanteraError("UncertaintyEnsemble::setUncertaintyFactor",
+            "Uncertainty factor of reaction {} must be at least 1. Got {}.",
+            i, f);
+    }
+    m_sigma[i] = 0.5 * std::log(f);
+    m_perturbed.clear();
+    for (size_t j = 0; j < nParameters(); j++) {
+        if (m_sigma[j] > 0) {
+            m_perturbed.push_back(j);
+        }
+    }
+}
+
+void UncertaintyEnsemble::setUncertaintyFactors(const vector_fp& f)
+{
+    if (f.size() != nParameters()) {
+        throw CanteraError("UncertaintyEnsemble::setUncertaintyFactors",
+            "Got {} uncertainty factors for {} reactions.", f.size(),
+            nParameters());
+    }
+    for (size_t i = 0; i < f.size(); i++) {
+        setUncertaintyFactor(i, f[i]);
+    }
+}
+
+void UncertaintyEnsemble::getLogMultipliers(size_t sample, double* lnm) const
+{
+    std::fill(lnm, lnm + nParameters(), 0.0);
+    // Seed a separate generator for each sample, so that the parameters of
+    // a sample do not depend on which samples were drawn before it
+    uint64_t s = sample;
+    uint64_t seed = m_seed;
+    seed_seq seq{uint32_t(seed), uint32_t(seed >> 32),
+                 uint32_t(s), uint32_t(s >> 32)};
+    mt19937_64 gen(seq);
+    normal_distribution<double> normal;
+    for (size_t i : m_perturbed) {
+        lnm[i] = m_sigma[i] * normal(gen);
+    }
+}
+
+void UncertaintyEnsemble::getFwdRateConstants(Kinetics& kin, size_t first,
+                                              size_t n, double* kf) const
+{
+    size_t nr = nParameters();
+    if (kin.nReactions() != nr) {
+        throw CanteraError("UncertaintyEnsemble::getFwdRateConstants",
+            "Kinetics manager has {} reactions. Expected {}.",
+            kin.nReactions(), nr);
+    }
+    // Nominal rate constants, evaluated with unit multipliers
+    vector_fp kf0(nr), lnm(nr), mult(nr);
+    for (size_t i = 0; i < nr; i++) {
+        mult[i] = kin.multiplier(i);
+        kin.setMultiplier(i, 1.0);
+    }
+    kin.getFwdRateConstants(kf0.data());
+    for (size_t i = 0; i < nr; i++) {
+        kin.setMultiplier(i, mult[i]);
+    }
+    for (size_t s = 0; s < n; s++) {
+        getLogMultipliers(first + s, lnm.data());
+        double* k = kf + s*nr;
+        for (size_t i = 0; i < nr; i++) {
+            k[i] = kf0[i] * std::exp(lnm[i]);
+        }
+    }
+}
+
+void UncertaintyEnsemble::run(size_t nSamples,
+    const function<unique_ptr<EnsembleModel>()>& factory)
+{
+    size_t nThreads = m_nThreads;
+    if (nThreads == 0) {
+        nThreads = std::max<size_t>(thread::hardware_concurrency(), 1);
+    }
+    nThreads = std::max<size_t>(std::min(nThreads, nSamples), 1);
+
+    // Create the models from this thread, since constructing Cantera objects
+    // from input files is not necessarily thread-safe
+    vector<unique_ptr<EnsembleModel>> models;
+    for (size_t t = 0; t < nThreads; t++) {
+        models.push_back(factory());
+        if (models.back()->kinetics().nReactions() != nParameters()) {
+            throw CanteraError("UncertaintyEnsemble::run",
+                "Model has {} reactions. Expected {}.",
+                models.back()->kinetics().nReactions(), nParameters());
+        }
+    }
+    size_t ny = models[0]->nOutputs();
+    size_t nr = nParameters();
+    m_failed.clear();
+    m_censored.clear();
+
+    // Solve the nominal case once, and share it with the other models
+    for (auto& model : models) {
+        for (size_t i = 0; i < nr; i++) {
+            model->kinetics().setMultiplier(i, 1.0);
+        }
+    }
+    m_nominal.assign(ny, 0.0);
+    models[0]->solveNominal(m_nominal.data());
+    vector<bool> copied(nThreads, true);
+    for (size_t t = 1; t < nThreads; t++) {
+        copied[t] = models[t]->copyNominal(*models[0]);
+    }
+
+    atomic<size_t> next(0);
+    vector<EnsembleStatistics> stats(nThreads,
+                                     EnsembleStatistics(ny, nParameters()));
+    vector<exception_ptr> errors(nThreads);
+    mutex listLock;
+
+    auto work = [&](size_t t) {
+        try {
+            EnsembleModel& model = *models[t];
+            Kinetics& kin = model.kinetics();
+            vector_fp y(ny), lnm(nr);
+            if (!copied[t]) {
+                model.solveNominal(y.data());
+            }
+            size_t s;
+            while ((s = next.fetch_add(1)) < nSamples) {
+                getLogMultipliers(s, lnm.data());
+                for (size_t i : m_perturbed) {
+                    kin.setMultiplier(i, std::exp(lnm[i]));
+                }
+                try {
+                    model.solve(y.data());
+                    stats[t].add(y.data(), lnm.data());
+                } catch (CensoredSampleError&) {
+                    lock_guard<mutex> lock(listLock);
+                    m_censored.push_back(s);
+                } catch (CanteraError&) {
+                    lock_guard<mutex> lock(listLock);
+                    m_failed.push_back(s);
+                }
+            }
+            for (size_t i = 0; i < nr; i++) {
+                kin.setMultiplier(i, 1.0);
+            }
+        } catch (...) {
+            errors[t] = current_exception();
+            // Stop the other threads from taking new samples
+            next.store(nSamples);
+        }
+    };
+
+    vector<thread> threads;
+    for (size_t t = 1; t < nThreads; t++) {
+        threads.emplace_back(work, t);
+    }
+    work(0);
+    for (auto& th : threads) {
+        th.join();
+    }
+    for (auto& err : errors) {
+        if (err) {
+            rethrow_exception(err);
+        }
+    }
+
+    m_stats = EnsembleStatistics(ny, nParameters());
+    for (auto& st : stats) {
+        m_stats.merge(st);
+    }
+    sort(m_failed.begin(), m_failed.end());
+    sort(m_censored.begin(), m_censored.end());
+}
+
+}
@@ -77,9 +77,11 @@ bool installReactionArrays(const XML_Node& p, Kinetics& kin,
         vector<XML_Node*> incl = rxns.getChildren("include");
         vector<XML_Node*> allrxns = rdata->getChildren("reaction");
         // if no 'include' directive, then include all reactions
+        vector<shared_ptr<Reaction>> reactions;
         if (incl.empty()) {
+            reactions.reserve(allrxns.size());
             for (size_t i = 0; i < allrxns.size(); i++) {
-                kin.addReaction(newReaction(*allrxns[i]));
+                reactions.push_back(newReaction(*allrxns[i]));
                 ++itot;
             }
         } else {
@@ -110,13 +112,14 @@ bool installReactionArrays(const XML_Node& p, Kinetics& kin,
                         // do a lexical min max and operation. This sometimes
                         // has surprising results.
                         if ((rxid >= imin) && (rxid <= imax)) {
-                            kin.addReaction(newReaction(*r));
+                            reactions.push_back(newReaction(*r));
                             ++itot;
                         }
                     }
                 }
             }
         }
+        kin.addReactions(reactions);
     }
 
     if (check_for_duplicates) {
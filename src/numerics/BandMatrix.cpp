@@ -6,6 +6,7 @@
 #include "cantera/numerics/BandMatrix.h"
 #include "cantera/base/utilities.h"
 #include "cantera/base/stringUtils.h"
+#include "cantera/base/Tracer.h"
 
 #if CT_USE_LAPACK
     #include "cantera/numerics/ctlapack.h"
@@ -228,6 +229,7 @@ void BandMatrix::leftMult(const doublereal* const b, doublereal* const prod) con
 
 int BandMatrix::factor()
 {
+    TraceSpan span("BandMatrix::factor", "numerics");
     ludata = data;
 #if CT_USE_LAPACK
     ct_dgbtrf(nRows(), nColumns(), nSubDiagonals(), nSuperDiagonals(),
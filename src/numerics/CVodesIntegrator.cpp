@@ -5,6 +5,7 @@
 
 #include "cantera/numerics/CVodesIntegrator.h"
 #include "cantera/base/stringUtils.h"
+#include "cantera/base/Tracer.h"
 
 #include <iostream>
 using namespace std;
@@ -46,10 +47,21 @@ extern "C" {
      */
     static int cvodes_rhs(realtype t, N_Vector y, N_Vector ydot, void* f_data)
     {
-        FuncEval* f = (FuncEval*) f_data;
+        FuncEval* f = ((CVodesIntegrator*) f_data)->funcEval();
         return f->eval_nothrow(t, NV_DATA_S(y), NV_DATA_S(ydot));
     }
 
+    //! Function called by cvodes to evaluate the dense Jacobian when warm
+    //! restarts are enabled, so that the Jacobian can be saved and reused by
+    //! the next integration.
+    static int cvodes_jac(sd_size_t N, realtype t, N_Vector y, N_Vector fy,
+                          DlsMat J, void* f_data, N_Vector tmp1,
+                          N_Vector tmp2, N_Vector tmp3)
+    {
+        CVodesIntegrator* integrator = (CVodesIntegrator*) f_data;
+        return integrator->evalJacobian(t, y, fy, J->cols, tmp1, tmp2);
+    }
+
     //! Function called by CVodes when an error is encountered instead of
     //! writing to stdout. Here, save the error message provided by CVodes so
     //! that it can be included in the subsequently raised CanteraError.
@@ -79,6 +91,7 @@ CVodesIntegrator::CVodesIntegrator() :
     m_reltolsens(1.0e-5),
     m_abstolsens(1.0e-4),
     m_nabs(0),
+    m_h0(0.0),
     m_hmax(0.0),
     m_hmin(0.0),
     m_maxsteps(20000),
@@ -86,7 +99,14 @@ CVodesIntegrator::CVodesIntegrator() :
     m_yS(nullptr),
     m_np(0),
     m_mupper(0), m_mlower(0),
-    m_sens_ok(false)
+    m_sens_ok(false),
+    m_warmStart(false),
+    m_jacTol(0.05),
+    m_maxJacAge(20),
+    m_jacValid(false),
+    m_reuseJac(false),
+    m_jacAge(0),
+    m_nJacBuilds(0)
 {
 }
 
@@ -164,6 +184,14 @@ void CVodesIntegrator::setMethod(MethodType t)
     }
 }
 
+void CVodesIntegrator::setInitialStepSize(double h0)
+{
+    m_h0 = h0;
+    if (m_cvode_mem) {
+        CVodeSetInitStep(m_cvode_mem, h0);
+    }
+}
+
 void CVodesIntegrator::setMaxStepSize(doublereal hmax)
 {
     m_hmax = hmax;
@@ -254,6 +282,9 @@ void CVodesIntegrator::initialize(double t0, FuncEval& func)
     }
 
     func.getState(NV_DATA_S(m_y));
+    m_jacValid = false;
+    m_reuseJac = false;
+    m_nJacBuilds = 0;
 
     if (m_cvode_mem) {
         CVodeFree(&m_cvode_mem);
@@ -301,7 +332,7 @@ void CVodesIntegrator::initialize(double t0, FuncEval& func)
         }
     }
 
-    flag = CVodeSetUserData(m_cvode_mem, &func);
+    flag = CVodeSetUserData(m_cvode_mem, this);
     if (flag != CV_SUCCESS) {
         throw CanteraError("CVodesIntegrator::initialize",
                            "CVodeSetUserData failed.");
@@ -320,10 +351,21 @@ void CVodesIntegrator::initialize(double t0, FuncEval& func)
 
 void CVodesIntegrator::reinitialize(double t0, FuncEval& func)
 {
+    // Step size used at the end of the previous integration
+    double hlast = 0.0;
+    if (m_warmStart && m_time != m_t0) {
+        CVodeGetLastStep(m_cvode_mem, &hlast);
+    }
+
     m_t0 = t0;
     m_time = t0;
     func.getState(NV_DATA_S(m_y));
+    if (&func != m_func || func.m_sens_params != m_jacParams) {
+        // The saved Jacobian belongs to a different system of equations
+        m_jacValid = false;
+    }
     m_func = &func;
+    m_nJacBuilds = 0;
     func.clearErrors();
 
     int result = CVodeReInit(m_cvode_mem, m_t0, m_y);
@@ -331,7 +373,94 @@ void CVodesIntegrator::reinitialize(double t0, FuncEval& func)
         throw CanteraError("CVodesIntegrator::reinitialize",
                            "CVodeReInit failed. result = {}", result);
     }
-    applyOptions();
+    if (!m_warmStart) {
+        applyOptions();
+        return;
+    }
+
+    // The linear solver and the other options are retained by CVodeReInit.
+    // Start with the last step size, and decide whether the saved Jacobian
+    // can be used for the first step of the new integration.
+    CVodeSetInitStep(m_cvode_mem, (m_h0 > 0) ? m_h0 : std::abs(hlast));
+    m_reuseJac = false;
+    if (m_jacValid && m_jacAge < m_maxJacAge) {
+        double dmax = 0.0;
+        for (size_t i = 0; i < m_neq; i++) {
+            double atol = (m_itol == CV_SV) ? NV_Ith_S(m_abstol, i) : m_abstols;
+            double scale = std::abs(m_jacState[i]) + atol / m_reltol;
+            dmax = std::max(dmax, std::abs(NV_Ith_S(m_y, i) - m_jacState[i]) / scale);
+        }
+        if (dmax <= m_jacTol) {
+            m_reuseJac = true;
+            m_jacAge++;
+        }
+    }
+}
+
+void CVodesIntegrator::setWarmRestart(bool warm, double jacTol, int maxJacAge)
+{
+    m_warmStart = warm;
+    m_jacTol = jacTol;
+    m_maxJacAge = maxJacAge;
+    m_reuseJac = false;
+    if (m_cvode_mem && m_type == DENSE + NOJAC) {
+        CVDlsSetDenseJacFn(m_cvode_mem, warm ? cvodes_jac : nullptr);
+    }
+    if (m_cvode_mem && !warm) {
+        // Restore the initial step size set by the user, or the default
+        // estimate
+        CVodeSetInitStep(m_cvode_mem, m_h0);
+    }
+}
+
+int CVodesIntegrator::evalJacobian(double t, N_Vector y, N_Vector fy,
+                                   double** jac, N_Vector ewt, N_Vector ftemp)
+{
+    if (m_reuseJac && m_jacValid) {
+        // First Jacobian requested after a warm restart
+        m_reuseJac = false;
+        for (size_t j = 0; j < m_neq; j++) {
+            std::copy(&m_jac[j*m_neq], &m_jac[(j+1)*m_neq], jac[j]);
+        }
+        return 0;
+    }
+    m_reuseJac = false;
+
+    // Finite difference Jacobian, using the same increments as the internal
+    // difference quotient Jacobian of CVODES
+    double h;
+    CVodeGetCurrentStep(m_cvode_mem, &h);
+    CVodeGetErrWeights(m_cvode_mem, ewt);
+    double srur = sqrt(UNIT_ROUNDOFF);
+    double fnorm = N_VWrmsNorm(fy, ewt);
+    double minInc = (fnorm != 0.0) ?
+        1000.0 * std::abs(h) * UNIT_ROUNDOFF * m_neq * fnorm : 1.0;
+    double* ydata = NV_DATA_S(y);
+    double* fdata = NV_DATA_S(fy);
+    double* ftmp = NV_DATA_S(ftemp);
+    m_jac.resize(m_neq * m_neq);
+    m_jacState.assign(ydata, ydata + m_neq);
+    m_jacParams = m_func->m_sens_params;
+    m_nJacBuilds++;
+    for (size_t j = 0; j < m_neq; j++) {
+        double ysave = ydata[j];
+        double inc = std::max(srur * std::abs(ysave),
+                              minInc / NV_Ith_S(ewt, j));
+        ydata[j] += inc;
+        int flag = m_func->eval_nothrow(t, ydata, ftmp);
+        ydata[j] = ysave;
+        if (flag != 0) {
+            m_jacValid = false;
+            return flag;
+        }
+        double rinc = 1.0 / inc;
+        for (size_t i = 0; i < m_neq; i++) {
+            jac[j][i] = m_jac[j*m_neq + i] = (ftmp[i] - fdata[i]) * rinc;
+        }
+    }
+    m_jacValid = true;
+    m_jacAge = 0;
+    return 0;
 }
 
 void CVodesIntegrator::applyOptions()
@@ -343,6 +472,9 @@ void CVodesIntegrator::applyOptions()
         #else
             CVDense(m_cvode_mem, N);
         #endif
+        if (m_warmStart) {
+            CVDlsSetDenseJacFn(m_cvode_mem, cvodes_jac);
+        }
     } else if (m_type == DIAG) {
         CVDiag(m_cvode_mem);
     } else if (m_type == GMRES) {
@@ -364,6 +496,9 @@ void CVodesIntegrator::applyOptions()
     if (m_maxord > 0) {
         CVodeSetMaxOrd(m_cvode_mem, m_maxord);
     }
+    if (m_h0 > 0) {
+        CVodeSetInitStep(m_cvode_mem, m_h0);
+    }
     if (m_maxsteps > 0) {
         CVodeSetMaxNumSteps(m_cvode_mem, m_maxsteps);
     }
@@ -380,6 +515,7 @@ void CVodesIntegrator::applyOptions()
 
 void CVodesIntegrator::integrate(double tout)
 {
+    TraceSpan span("CVodesIntegrator::integrate", "numerics");
     if (tout == m_time) {
         return;
     }
@@ -424,6 +560,38 @@ int CVodesIntegrator::nEvals() const
     return ne;
 }
 
+int CVodesIntegrator::nSteps() const
+{
+    long int ns;
+    CVodeGetNumSteps(m_cvode_mem, &ns);
+    return ns;
+}
+
+int CVodesIntegrator::nNonlinIters() const
+{
+    long int ni;
+    CVodeGetNumNonlinSolvIters(m_cvode_mem, &ni);
+    return ni;
+}
+
+int CVodesIntegrator::nJacBuilds() const
+{
+    if (m_warmStart && m_type == DENSE + NOJAC) {
+        return m_nJacBuilds;
+    }
+    // CVODES computes every Jacobian that it requests
+    return nJacEvals();
+}
+
+int CVodesIntegrator::nJacEvals() const
+{
+    long int nje = 0;
+    if (m_type == DENSE + NOJAC || m_type == BAND + NOJAC) {
+        CVDlsGetNumJacEvals(m_cvode_mem, &nje);
+    }
+    return nje;
+}
+
 double CVodesIntegrator::sensitivity(size_t k, size_t p)
 {
     if (m_time == m_t0) {
@@ -0,0 +1,242 @@
+//! @file ExtrapolationIntegrator.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/numerics/ExtrapolationIntegrator.h"
+
+#include <limits>
+
+using namespace std;
+
+namespace
+{
+
+// Number of substeps of column j of the extrapolation table
+inline double nSubsteps(size_t j)
+{
+    return j + 1.0;
+}
+
+// Work for computing columns 0 through j, counted as the number of
+// right-hand side evaluations plus one for each factorization
+inline double columnWork(size_t j)
+{
+    return 0.5 * (j + 1.0) * (j + 4.0);
+}
+
+// Step size control: safety factors and bounds on the step size ratio
+const double safety1 = 0.94;
+const double safety2 = 0.65;
+const double facMin = 0.2; // smallest ratio hnew / h
+const double facMax = 10.0; // largest ratio hnew / h
+
+}
+
+namespace Cantera
+{
+
+ExtrapolationIntegrator::ExtrapolationIntegrator() :
+    m_kmax(0),
+    m_kopt(2),
+    m_klast(0),
+    m_rejected(false)
+{
+    setMaxOrder(6);
+}
+
+void ExtrapolationIntegrator::setMaxOrder(int n)
+{
+    if (n < 3) {
+        throw CanteraError("ExtrapolationIntegrator::setMaxOrder",
+            "The maximum order must be at least 3. Got {}.", n);
+    }
+    m_kmax = n;
+    m_table.resize(m_kmax);
+    m_work.resize(m_kmax);
+    m_hopt.resize(m_kmax);
+    m_kopt = std::min(m_kopt, m_kmax - 2);
+}
+
+void ExtrapolationIntegrator::resetMethod()
+{
+    m_kopt = std::min<size_t>(2, m_kmax - 2);
+    m_rejected = false;
+}
+
+bool ExtrapolationIntegrator::computeColumn(size_t j, double H)
+{
+    double nj = nSubsteps(j);
+    double h = H / nj;
+    if (!factor(1.0 / h)) {
+        return false;
+    }
+    vector_fp& yj = m_table[j];
+    yj = m_y;
+    double del0 = 0.0;
+    for (size_t m = 0; m < nj; m++) {
+        if (m == 0) {
+            m_del = m_f0;
+        } else if (!evalRHS(m_t + m * h, yj.data(), m_del.data())) {
+            return false;
+        } else if (m == 1 && j == 1) {
+            // Stability check of SEULEX: a simplified Newton iteration for
+            // the implicit Euler equation of the first substep must contract
+            for (size_t i = 0; i < m_neq; i++) {
+                m_ytmp[i] = m_del[i] - m_ytmp[i] / h;
+            }
+            solveFactored(m_ytmp.data());
+            double theta = errorNorm(m_ytmp.data(), m_y.data(), yj.data())
+                / std::max(del0, std::numeric_limits<double>::epsilon());
+            if (theta > 1.0) {
+                return false;
+            }
+        }
+        for (size_t i = 0; i < m_neq; i++) {
+            m_del[i] += h * m_dfdt[i];
+        }
+        solveFactored(m_del.data());
+        if (m == 0 && j == 1) {
+            m_ytmp = m_del;
+            del0 = errorNorm(m_del.data(), m_y.data(), m_y.data());
+        }
+        for (size_t i = 0; i < m_neq; i++) {
+            yj[i] += m_del[i];
+        }
+    }
+
+    // Aitken-Neville extrapolation, overwriting the values from the
+    // previous column
+    for (size_t l = j; l > 0; l--) {
+        double fac = nj / nSubsteps(l-1) - 1.0;
+        vector_fp& upper = m_table[l];
+        vector_fp& lower = m_table[l-1];
+        for (size_t i = 0; i < m_neq; i++) {
+            lower[i] = upper[i] + (upper[i] - lower[i]) / fac;
+        }
+    }
+    return true;
+}
+
+void ExtrapolationIntegrator::takeStep(double tmax)
+{
+    size_t n = m_neq;
+    if (m_f0.size() != n) {
+        m_f0.resize(n);
+        m_dfdt.resize(n);
+        m_del.resize(n);
+    }
+    double* y = m_y.data();
+
+    bool first = (m_h == 0.0);
+    if (first) {
+        if (!evalRHS(m_t, y, m_f0.data())) {
+            throw CanteraError("ExtrapolationIntegrator::takeStep",
+                "Right-hand side evaluation failed at the initial state:\n{}",
+                m_func->getErrors());
+        }
+        m_h = initialStepSize(tmax, m_f0.data(), static_cast<int>(m_kopt) + 1);
+        m_rejected = false;
+    }
+
+    // The Jacobian is reused when a step is retried
+    bool haveJac = false;
+    while (true) {
+        double Hprop = (m_hmax > 0) ? std::min(m_h, m_hmax) : m_h;
+        double H = Hprop;
+        bool last = false;
+        if (m_t + H * (1 + 1e-8) >= tmax) {
+            H = tmax - m_t;
+            last = true;
+        }
+
+        if (!haveJac) {
+            if (!evalJacobian(m_t, y, m_f0.data())) {
+                rejectStep(H, "Jacobian evaluation failed");
+                m_h = 0.5 * H;
+                continue;
+            }
+            if (!evalTimeDerivative(m_t, y, m_f0.data(), m_dfdt.data(), H)) {
+                rejectStep(H, "right-hand side evaluation failed");
+                m_h = 0.5 * H;
+                continue;
+            }
+            haveJac = true;
+        }
+
+        // Compute columns until the error test is passed, checking the
+        // columns around the current optimal one
+        size_t jmax = std::min(m_kopt + 1, m_kmax - 1);
+        size_t kconv = npos;
+        bool failed = false;
+        for (size_t j = 0; j <= jmax; j++) {
+            if (!computeColumn(j, H)) {
+                failed = true;
+                break;
+            }
+            if (j == 0) {
+                continue;
+            }
+            for (size_t i = 0; i < n; i++) {
+                m_del[i] = m_table[0][i] - m_table[1][i];
+            }
+            double err = errorNorm(m_del.data(), y, m_table[0].data());
+            double fac = pow(err / safety2, 1.0 / (j + 1)) / safety1;
+            fac = std::max(1.0 / facMax, std::min(1.0 / facMin, fac));
+            m_hopt[j] = H / fac;
+            m_work[j] = columnWork(j) / m_hopt[j];
+            if (j + 1 >= m_kopt && err <= 1.0) {
+                kconv = j;
+                break;
+            }
+        }
+
+        if (failed) {
+            rejectStep(H, "linearly implicit Euler iteration failed");
+            m_rejected = true;
+            m_h = 0.5 * H;
+            continue;
+        } else if (kconv == npos) {
+            rejectStep(H, "error test failed");
+            m_rejected = true;
+            m_h = first ? 0.1 * H : m_hopt[m_kopt];
+            continue;
+        }
+
+        // Accept the step
+        m_t = last ? tmax : m_t + H;
+        m_y.swap(m_table[0]);
+        m_nsteps++;
+        m_nfails = 0;
+        m_klast = kconv;
+
+        // Choose the order and step size which minimize the work per unit
+        // step. The order is increased only if the work decreased with the
+        // order so far.
+        size_t k = kconv;
+        size_t knew = k;
+        double Hnew = m_hopt[k];
+        if (k >= 2 && m_work[k-1] < 0.8 * m_work[k]) {
+            knew = k - 1;
+            Hnew = m_hopt[k-1];
+        } else if (k + 2 < m_kmax && !m_rejected &&
+                   (k == 1 || m_work[k] < 0.9 * m_work[k-1])) {
+            knew = k + 1;
+            Hnew = m_hopt[k] * columnWork(k + 1) / columnWork(k);
+        }
+        if (m_rejected) {
+            Hnew = std::min(Hnew, H);
+        }
+        m_rejected = false;
+        m_kopt = std::max<size_t>(1, std::min(knew, m_kmax - 2));
+        if (m_kopt != knew) {
+            Hnew = m_hopt[m_kopt];
+        }
+        // A step shortened to reach the output time does not limit the
+        // size of the following step, unless the error requires it
+        m_h = (last && Hnew >= H) ? std::max(Hnew, Hprop) : Hnew;
+        return;
+    }
+}
+
+}
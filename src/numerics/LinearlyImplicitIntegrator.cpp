@@ -0,0 +1,295 @@
+//! @file LinearlyImplicitIntegrator.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/numerics/LinearlyImplicitIntegrator.h"
+#include "cantera/base/Tracer.h"
+
+#if CT_USE_LAPACK
+    #include "cantera/numerics/ctlapack.h"
+#else
+    #if SUNDIALS_USE_LAPACK
+        #include "cvodes/cvodes_lapack.h"
+    #else
+        #include "cvodes/cvodes_dense.h"
+    #endif
+#endif
+
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+namespace Cantera
+{
+
+LinearlyImplicitIntegrator::LinearlyImplicitIntegrator() :
+    m_func(0),
+    m_neq(0),
+    m_t(0.0),
+    m_h(0.0),
+    m_rtol(1.0e-9),
+    m_h0(0.0),
+    m_hmax(0.0),
+    m_hmin(0.0),
+    m_maxsteps(20000),
+    m_maxfails(0),
+    m_warm(false),
+    m_userJac(true),
+    m_nevals(0),
+    m_nsteps(0),
+    m_njac(0),
+    m_nrejected(0),
+    m_nfactor(0),
+    m_nfails(0)
+{
+}
+
+void LinearlyImplicitIntegrator::setTolerances(double reltol, size_t n,
+                                               double* abstol)
+{
+    m_rtol = reltol;
+    m_atol.assign(abstol, abstol + n);
+}
+
+void LinearlyImplicitIntegrator::setTolerances(double reltol, double abstol)
+{
+    m_rtol = reltol;
+    m_atol.assign(1, abstol);
+}
+
+void LinearlyImplicitIntegrator::initialize(double t0, FuncEval& func)
+{
+    if (func.nparams() > 0) {
+        throw CanteraError("LinearlyImplicitIntegrator::initialize",
+            "Sensitivity analysis is not supported by this integrator.");
+    }
+    m_func = &func;
+    m_neq = func.neq();
+    m_y.resize(m_neq);
+    m_ftmp.resize(m_neq);
+    m_ytmp.resize(m_neq);
+    m_jac.resize(m_neq, m_neq);
+    m_M.resize(m_neq, m_neq);
+    m_pivots.resize(m_neq);
+    if (m_atol.size() != m_neq) {
+        if (m_atol.size() == 1) {
+            m_atol.assign(m_neq, m_atol[0]);
+        } else {
+            m_atol.assign(m_neq, 1.0e-15);
+        }
+    }
+    m_userJac = true;
+    m_nevals = m_nsteps = m_njac = m_nrejected = m_nfactor = 0;
+    m_h = 0.0;
+    reinitialize(t0, func);
+}
+
+void LinearlyImplicitIntegrator::reinitialize(double t0, FuncEval& func)
+{
+    if (&func != m_func || func.neq() != m_neq) {
+        initialize(t0, func);
+        return;
+    }
+    m_t = t0;
+    func.getState(m_y.data());
+    if (!m_warm || m_h0 > 0) {
+        m_h = m_h0;
+    }
+    m_nfails = 0;
+    resetMethod();
+}
+
+void LinearlyImplicitIntegrator::integrate(double tout)
+{
+    TraceSpan span("LinearlyImplicitIntegrator::integrate", "numerics");
+    if (tout < m_t) {
+        throw CanteraError("LinearlyImplicitIntegrator::integrate",
+            "Cannot integrate backwards from t = {} to t = {}.", m_t, tout);
+    }
+    int nsteps = 0;
+    while (m_t < tout) {
+        if (++nsteps > m_maxsteps) {
+            throw CanteraError("LinearlyImplicitIntegrator::integrate",
+                "Maximum number of steps ({}) taken before reaching "
+                "t = {}. Current time is t = {}.", m_maxsteps, tout, m_t);
+        }
+        takeStep(tout);
+    }
+}
+
+double LinearlyImplicitIntegrator::step(double tout)
+{
+    takeStep(tout);
+    return m_t;
+}
+
+bool LinearlyImplicitIntegrator::evalRHS(double t, double* y, double* ydot)
+{
+    m_nevals++;
+    int flag = m_func->eval_nothrow(t, y, ydot);
+    if (flag < 0) {
+        throw CanteraError("LinearlyImplicitIntegrator::evalRHS",
+            "Unrecoverable error in the right-hand side function:\n{}",
+            m_func->getErrors());
+    }
+    return flag == 0;
+}
+
+bool LinearlyImplicitIntegrator::evalJacobian(double t, double* y,
+                                              double* ydot)
+{
+    m_njac++;
+    if (m_userJac) {
+        try {
+            if (m_func->evalJacobian(t, y, ydot,
+                                     m_func->m_sens_params.data(), &m_jac)) {
+                return true;
+            }
+            m_userJac = false;
+        } catch (CanteraError&) {
+            return false;
+        }
+    }
+
+    // Forward differences. The increment is scaled by the magnitude of each
+    // component or its expected change over the next step, and by the
+    // smallest magnitude which is significant for the error test.
+    if (!evalRHS(t, y, ydot)) {
+        return false;
+    }
+    double srur = sqrt(std::numeric_limits<double>::epsilon());
+    for (size_t j = 0; j < m_neq; j++) {
+        double ysave = y[j];
+        double dy = srur * std::max({std::abs(ysave), std::abs(m_h * ydot[j]),
+                                     m_atol[j] / m_rtol});
+        y[j] = ysave + dy;
+        dy = y[j] - ysave;
+        bool ok = evalRHS(t, y, m_ftmp.data());
+        y[j] = ysave;
+        if (!ok) {
+            return false;
+        }
+        for (size_t i = 0; i < m_neq; i++) {
+            m_jac(i, j) = (m_ftmp[i] - ydot[i]) / dy;
+        }
+    }
+    return true;
+}
+
+bool LinearlyImplicitIntegrator::evalTimeDerivative(double t, double* y,
+    const double* ydot, double* dfdt, double h)
+{
+    // The step size is the time scale if the integration starts at t = 0
+    double dt = sqrt(std::numeric_limits<double>::epsilon())
+                * std::max(std::abs(t), std::abs(h));
+    if (!evalRHS(t + dt, y, m_ftmp.data())) {
+        return false;
+    }
+    for (size_t i = 0; i < m_neq; i++) {
+        dfdt[i] = (m_ftmp[i] - ydot[i]) / dt;
+    }
+    return true;
+}
+
+bool LinearlyImplicitIntegrator::factor(double c)
+{
+    m_nfactor++;
+    for (size_t j = 0; j < m_neq; j++) {
+        for (size_t i = 0; i < m_neq; i++) {
+            m_M(i, j) = -m_jac(i, j);
+        }
+        m_M(j, j) += c;
+    }
+    int info = 0;
+#if CT_USE_LAPACK
+    ct_dgetrf(m_neq, m_neq, m_M.ptrColumn(0), m_neq, m_M.ipiv().data(),
+              info);
+#else
+    info = denseGETRF(const_cast<double**>(m_M.colPts()), m_neq, m_neq,
+                      m_pivots.data());
+#endif
+    if (info < 0) {
+        throw CanteraError("LinearlyImplicitIntegrator::factor",
+                           "DGETRF returned INFO = {}", info);
+    }
+    return info == 0;
+}
+
+void LinearlyImplicitIntegrator::solveFactored(double* b)
+{
+#if CT_USE_LAPACK
+    int info = 0;
+    ct_dgetrs(ctlapack::NoTranspose, m_neq, 1, m_M.ptrColumn(0), m_neq,
+              m_M.ipiv().data(), b, m_neq, info);
+    if (info != 0) {
+        throw CanteraError("LinearlyImplicitIntegrator::solveFactored",
+                           "DGETRS returned INFO = {}", info);
+    }
+#else
+    denseGETRS(const_cast<double**>(m_M.colPts()), m_neq, m_pivots.data(), b);
+#endif
+}
+
+double LinearlyImplicitIntegrator::errorNorm(const double* err,
+    const double* y0, const double* y1) const
+{
+    double sum = 0.0;
+    for (size_t i = 0; i < m_neq; i++) {
+        double w = m_atol[i] + m_rtol * std::max(std::abs(y0[i]),
+                                                 std::abs(y1[i]));
+        sum += (err[i] / w) * (err[i] / w);
+    }
+    return sqrt(sum / std::max<size_t>(m_neq, 1));
+}
+
+double LinearlyImplicitIntegrator::initialStepSize(double tout,
+    const double* f0, int order)
+{
+    double hmax = tout - m_t;
+    if (m_hmax > 0) {
+        hmax = std::min(hmax, m_hmax);
+    }
+    double d0 = errorNorm(m_y.data(), m_y.data(), m_y.data());
+    double d1 = errorNorm(f0, m_y.data(), m_y.data());
+    double h0 = (d0 < 1e-5 || d1 < 1e-5) ? 1e-6 : 0.01 * d0 / d1;
+    h0 = std::min(h0, hmax);
+
+    // Estimate the second derivative with an explicit Euler step
+    for (size_t i = 0; i < m_neq; i++) {
+        m_ytmp[i] = m_y[i] + h0 * f0[i];
+    }
+    double h1;
+    if (evalRHS(m_t + h0, m_ytmp.data(), m_ftmp.data())) {
+        for (size_t i = 0; i < m_neq; i++) {
+            m_ftmp[i] -= f0[i];
+        }
+        double d2 = errorNorm(m_ftmp.data(), m_y.data(), m_y.data()) / h0;
+        double d = std::max(d1, d2);
+        h1 = (d <= 1e-15) ? std::max(1e-6, 1e-3 * h0)
+                          : pow(0.01 / d, 1.0 / (order + 1));
+    } else {
+        h1 = 0.01 * h0;
+    }
+    return std::max(std::min(100 * h0, h1), m_hmin);
+}
+
+void LinearlyImplicitIntegrator::rejectStep(double h, const string& reason)
+{
+    m_nrejected++;
+    m_nfails++;
+    int maxfails = (m_maxfails > 0) ? m_maxfails : 10;
+    double hmin = std::max(m_hmin, 4 * std::numeric_limits<double>::epsilon()
+                                   * std::abs(m_t));
+    if (m_nfails > maxfails || h <= hmin) {
+        string errors = m_func->getErrors();
+        m_func->clearErrors();
+        throw CanteraError("LinearlyImplicitIntegrator::rejectStep",
+            "Integration failed at t = {} with step size h = {} after {} "
+            "successive rejected steps. Last failure: {}\n{}", m_t, h,
+            m_nfails, reason, errors);
+    }
+}
+
+}
@@ -6,6 +6,8 @@
 #include "cantera/base/ct_defs.h"
 #include "cantera/numerics/Integrator.h"
 #include "cantera/numerics/CVodesIntegrator.h"
+#include "cantera/numerics/RosenbrockIntegrator.h"
+#include "cantera/numerics/ExtrapolationIntegrator.h"
 
 namespace Cantera
 {
@@ -14,6 +16,10 @@ Integrator* newIntegrator(const std::string& itype)
 {
     if (itype == "CVODE") {
         return new CVodesIntegrator();
+    } else if (itype == "Rosenbrock") {
+        return new RosenbrockIntegrator();
+    } else if (itype == "Extrapolation") {
+        return new ExtrapolationIntegrator();
     } else {
         throw CanteraError("newIntegrator",
                            "unknown ODE integrator: "+itype);
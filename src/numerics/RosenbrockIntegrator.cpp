@@ -0,0 +1,217 @@
+//! @file RosenbrockIntegrator.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/numerics/RosenbrockIntegrator.h"
+
+using namespace std;
+
+namespace
+{
+
+// Coefficients of RODAS4, from the code RODAS of E. Hairer and G. Wanner
+const double gam = 0.25;
+const double c2 = 0.386, c3 = 0.21, c4 = 0.63;
+const double d1 = 0.25, d2 = -0.1043, d3 = 0.1035, d4 = -0.0362;
+const double a21 = 1.544;
+const double a31 = 0.9466785280815826, a32 = 0.2557011698983284;
+const double a41 = 3.314825187068521, a42 = 2.896124015972201,
+             a43 = 0.9986419139977817;
+const double a51 = 1.221224509226641, a52 = 6.019134481288629,
+             a53 = 12.53708332932087, a54 = -0.6878860361058950;
+const double c21 = -5.6688;
+const double c31 = -2.430093356833875, c32 = -0.2063599157091915;
+const double c41 = -0.1073529058151375, c42 = -9.594562251023355,
+             c43 = -20.47028614809616;
+const double c51 = 7.496443313967647, c52 = -10.24680431464352,
+             c53 = -33.99990352819905, c54 = 11.70890893206160;
+const double c61 = 8.083246795921522, c62 = -7.981132988064893,
+             c63 = -31.52159432874371, c64 = 16.31930543123136,
+             c65 = -6.058818238834054;
+
+// Step size control: safety factor and bounds on the step size ratio
+const double safety = 0.9;
+const double facMin = 0.2; // smallest ratio hnew / h
+const double facMax = 6.0; // largest ratio hnew / h
+
+}
+
+namespace Cantera
+{
+
+RosenbrockIntegrator::RosenbrockIntegrator() :
+    m_k(6),
+    m_hfixed(0.0),
+    m_rejected(false)
+{
+}
+
+void RosenbrockIntegrator::takeStep(double tmax)
+{
+    size_t n = m_neq;
+    if (m_f0.size() != n) {
+        for (auto& k : m_k) {
+            k.resize(n);
+        }
+        m_f0.resize(n);
+        m_dfdt.resize(n);
+    }
+    vector_fp& k1 = m_k[0];
+    vector_fp& k2 = m_k[1];
+    vector_fp& k3 = m_k[2];
+    vector_fp& k4 = m_k[3];
+    vector_fp& k5 = m_k[4];
+    vector_fp& k6 = m_k[5];
+    double* y = m_y.data();
+    double* ytmp = m_ytmp.data();
+
+    bool first = (m_h == 0.0);
+    if (first) {
+        if (!evalRHS(m_t, y, m_f0.data())) {
+            throw CanteraError("RosenbrockIntegrator::takeStep",
+                "Right-hand side evaluation failed at the initial state:\n{}",
+                m_func->getErrors());
+        }
+        m_h = (m_hfixed > 0) ? m_hfixed : initialStepSize(tmax, m_f0.data(), 4);
+        m_rejected = false;
+    }
+
+    // The Jacobian is reused when a step is retried after a failed error test
+    bool haveJac = false;
+    while (true) {
+        double hprop = (m_hfixed > 0) ? m_hfixed : m_h;
+        if (m_hmax > 0) {
+            hprop = std::min(hprop, m_hmax);
+        }
+        double h = hprop;
+        bool last = false;
+        if (m_t + h * (1 + 1e-8) >= tmax) {
+            h = tmax - m_t;
+            last = true;
+        }
+
+        // Jacobian and time derivative at the start of the step
+        if (!haveJac) {
+            if (!evalJacobian(m_t, y, m_f0.data())) {
+                rejectStep(h, "Jacobian evaluation failed");
+                m_h = 0.5 * h;
+                continue;
+            }
+            if (!evalTimeDerivative(m_t, y, m_f0.data(), m_dfdt.data(), h)) {
+                rejectStep(h, "right-hand side evaluation failed");
+                m_h = 0.5 * h;
+                continue;
+            }
+            haveJac = true;
+        }
+
+        if (!factor(1.0 / (h * gam))) {
+            rejectStep(h, "singular iteration matrix");
+            m_h = 0.5 * h;
+            continue;
+        }
+
+        // Stages. Each one solves (I/(h*gamma) - J) k_i = f(t_i, y_i)
+        // + h*d_i*df/dt + sum_j c_ij/h k_j.
+        bool ok = true;
+        for (size_t i = 0; i < n; i++) {
+            k1[i] = m_f0[i] + h * d1 * m_dfdt[i];
+        }
+        solveFactored(k1.data());
+
+        for (size_t i = 0; i < n; i++) {
+            ytmp[i] = y[i] + a21 * k1[i];
+        }
+        ok = evalRHS(m_t + c2 * h, ytmp, k2.data());
+        if (ok) {
+            for (size_t i = 0; i < n; i++) {
+                k2[i] += h * d2 * m_dfdt[i] + c21 / h * k1[i];
+            }
+            solveFactored(k2.data());
+
+            for (size_t i = 0; i < n; i++) {
+                ytmp[i] = y[i] + a31 * k1[i] + a32 * k2[i];
+            }
+            ok = evalRHS(m_t + c3 * h, ytmp, k3.data());
+        }
+        if (ok) {
+            for (size_t i = 0; i < n; i++) {
+                k3[i] += h * d3 * m_dfdt[i] + (c31 * k1[i] + c32 * k2[i]) / h;
+            }
+            solveFactored(k3.data());
+
+            for (size_t i = 0; i < n; i++) {
+                ytmp[i] = y[i] + a41 * k1[i] + a42 * k2[i] + a43 * k3[i];
+            }
+            ok = evalRHS(m_t + c4 * h, ytmp, k4.data());
+        }
+        if (ok) {
+            for (size_t i = 0; i < n; i++) {
+                k4[i] += h * d4 * m_dfdt[i]
+                         + (c41 * k1[i] + c42 * k2[i] + c43 * k3[i]) / h;
+            }
+            solveFactored(k4.data());
+
+            for (size_t i = 0; i < n; i++) {
+                ytmp[i] = y[i] + a51 * k1[i] + a52 * k2[i] + a53 * k3[i]
+                          + a54 * k4[i];
+            }
+            ok = evalRHS(m_t + h, ytmp, k5.data());
+        }
+        if (ok) {
+            for (size_t i = 0; i < n; i++) {
+                k5[i] += (c51 * k1[i] + c52 * k2[i] + c53 * k3[i]
+                          + c54 * k4[i]) / h;
+            }
+            solveFactored(k5.data());
+
+            // Embedded third order solution
+            for (size_t i = 0; i < n; i++) {
+                ytmp[i] += k5[i];
+            }
+            ok = evalRHS(m_t + h, ytmp, k6.data());
+        }
+        if (!ok) {
+            rejectStep(h, "right-hand side evaluation failed");
+            m_h = 0.5 * h;
+            continue;
+        }
+        for (size_t i = 0; i < n; i++) {
+            k6[i] += (c61 * k1[i] + c62 * k2[i] + c63 * k3[i] + c64 * k4[i]
+                      + c65 * k5[i]) / h;
+        }
+        solveFactored(k6.data());
+
+        // The last stage is the difference between the fourth and third
+        // order solutions
+        for (size_t i = 0; i < n; i++) {
+            ytmp[i] += k6[i];
+        }
+        double err = errorNorm(k6.data(), y, ytmp);
+        double fac = std::max(1.0 / facMax,
+                              std::min(1.0 / facMin, pow(err, 0.25) / safety));
+        double hnew = h / fac;
+
+        if (m_hfixed > 0 || err <= 1.0) {
+            m_t = last ? tmax : m_t + h;
+            m_y.swap(m_ytmp);
+            m_nsteps++;
+            m_nfails = 0;
+            if (m_rejected) {
+                hnew = std::min(hnew, h);
+            }
+            m_rejected = false;
+            // A step shortened to reach the output time does not limit the
+            // size of the following step, unless the error requires it
+            m_h = (last && hnew >= h) ? std::max(hnew, hprop) : hnew;
+            return;
+        }
+
+        rejectStep(h, "error test failed");
+        m_rejected = true;
+        m_h = first ? 0.1 * h : hnew;
+    }
+}
+
+}
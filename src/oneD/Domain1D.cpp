@@ -8,6 +8,7 @@
 #include "cantera/oneD/Domain1D.h"
 #include "cantera/oneD/MultiJac.h"
 #include "cantera/base/ctml.h"
+#include "cantera/numerics/funcs.h"
 
 using namespace std;
 
@@ -161,6 +162,44 @@ void Domain1D::restore(const XML_Node& dom, doublereal* soln, int loglevel)
     }
 }
 
+void Domain1D::mapSolution(const Domain1D& src, const doublereal* xsrc,
+                           doublereal* soln, int loglevel)
+{
+    vector_fp values(src.nPoints());
+    vector<string> missing;
+    for (size_t n = 0; n < nComponents(); n++) {
+        string name = componentName(n);
+        size_t nsrc = npos;
+        for (size_t i = 0; i < src.nComponents(); i++) {
+            if (src.componentName(i) == name) {
+                nsrc = i;
+                break;
+            }
+        }
+        if (nsrc == npos) {
+            missing.push_back(name);
+            continue;
+        }
+        for (size_t j = 0; j < src.nPoints(); j++) {
+            values[j] = src.value(xsrc, nsrc, j);
+        }
+        for (size_t j = 0; j < m_points; j++) {
+            if (src.nPoints() == 1) {
+                soln[index(n,j)] = values[0];
+            } else {
+                soln[index(n,j)] = linearInterp(m_z[j], src.grid(), values);
+            }
+        }
+    }
+    if (loglevel >= 2 && !missing.empty()) {
+        writelog("Domain '{}': no data for components:\n", id());
+        for (size_t i = 0; i < missing.size(); i++) {
+            writelog(missing[i] + " ");
+        }
+        writelog("\n");
+    }
+}
+
 void Domain1D::locate()
 {
     if (m_left) {
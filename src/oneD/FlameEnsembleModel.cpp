@@ -0,0 +1,104 @@
+//! @file FlameEnsembleModel.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/oneD/FlameEnsembleModel.h"
+#include "cantera/oneD/Sim1D.h"
+
+namespace Cantera
+{
+
+FlameEnsembleModel::FlameEnsembleModel(const OutputFunction& outputs,
+                                       size_t nOutputs) :
+    m_sim(0),
+    m_kin(0),
+    m_outputs(outputs),
+    m_nOutputs(nOutputs),
+    m_refineNominal(true),
+    m_refineSamples(false)
+{
+}
+
+void FlameEnsembleModel::setSimulation(Sim1D& sim, Kinetics& kin)
+{
+    m_sim = &sim;
+    m_kin = &kin;
+    m_grids.clear();
+    m_x0.clear();
+}
+
+Kinetics& FlameEnsembleModel::kinetics()
+{
+    if (!m_kin) {
+        throw CanteraError("FlameEnsembleModel::kinetics",
+                           "No simulation has been set.");
+    }
+    return *m_kin;
+}
+
+void FlameEnsembleModel::solveNominal(double* outputs)
+{
+    if (!m_sim) {
+        throw CanteraError("FlameEnsembleModel::solveNominal",
+                           "No simulation has been set.");
+    }
+    m_sim->solve(0, m_refineNominal);
+    m_grids.resize(m_sim->nDomains());
+    for (size_t m = 0; m < m_sim->nDomains(); m++) {
+        m_grids[m] = m_sim->domain(m).grid();
+    }
+    m_x0.assign(m_sim->solution(), m_sim->solution() + m_sim->systemSize());
+    m_outputs(*m_sim, outputs);
+}
+
+bool FlameEnsembleModel::copyNominal(const EnsembleModel& other)
+{
+    auto nominal = dynamic_cast<const FlameEnsembleModel*>(&other);
+    if (!m_sim || !nominal || nominal->m_x0.empty()
+        || nominal->m_grids.size() != m_sim->nDomains()) {
+        return false;
+    }
+    for (size_t m = 0; m < m_sim->nDomains(); m++) {
+        if (m_sim->domain(m).nComponents() !=
+            nominal->m_sim->domain(m).nComponents()) {
+            return false;
+        }
+    }
+    m_grids = nominal->m_grids;
+    m_x0 = nominal->m_x0;
+    return true;
+}
+
+void FlameEnsembleModel::solve(double* outputs)
+{
+    if (m_x0.empty()) {
+        throw CanteraError("FlameEnsembleModel::solve",
+                           "The nominal solution has not been computed.");
+    }
+    restoreNominal();
+    m_sim->solve(0, m_refineSamples);
+    m_outputs(*m_sim, outputs);
+}
+
+void FlameEnsembleModel::restoreNominal()
+{
+    bool resized = false;
+    for (size_t m = 0; m < m_sim->nDomains(); m++) {
+        Domain1D& dom = m_sim->domain(m);
+        if (dom.nPoints() != m_grids[m].size()) {
+            // The grid was refined while solving the previous sample
+            dom.resize(dom.nComponents(), m_grids[m].size());
+            resized = true;
+        }
+    }
+    if (resized) {
+        m_sim->resize();
+    }
+    for (size_t m = 0; m < m_sim->nDomains(); m++) {
+        m_sim->domain(m).setupGrid(m_grids[m].size(), m_grids[m].data());
+    }
+    m_sim->setSolution(m_x0.data());
+}
+
+}
@@ -0,0 +1,643 @@
+//! @file FlameletTable.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/oneD/FlameletTable.h"
+#include "cantera/oneD/Sim1D.h"
+#include "cantera/oneD/StFlow.h"
+#include "cantera/base/stringUtils.h"
+#include "cantera/base/utilities.h"
+#include <fstream>
+#include <numeric>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace Cantera
+{
+
+namespace {
+
+// Layout of the table file. All integers are 64-bit, in the byte order of the
+// machine that wrote the file. The header is followed by the number of nodes
+// on each axis, the names of the axes and variables (each terminated by a
+// newline), the nodes of each axis, and the tabulated values, which start at
+// a 64-byte boundary.
+const char table_magic[8] = {'C', 'T', 'F', 'L', 'T', 'B', 'L', '\0'};
+const uint64_t table_byte_order = 0x0102030405060708;
+const uint64_t table_version = 1;
+
+struct TableHeader {
+    char magic[8];
+    uint64_t byteOrder;
+    uint64_t version;
+    uint64_t nAxes;
+    uint64_t nVars;
+    uint64_t namesOffset;
+    uint64_t namesLength;
+    uint64_t axesOffset;
+    uint64_t dataOffset;
+    uint64_t fileSize;
+};
+
+size_t align(size_t offset, size_t alignment)
+{
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+enum {
+    var_T, var_rho, var_hrr, var_Y, var_wdot
+};
+
+}
+
+FlameletTableBuilder::FlameletTableBuilder(ThermoPhase& phase,
+        const vector<string>& variables, size_t nZ) :
+    m_phase(phase),
+    m_varNames(variables),
+    m_betaOx(0.0),
+    m_betaFuel(0.0)
+{
+    if (nZ < 2) {
+        throw CanteraError("FlameletTableBuilder::FlameletTableBuilder",
+            "The mixture fraction axis needs at least 2 points.");
+    }
+    vector_fp Z(nZ);
+    for (size_t i = 0; i < nZ; i++) {
+        Z[i] = double(i) / (nZ - 1);
+    }
+    m_axisNames.push_back("Z");
+    m_axes.push_back(Z);
+    m_nZ = nZ;
+
+    for (const auto& name : variables) {
+        if (name == "T") {
+            m_vars.emplace_back(var_T, npos);
+        } else if (name == "rho") {
+            m_vars.emplace_back(var_rho, npos);
+        } else if (name == "hrr") {
+            m_vars.emplace_back(var_hrr, npos);
+        } else if (name.substr(0, 5) == "wdot:") {
+            m_vars.emplace_back(var_wdot,
+                                m_phase.speciesIndex(name.substr(5)));
+        } else {
+            m_vars.emplace_back(var_Y, m_phase.speciesIndex(name));
+        }
+        if (m_vars.back().first >= var_Y && m_vars.back().second == npos) {
+            throw CanteraError("FlameletTableBuilder::FlameletTableBuilder",
+                "Unknown variable '{}'", name);
+        }
+    }
+
+    // Bilger's coupling function: 2 Z_C / W_C + Z_H / (2 W_H) - Z_O / W_O
+    vector_fp elemWeight(m_phase.nElements(), 0.0);
+    for (size_t m = 0; m < m_phase.nElements(); m++) {
+        const string& elem = m_phase.elementName(m);
+        double W = m_phase.atomicWeight(m);
+        if (elem == "C") {
+            elemWeight[m] = 2.0 / W;
+        } else if (elem == "H") {
+            elemWeight[m] = 0.5 / W;
+        } else if (elem == "O") {
+            elemWeight[m] = -1.0 / W;
+        }
+    }
+    m_spWeight.assign(m_phase.nSpecies(), 0.0);
+    for (size_t k = 0; k < m_phase.nSpecies(); k++) {
+        for (size_t m = 0; m < m_phase.nElements(); m++) {
+            m_spWeight[k] += m_phase.nAtoms(k, m) * m_phase.atomicWeight(m)
+                             * elemWeight[m];
+        }
+        m_spWeight[k] /= m_phase.molecularWeight(k);
+    }
+
+    m_data.resize(nZ * m_vars.size());
+    m_filled.assign(1, false);
+}
+
+void FlameletTableBuilder::setMixtureFractionGrid(const vector_fp& Z)
+{
+    if (Z.size() < 2) {
+        throw CanteraError("FlameletTableBuilder::setMixtureFractionGrid",
+            "The mixture fraction axis needs at least 2 points.");
+    }
+    for (size_t i = 1; i < Z.size(); i++) {
+        if (Z[i] <= Z[i-1]) {
+            throw CanteraError("FlameletTableBuilder::setMixtureFractionGrid",
+                "Mixture fraction values must be increasing.");
+        }
+    }
+    m_axes.back() = Z;
+    m_data.assign(m_data.size() / m_nZ * Z.size(), 0.0);
+    m_filled.assign(m_filled.size(), false);
+    m_nZ = Z.size();
+}
+
+void FlameletTableBuilder::setStreams(const string& fuel, const string& oxidizer)
+{
+    vector_fp Y(m_phase.nSpecies());
+    double beta[2];
+    const string* comps[2] = {&fuel, &oxidizer};
+    for (size_t i = 0; i < 2; i++) {
+        std::fill(Y.begin(), Y.end(), 0.0);
+        for (const auto& sp : parseCompString(*comps[i])) {
+            size_t k = m_phase.speciesIndex(sp.first);
+            if (k == npos) {
+                throw CanteraError("FlameletTableBuilder::setStreams",
+                    "Unknown species '{}'", sp.first);
+            }
+            Y[k] = sp.second;
+        }
+        double sum = accumulate(Y.begin(), Y.end(), 0.0);
+        if (sum <= 0.0) {
+            throw CanteraError("FlameletTableBuilder::setStreams",
+                "Empty composition '{}'", *comps[i]);
+        }
+        scale(Y.begin(), Y.end(), Y.begin(), 1.0 / sum);
+        beta[i] = bilgerBeta(Y.data());
+    }
+    if (beta[0] == beta[1]) {
+        throw CanteraError("FlameletTableBuilder::setStreams",
+            "Fuel and oxidizer streams have the same elemental composition.");
+    }
+    m_betaFuel = beta[0];
+    m_betaOx = beta[1];
+}
+
+void FlameletTableBuilder::addAxis(const string& name, const vector_fp& values)
+{
+    if (values.empty()) {
+        throw CanteraError("FlameletTableBuilder::addAxis",
+            "Axis '{}' has no nodes.", name);
+    }
+    for (size_t i = 1; i < values.size(); i++) {
+        if (values[i] <= values[i-1]) {
+            throw CanteraError("FlameletTableBuilder::addAxis",
+                "Nodes of axis '{}' must be increasing.", name);
+        }
+    }
+    if (m_axes.size() == FlameletTable::maxAxes) {
+        throw CanteraError("FlameletTableBuilder::addAxis",
+            "Tables can have at most {} axes.", FlameletTable::maxAxes);
+    }
+    m_axisNames.insert(m_axisNames.end() - 1, name);
+    m_axes.insert(m_axes.end() - 1, values);
+    m_data.assign(m_data.size() * values.size(), 0.0);
+    m_filled.assign(m_filled.size() * values.size(), false);
+}
+
+double FlameletTableBuilder::bilgerBeta(const double* Y) const
+{
+    double beta = 0.0;
+    for (size_t k = 0; k < m_phase.nSpecies(); k++) {
+        beta += m_spWeight[k] * Y[k];
+    }
+    return beta;
+}
+
+double FlameletTableBuilder::mixtureFraction(const double* Y) const
+{
+    if (m_betaFuel == m_betaOx) {
+        throw CanteraError("FlameletTableBuilder::mixtureFraction",
+            "Fuel and oxidizer streams have not been set.");
+    }
+    return (bilgerBeta(Y) - m_betaOx) / (m_betaFuel - m_betaOx);
+}
+
+void FlameletTableBuilder::addFlamelet(Sim1D& sim, size_t dom,
+                                       const vector_fp& coords)
+{
+    StFlow* flow = dynamic_cast<StFlow*>(&sim.domain(dom));
+    if (!flow) {
+        throw CanteraError("FlameletTableBuilder::addFlamelet",
+            "Domain {} is not a flow domain.", dom);
+    }
+    addFlamelet(*flow, sim.solution() + sim.start(dom), coords);
+}
+
+void FlameletTableBuilder::addFlamelet(StFlow& flow, const double* x,
+                                       const vector_fp& coords)
+{
+    if (&flow.phase() != &m_phase) {
+        throw CanteraError("FlameletTableBuilder::addFlamelet",
+            "The flow domain uses a different phase than the table.");
+    }
+    if (coords.size() != m_axes.size() - 1) {
+        throw CanteraError("FlameletTableBuilder::addFlamelet",
+            "Expected {} coordinates, got {}.", m_axes.size() - 1,
+            coords.size());
+    }
+
+    // Find the node of the table on the axes before the mixture fraction
+    size_t node = 0;
+    for (size_t i = 0; i < m_axes.size() - 1; i++) {
+        const vector_fp& axis = m_axes[i];
+        double c = coords[i];
+        double tol = 1e-10 * std::max(std::abs(axis.front()),
+                                      std::abs(axis.back()));
+        size_t n = 0;
+        while (n < axis.size() && std::abs(axis[n] - c) > tol) {
+            n++;
+        }
+        if (n == axis.size()) {
+            throw CanteraError("FlameletTableBuilder::addFlamelet",
+                "Coordinate {} is not a node of axis '{}'.", c,
+                m_axisNames[i]);
+        }
+        node = node * axis.size() + n;
+    }
+
+    // Evaluate the variables at each grid point
+    size_t np = flow.nPoints();
+    size_t nsp = m_phase.nSpecies();
+    size_t nv = m_vars.size();
+    size_t nc = flow.nComponents();
+    Kinetics& kin = flow.kinetics();
+    vector_fp Z(np), values(np * nv), wdot(nsp), h_RT(nsp);
+    for (size_t j = 0; j < np; j++) {
+        const double* Y = x + j * nc + c_offset_Y;
+        double T = x[j * nc + c_offset_T];
+        m_phase.setState_TPY(T, flow.pressure(), Y);
+        Z[j] = mixtureFraction(Y);
+        kin.getNetProductionRates(wdot.data());
+        m_phase.getEnthalpy_RT(h_RT.data());
+        double* v = &values[j * nv];
+        for (size_t i = 0; i < nv; i++) {
+            size_t k = m_vars[i].second;
+            switch (m_vars[i].first) {
+            case var_T:
+                v[i] = T;
+                break;
+            case var_rho:
+                v[i] = m_phase.density();
+                break;
+            case var_hrr:
+                v[i] = 0.0;
+                for (size_t n = 0; n < nsp; n++) {
+                    v[i] -= wdot[n] * h_RT[n];
+                }
+                v[i] *= GasConstant * T;
+                break;
+            case var_Y:
+                v[i] = Y[k];
+                break;
+            case var_wdot:
+                v[i] = wdot[k] * m_phase.molecularWeight(k);
+                break;
+            }
+        }
+    }
+
+    // Sort the grid points by mixture fraction, dropping repeated values
+    vector<size_t> order(np);
+    iota(order.begin(), order.end(), 0);
+    stable_sort(order.begin(), order.end(),
+                [&](size_t a, size_t b) { return Z[a] < Z[b]; });
+    vector<size_t> pts{order[0]};
+    for (size_t j = 1; j < np; j++) {
+        if (Z[order[j]] > Z[pts.back()]) {
+            pts.push_back(order[j]);
+        }
+    }
+
+    // Interpolate onto the mixture fraction axis
+    const vector_fp& Zaxis = m_axes.back();
+    double* out = &m_data[node * m_nZ * nv];
+    size_t m = 0;
+    for (size_t i = 0; i < Zaxis.size(); i++, out += nv) {
+        double z = Zaxis[i];
+        if (z <= Z[pts.front()] || pts.size() == 1) {
+            copy_n(&values[pts.front() * nv], nv, out);
+            continue;
+        } else if (z >= Z[pts.back()]) {
+            copy_n(&values[pts.back() * nv], nv, out);
+            continue;
+        }
+        while (Z[pts[m+1]] < z) {
+            m++;
+        }
+        size_t j0 = pts[m];
+        size_t j1 = pts[m+1];
+        double w = (z - Z[j0]) / (Z[j1] - Z[j0]);
+        for (size_t n = 0; n < nv; n++) {
+            out[n] = (1 - w) * values[j0 * nv + n] + w * values[j1 * nv + n];
+        }
+    }
+    m_filled[node] = true;
+}
+
+void FlameletTableBuilder::write(const string& filename) const
+{
+    for (size_t n = 0; n < m_filled.size(); n++) {
+        if (!m_filled[n]) {
+            throw CanteraError("FlameletTableBuilder::write",
+                "No flamelet has been added for node {} of the table.", n);
+        }
+    }
+
+    vector<uint64_t> sizes;
+    string names;
+    size_t nAxisValues = 0;
+    for (size_t i = 0; i < m_axes.size(); i++) {
+        sizes.push_back(m_axes[i].size());
+        names += m_axisNames[i] + "\n";
+        nAxisValues += m_axes[i].size();
+    }
+    for (const auto& name : m_varNames) {
+        names += name + "\n";
+    }
+
+    TableHeader header;
+    copy_n(table_magic, 8, header.magic);
+    header.byteOrder = table_byte_order;
+    header.version = table_version;
+    header.nAxes = m_axes.size();
+    header.nVars = m_vars.size();
+    header.namesOffset = sizeof(TableHeader) + sizes.size() * sizeof(uint64_t);
+    header.namesLength = names.size();
+    header.axesOffset = align(header.namesOffset + names.size(), 8);
+    header.dataOffset = align(header.axesOffset + nAxisValues * sizeof(double),
+                              64);
+    header.fileSize = header.dataOffset + m_data.size() * sizeof(double);
+
+    ofstream out(filename, ios::binary | ios::trunc);
+    if (!out) {
+        throw CanteraError("FlameletTableBuilder::write",
+            "Could not open file '{}' for writing.", filename);
+    }
+    const char zeros[64] = {};
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(sizes.data()),
+              sizes.size() * sizeof(uint64_t));
+    out.write(names.data(), names.size());
+    out.write(zeros, header.axesOffset - header.namesOffset - names.size());
+    for (const auto& axis : m_axes) {
+        out.write(reinterpret_cast<const char*>(axis.data()),
+                  axis.size() * sizeof(double));
+    }
+    out.write(zeros, header.dataOffset - header.axesOffset
+                     - nAxisValues * sizeof(double));
+    out.write(reinterpret_cast<const char*>(m_data.data()),
+              m_data.size() * sizeof(double));
+    if (!out) {
+        throw CanteraError("FlameletTableBuilder::write",
+            "Error writing file '{}'.", filename);
+    }
+}
+
+const size_t FlameletTable::maxAxes;
+
+FlameletTable::FlameletTable(const string& filename) :
+    m_nAxes(0),
+    m_nVars(0),
+    m_data(0),
+    m_map(0),
+    m_mapSize(0)
+{
+    const char* start = 0;
+    size_t size = 0;
+#ifndef _WIN32
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw CanteraError("FlameletTable::FlameletTable",
+            "Could not open file '{}'.", filename);
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        size = st.st_size;
+        void* map = mmap(0, size, PROT_READ, MAP_SHARED, fd, 0);
+        if (map != MAP_FAILED) {
+            m_map = map;
+            m_mapSize = size;
+            start = static_cast<const char*>(map);
+        }
+    }
+    ::close(fd);
+#endif
+    if (!start) {
+        ifstream in(filename, ios::binary);
+        if (!in) {
+            throw CanteraError("FlameletTable::FlameletTable",
+                "Could not open file '{}'.", filename);
+        }
+        m_buffer.assign(istreambuf_iterator<char>(in),
+                        istreambuf_iterator<char>());
+        start = m_buffer.data();
+        size = m_buffer.size();
+    }
+
+    try {
+        TableHeader header;
+        if (size < sizeof(header)) {
+            throw CanteraError("FlameletTable::FlameletTable",
+                "File '{}' is too short to be a flamelet table.", filename);
+        }
+        copy_n(start, sizeof(header), reinterpret_cast<char*>(&header));
+        if (!equal(table_magic, table_magic + 8, header.magic)) {
+            throw CanteraError("FlameletTable::FlameletTable",
+                "File '{}' is not a flamelet table.", filename);
+        } else if (header.byteOrder != table_byte_order) {
+            throw CanteraError("FlameletTable::FlameletTable",
+                "File '{}' was written on a machine with a different byte "
+                "order.", filename);
+        } else if (header.version != table_version) {
+            throw CanteraError("FlameletTable::FlameletTable",
+                "Unsupported version {} of file '{}'.", header.version,
+                filename);
+        } else if (header.fileSize != size || header.nAxes == 0 ||
+                   header.nAxes > maxAxes || header.dataOffset > size ||
+                   sizeof(header) + header.nAxes * sizeof(uint64_t) > size ||
+                   header.namesOffset > size ||
+                   header.namesLength > size - header.namesOffset ||
+                   header.axesOffset > size) {
+            // Check the offsets before reading any of the sections
+            throw CanteraError("FlameletTable::FlameletTable",
+                "File '{}' is truncated or corrupt.", filename);
+        }
+        m_nAxes = header.nAxes;
+        m_nVars = header.nVars;
+
+        const uint64_t* sizes = reinterpret_cast<const uint64_t*>(
+            start + sizeof(header));
+        size_t nNodes = 1;
+        size_t nAxisValues = 0;
+        for (size_t i = 0; i < m_nAxes; i++) {
+            m_size.push_back(sizes[i]);
+            nNodes *= sizes[i];
+            nAxisValues += sizes[i];
+        }
+        if (header.axesOffset + nAxisValues * sizeof(double) > size ||
+            header.dataOffset + nNodes * m_nVars * sizeof(double) != size) {
+            throw CanteraError("FlameletTable::FlameletTable",
+                "File '{}' is truncated or corrupt.", filename);
+        }
+
+        vector<string> names;
+        const char* name = start + header.namesOffset;
+        const char* namesEnd = name + header.namesLength;
+        while (name < namesEnd) {
+            const char* end = find(name, namesEnd, '\n');
+            names.emplace_back(name, end);
+            name = end + 1;
+        }
+        if (names.size() != m_nAxes + m_nVars) {
+            throw CanteraError("FlameletTable::FlameletTable",
+                "File '{}' is truncated or corrupt.", filename);
+        }
+        m_axisNames.assign(names.begin(), names.begin() + m_nAxes);
+        m_varNames.assign(names.begin() + m_nAxes, names.end());
+
+        const double* axis = reinterpret_cast<const double*>(
+            start + header.axesOffset);
+        m_stride.resize(m_nAxes);
+        size_t stride = m_nVars;
+        for (size_t i = m_nAxes; i-- > 0;) {
+            m_stride[i] = stride;
+            stride *= m_size[i];
+        }
+        for (size_t i = 0; i < m_nAxes; i++) {
+            m_axes.push_back(axis);
+            bool uniform = (m_size[i] > 1);
+            if (uniform) {
+                double dx = (axis[m_size[i]-1] - axis[0]) / (m_size[i] - 1);
+                for (size_t n = 1; n < m_size[i]; n++) {
+                    uniform &= (std::abs(axis[n] - axis[0] - n * dx) < 1e-10 * dx);
+                }
+            }
+            m_uniform.push_back(uniform);
+            axis += m_size[i];
+        }
+        m_data = reinterpret_cast<const double*>(start + header.dataOffset);
+    } catch (...) {
+        close();
+        throw;
+    }
+}
+
+FlameletTable::~FlameletTable()
+{
+    close();
+}
+
+void FlameletTable::close()
+{
+#ifndef _WIN32
+    if (m_map) {
+        munmap(m_map, m_mapSize);
+    }
+#endif
+    m_map = 0;
+    m_mapSize = 0;
+    m_buffer.clear();
+    m_data = 0;
+}
+
+vector_fp FlameletTable::axis(size_t i) const
+{
+    return vector_fp(m_axes.at(i), m_axes[i] + m_size[i]);
+}
+
+size_t FlameletTable::variableIndex(const string& name) const
+{
+    auto iter = find(m_varNames.begin(), m_varNames.end(), name);
+    if (iter == m_varNames.end()) {
+        return npos;
+    }
+    return iter - m_varNames.begin();
+}
+
+void FlameletTable::locate(size_t i, double x, size_t& cell,
+                           double& weight) const
+{
+    size_t n = m_size[i];
+    const double* axis = m_axes[i];
+    if (n == 1 || x <= axis[0]) {
+        cell = 0;
+        weight = 0.0;
+        return;
+    } else if (x >= axis[n-1]) {
+        cell = n - 2;
+        weight = 1.0;
+        return;
+    }
+    if (m_uniform[i]) {
+        double dx = (axis[n-1] - axis[0]) / (n - 1);
+        cell = std::min(static_cast<size_t>((x - axis[0]) / dx), n - 2);
+    } else {
+        cell = upper_bound(axis, axis + n, x) - axis - 1;
+    }
+    weight = (x - axis[cell]) / (axis[cell+1] - axis[cell]);
+}
+
+size_t FlameletTable::corners(const double* coords, size_t* offsets,
+                              double* weights) const
+{
+    offsets[0] = 0;
+    weights[0] = 1.0;
+    size_t nc = 1;
+    for (size_t i = 0; i < m_nAxes; i++) {
+        if (m_size[i] == 1) {
+            continue;
+        }
+        size_t cell;
+        double w;
+        locate(i, coords[i], cell, w);
+        size_t base = cell * m_stride[i];
+        // Each existing corner is split into a lower and an upper corner
+        for (size_t c = 0; c < nc; c++) {
+            offsets[nc + c] = offsets[c] + base + m_stride[i];
+            weights[nc + c] = weights[c] * w;
+            offsets[c] += base;
+            weights[c] *= 1.0 - w;
+        }
+        nc *= 2;
+    }
+    return nc;
+}
+
+void FlameletTable::interpolate(const double* coords, double* values) const
+{
+    size_t offsets[1 << maxAxes];
+    double weights[1 << maxAxes];
+    size_t nc = corners(coords, offsets, weights);
+    std::fill(values, values + m_nVars, 0.0);
+    for (size_t c = 0; c < nc; c++) {
+        const double* node = m_data + offsets[c];
+        double w = weights[c];
+        for (size_t n = 0; n < m_nVars; n++) {
+            values[n] += w * node[n];
+        }
+    }
+}
+
+void FlameletTable::interpolate(size_t n, const double* coords,
+                                double* values) const
+{
+    for (size_t i = 0; i < n; i++) {
+        interpolate(coords + i * m_nAxes, values + i * m_nVars);
+    }
+}
+
+double FlameletTable::value(size_t var, const double* coords) const
+{
+    if (var >= m_nVars) {
+        throw IndexError("FlameletTable::value", "variables", var, m_nVars-1);
+    }
+    size_t offsets[1 << maxAxes];
+    double weights[1 << maxAxes];
+    size_t nc = corners(coords, offsets, weights);
+    double v = 0.0;
+    for (size_t c = 0; c < nc; c++) {
+        v += weights[c] * m_data[offsets[c] + var];
+    }
+    return v;
+}
+
+}
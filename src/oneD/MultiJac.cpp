@@ -4,6 +4,7 @@
 // at http://www.cantera.org/license.txt for license and copyright information.
 
 #include "cantera/oneD/MultiJac.h"
+#include "cantera/base/Tracer.h"
 #include <ctime>
 
 using namespace std;
@@ -42,6 +43,7 @@ void MultiJac::incrementDiagonal(int j, doublereal d)
 
 void MultiJac::eval(doublereal* x0, doublereal* resid0, doublereal rdt)
 {
+    TraceSpan span("MultiJac::eval", "oneD");
     m_nevals++;
     clock_t t0 = clock();
     bfill(0.0);
@@ -49,6 +51,10 @@ void MultiJac::eval(doublereal* x0, doublereal* resid0, doublereal rdt)
 
     for (size_t j = 0; j < m_points; j++) {
         size_t nv = m_resid->nVars(j);
+        if (nv && m_resid->pointDomain(ipt)->evalJacobianColumns(j, x0, *this)) {
+            ipt += nv;
+            continue;
+        }
         for (size_t n = 0; n < nv; n++) {
             // perturb x(n); preserve sign(x(n))
             double xsave = x0[ipt];
@@ -5,6 +5,8 @@
 
 #include "cantera/oneD/MultiNewton.h"
 #include "cantera/base/utilities.h"
+#include "cantera/base/AllocationCounter.h"
+#include "cantera/base/Tracer.h"
 
 #include <ctime>
 
@@ -125,17 +127,30 @@ doublereal norm_square(const doublereal* x,
 } // end unnamed-namespace
 
 
-// constants
-const doublereal DampFactor = sqrt(2.0);
-const size_t NDAMP = 7;
-
 // ---------------- MultiNewton methods ----------------
 
 MultiNewton::MultiNewton(int sz)
     : m_maxAge(5)
+    , m_dampFactor(sqrt(2.0))
+    , m_maxDampSteps(7)
 {
     m_n = sz;
     m_elapsed = 0.0;
+    m_nIterations = 0;
+}
+
+void MultiNewton::setDampingOptions(double factor, size_t maxSteps)
+{
+    if (factor <= 1.0) {
+        throw CanteraError("MultiNewton::setDampingOptions",
+            "Damping factor must be greater than one. Got {}.", factor);
+    }
+    if (maxSteps == 0) {
+        throw CanteraError("MultiNewton::setDampingOptions",
+            "At least one damping step is needed.");
+    }
+    m_dampFactor = factor;
+    m_maxDampSteps = maxSteps;
 }
 
 void MultiNewton::resize(size_t sz)
@@ -239,7 +254,7 @@ int MultiNewton::dampStep(const doublereal* x0, const doublereal* step0,
     // damping coefficient starts at 1.0
     doublereal damp = 1.0;
     size_t m;
-    for (m = 0; m < NDAMP; m++) {
+    for (m = 0; m < m_maxDampSteps; m++) {
         double ff = fbound*damp;
 
         // step the solution by the damped step size
@@ -269,13 +284,13 @@ int MultiNewton::dampStep(const doublereal* x0, const doublereal* step0,
         if (s1 < 1.0 || s1 < s0) {
             break;
         }
-        damp /= DampFactor;
+        damp /= m_dampFactor;
     }
 
     // If a damping coefficient was found, return 1 if the solution after
     // stepping by the damped step would represent a converged solution, and
     // return 0 otherwise. If no damping coefficient could be found, return -2.
-    if (m < NDAMP) {
+    if (m < m_maxDampSteps) {
         if (s1 > 1.0) {
             return 0;
         } else {
@@ -289,6 +304,8 @@ int MultiNewton::dampStep(const doublereal* x0, const doublereal* step0,
 int MultiNewton::solve(doublereal* x0, doublereal* x1,
                        OneDim& r, MultiJac& jac, int loglevel)
 {
+    AllocationPhase phase(SolverPhase::Newton);
+    TraceSpan span("MultiNewton::solve", "oneD");
     clock_t t0 = clock();
     int m = 0;
     bool forceNewJac = false;
@@ -319,6 +336,7 @@ int MultiNewton::solve(doublereal* x0, doublereal* x1,
 
         // compute the undamped Newton step
         step(&m_x[0], &m_stp[0], r, jac, loglevel-1);
+        m_nIterations++;
 
         // increment the Jacobian age
         jac.incrementAge();
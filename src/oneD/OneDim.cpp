@@ -6,6 +6,7 @@
 #include "cantera/oneD/OneDim.h"
 #include "cantera/numerics/Func1.h"
 #include "cantera/base/ctml.h"
+#include "cantera/base/AllocationCounter.h"
 #include "cantera/oneD/MultiNewton.h"
 
 #include <fstream>
@@ -211,6 +212,7 @@ void OneDim::resize()
 
     m_newt->resize(size());
     m_mask.resize(size());
+    m_work.resize(size());
 
     // delete the current Jacobian evaluator and create a new one
     m_jac.reset(new MultiJac(*this));
@@ -269,6 +271,7 @@ Domain1D* OneDim::pointDomain(size_t i)
 
 void OneDim::eval(size_t j, double* x, double* r, doublereal rdt, int count)
 {
+    AllocationPhase phase(SolverPhase::Residual);
     clock_t t0 = clock();
     if (m_interrupt) {
         m_interrupt->eval(m_nevals);
@@ -360,6 +363,8 @@ void OneDim::init()
 doublereal OneDim::timeStep(int nsteps, doublereal dt, doublereal* x,
                             doublereal* r, int loglevel)
 {
+    AllocationPhase phase(SolverPhase::TimeStep);
+
     // set the Jacobian age parameter to the transient value
     newton().setOptions(m_ts_jac_age);
 
@@ -380,11 +385,11 @@ doublereal OneDim::timeStep(int nsteps, doublereal dt, doublereal* x,
 
         // solve the transient problem
         int m = solve(x, r, loglevel-1);
-        vector_fp diff(m_size);
         // compute step
-        for (size_t l = 0; l < m_size; l++)
-          diff[l] = r[l]-x[l];
-        m_change = m_newt->norm2(x,diff.data(),*this);
+        for (size_t l = 0; l < m_size; l++) {
+            m_work[l] = r[l] - x[l];
+        }
+        m_change = m_newt->norm2(x, m_work.data(), *this);
 
         // successful time step. Copy the new solution in r to
         // the current solution in x.
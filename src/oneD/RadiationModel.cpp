@@ -0,0 +1,198 @@
+//! @file RadiationModel.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/oneD/RadiationModel.h"
+#include "cantera/numerics/funcs.h"
+#include "cantera/base/global.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+namespace {
+
+// Polynomial fits for the Planck-mean absorption coefficients [1/m/atm],
+// from http://www.sandia.gov/TNF/radiation.html
+
+double kP_H2O(double T)
+{
+    const double c[6] = {-0.23093, -1.12390, 9.41530, -2.99880, 0.51382,
+                         -1.86840e-5};
+    double kP = 0.0, tau = 1000.0 / T;
+    for (int n = 5; n >= 0; n--) {
+        kP = kP * tau + c[n];
+    }
+    return kP;
+}
+
+double kP_CO2(double T)
+{
+    const double c[6] = {18.741, -121.310, 273.500, -194.050, 56.310,
+                         -5.8169};
+    double kP = 0.0, tau = 1000.0 / T;
+    for (int n = 5; n >= 0; n--) {
+        kP = kP * tau + c[n];
+    }
+    return kP;
+}
+
+double kP_CO(double T)
+{
+    if (T < 750) {
+        return 4.7869 + T * (-0.06953 + T * (2.95775e-4 + T * (-4.25732e-7
+               + T * 2.02894e-10)));
+    } else {
+        return 10.09 + T * (-0.01183 + T * (4.7753e-6 + T * (-5.87209e-10
+               + T * -2.5334e-14)));
+    }
+}
+
+double kP_CH4(double T)
+{
+    return 6.6334 + T * (-0.0035686 + T * (1.6682e-8 + T * (2.5611e-10
+           + T * -2.6558e-14)));
+}
+
+}
+
+PlanckMeanRadiation::PlanckMeanRadiation() :
+    m_Tmin(200.0),
+    m_dT(10.0),
+    m_nT(331),
+    m_thermo(0)
+{
+    typedef double (*fit_t)(double);
+    vector<pair<string, fit_t>> fits{
+        {"H2O", kP_H2O}, {"CO2", kP_CO2}, {"CO", kP_CO}, {"CH4", kP_CH4}};
+    for (const auto& fit : fits) {
+        vector_fp& kP = m_coeffs[fit.first];
+        kP.resize(m_nT);
+        for (size_t i = 0; i < m_nT; i++) {
+            kP[i] = std::max(fit.second(m_Tmin + i * m_dT), 0.0);
+        }
+    }
+}
+
+void PlanckMeanRadiation::setAbsorptionCoeffs(const string& species,
+                                              const vector_fp& T,
+                                              const vector_fp& kP)
+{
+    if (T.size() != kP.size() || T.empty()) {
+        throw CanteraError("PlanckMeanRadiation::setAbsorptionCoeffs",
+            "Temperature and absorption coefficient arrays must be non-empty "
+            "and have the same length. Got {} and {}.", T.size(), kP.size());
+    }
+    for (size_t i = 1; i < T.size(); i++) {
+        if (T[i] <= T[i-1]) {
+            throw CanteraError("PlanckMeanRadiation::setAbsorptionCoeffs",
+                "Temperatures must be monotonically increasing");
+        }
+    }
+    vector_fp& table = m_coeffs[species];
+    table.resize(m_nT);
+    for (size_t i = 0; i < m_nT; i++) {
+        table[i] = linearInterp(m_Tmin + i * m_dT, T, kP);
+    }
+    updateTable();
+}
+
+double PlanckMeanRadiation::absorptionCoeff(const string& species,
+                                            double T) const
+{
+    auto iter = m_coeffs.find(species);
+    if (iter == m_coeffs.end()) {
+        return 0.0;
+    }
+    double s = (clip(T, m_Tmin, m_Tmin + (m_nT - 1) * m_dT) - m_Tmin) / m_dT;
+    size_t i = std::min(static_cast<size_t>(s), m_nT - 2);
+    double w = s - i;
+    return (1 - w) * iter->second[i] + w * iter->second[i+1];
+}
+
+void PlanckMeanRadiation::setSootVolumeFraction(const vector_fp& z,
+                                                const vector_fp& fv)
+{
+    if (z.size() != fv.size()) {
+        throw CanteraError("PlanckMeanRadiation::setSootVolumeFraction",
+            "Arrays must have the same length. Got {} and {}.",
+            z.size(), fv.size());
+    }
+    m_zSoot = z;
+    m_fvSoot = fv;
+}
+
+void PlanckMeanRadiation::init(const ThermoPhase& thermo)
+{
+    m_thermo = &thermo;
+    updateTable();
+}
+
+void PlanckMeanRadiation::updateTable()
+{
+    if (!m_thermo) {
+        return;
+    }
+    m_kRadiating.clear();
+    for (const auto& coeffs : m_coeffs) {
+        size_t k = m_thermo->speciesIndex(coeffs.first);
+        if (k != npos) {
+            m_kRadiating.push_back(k);
+        }
+    }
+    size_t na = m_kRadiating.size();
+    m_table.resize(m_nT * na);
+    for (size_t a = 0; a < na; a++) {
+        size_t k = m_kRadiating[a];
+        const vector_fp& kP = m_coeffs[m_thermo->speciesName(k)];
+        double rmw = 1.0 / m_thermo->molecularWeight(k);
+        for (size_t i = 0; i < m_nT; i++) {
+            m_table[i * na + a] = kP[i] * rmw;
+        }
+    }
+}
+
+void PlanckMeanRadiation::eval(size_t n, const double* z, const double* T,
+                               const double* Y, size_t ld, const double* wtm,
+                               double P, double epsLeft, double epsRight,
+                               double* qdot)
+{
+    if (n == 0) {
+        return;
+    }
+    size_t na = m_kRadiating.size();
+    double Tmax = m_Tmin + (m_nT - 1) * m_dT;
+    double Patm = P / OneAtm;
+    double TL = T[0];
+    double TR = T[(n-1)*ld];
+    double qBoundary = StefanBoltz * (epsLeft * TL * TL * TL * TL +
+                                      epsRight * TR * TR * TR * TR);
+    // soot absorption coefficient, divided by f_v * T
+    const double C_soot = 3.72 * 7.0 / 1.4388e-2;
+
+    for (size_t j = 0; j < n; j++) {
+        double Tj = T[j*ld];
+        const double* Yj = Y + j*ld;
+
+        // The interpolation weights are shared by all species
+        double s = (clip(Tj, m_Tmin, Tmax) - m_Tmin) / m_dT;
+        size_t i = std::min(static_cast<size_t>(s), m_nT - 2);
+        double w = s - i;
+        const double* k0 = m_table.data() + i * na;
+        const double* k1 = k0 + na;
+        double kP = 0.0;
+        for (size_t a = 0; a < na; a++) {
+            kP += Yj[m_kRadiating[a]] * ((1 - w) * k0[a] + w * k1[a]);
+        }
+        kP *= Patm * wtm[j];
+        if (!m_fvSoot.empty()) {
+            kP += C_soot * linearInterp(z[j], m_zSoot, m_fvSoot) * Tj;
+        }
+        double T2 = Tj * Tj;
+        qdot[j] = 2 * kP * (2 * StefanBoltz * T2 * T2 - qBoundary);
+    }
+}
+
+}
@@ -11,6 +11,7 @@
 #include "cantera/oneD/MultiNewton.h"
 #include "cantera/numerics/funcs.h"
 #include "cantera/base/xml.h"
+#include "cantera/base/AllocationCounter.h"
 #include "cantera/numerics/Func1.h"
 
 using namespace std;
@@ -137,6 +138,40 @@ void Sim1D::restore(const std::string& fname, const std::string& id,
     finalize();
 }
 
+void Sim1D::mapSolution(const Sim1D& other, bool useOtherGrid, int loglevel)
+{
+    if (other.nDomains() != nDomains()) {
+        throw CanteraError("Sim1D::mapSolution", "Simulations have different "
+            "numbers of domains. Found {} expected {}.",
+            other.nDomains(), nDomains());
+    }
+    for (size_t m = 0; m < nDomains(); m++) {
+        if (other.domain(m).domainType() != domain(m).domainType()) {
+            throw CanteraError("Sim1D::mapSolution", "Domain {} ('{}') has "
+                "a different type than the corresponding domain '{}'.",
+                m, domain(m).id(), other.domain(m).id());
+        }
+    }
+
+    vector<vector_fp> grids(nDomains());
+    for (size_t m = 0; m < nDomains(); m++) {
+        Domain1D& dom = domain(m);
+        grids[m] = useOtherGrid ? other.domain(m).grid() : dom.grid();
+        dom.resize(dom.nComponents(), grids[m].size());
+    }
+    resize();
+    m_xlast_ts.clear();
+    for (size_t m = 0; m < nDomains(); m++) {
+        Domain1D& dom = domain(m);
+        const Domain1D& src = other.domain(m);
+        dom.setupGrid(grids[m].size(), grids[m].data());
+        dom._getInitialSoln(&m_x[start(m)]);
+        dom.mapSolution(src, other.solution() + other.start(m),
+                        &m_x[start(m)], loglevel);
+    }
+    finalize();
+}
+
 void Sim1D::setFlatProfile(size_t dom, size_t comp, doublereal v)
 {
     size_t np = domain(dom).nPoints();
@@ -355,13 +390,15 @@ void Sim1D::solve(int loglevel, bool refine_grid)
 
 int Sim1D::refine_and_sync(int loglevel, Sim1D& other)
 {
+    AllocationPhase phase(SolverPhase::Refine);
     int ianalyze, np = 0;
-    vector_fp znew, xnew;
-    vector_fp xnew_other;
-    std::vector<size_t> dsize;
+    m_znew.clear();
+    m_xrefined.clear();
+    m_xrefined_other.clear();
+    m_dsize.clear();
 
     m_xlast_ss = m_x;
-    m_grid_last_ss.clear();
+    m_grid_last_ss.resize(nDomains());
 
     for (size_t n = 0; n < nDomains(); n++) {
         Domain1D& d = domain(n);
@@ -369,7 +406,7 @@ int Sim1D::refine_and_sync(int loglevel, Sim1D& other)
         Refiner& r = d.refiner();
 
         // Save the old grid corresponding to the converged solution
-        m_grid_last_ss.push_back(d.grid());
+        m_grid_last_ss[n] = d.grid();
 
         // determine where new points are needed
         ianalyze = r.analyze(d.grid().size(), d.grid().data(), &m_x[start(n)]);
@@ -386,42 +423,42 @@ int Sim1D::refine_and_sync(int loglevel, Sim1D& other)
 
         // loop over points in the current grid
         size_t npnow = d.nPoints();
-        size_t nstart = znew.size();
+        size_t nstart = m_znew.size();
         for (size_t m = 0; m < npnow; m++) {
             if (r.keepPoint(m)) {
                 // add the current grid point to the new grid
-                znew.push_back(d.grid(m));
+                m_znew.push_back(d.grid(m));
 
                 // do the same for the solution at this point
                 for (size_t i = 0; i < comp; i++) {
-                    xnew.push_back(value(n, i, m));
+                    m_xrefined.push_back(value(n, i, m));
                 }
 
                 // do the same for the other domain's solution at this point
                 for (size_t i = 0; i < comp_other; i++) {
-                    xnew_other.push_back(other.value(n, i, m));
+                    m_xrefined_other.push_back(other.value(n, i, m));
                 }
 
                 // now check whether a new point is needed in the interval to
-                // the right of point m, and if so, add entries to znew and xnew
-                // for this new point
+                // the right of point m, and if so, add entries to m_znew and
+                // m_xrefined for this new point
                 if (r.newPointNeeded(m) && m + 1 < npnow) {
                     // add new point at midpoint
                     double zmid = 0.5*(d.grid(m) + d.grid(m+1));
-                    znew.push_back(zmid);
+                    m_znew.push_back(zmid);
                     np++;
 
                     // for each component, linearly interpolate
                     // the solution to this point
                     for (size_t i = 0; i < comp; i++) {
                         double xmid = 0.5*(value(n, i, m) + value(n, i, m+1));
-                        xnew.push_back(xmid);
+                        m_xrefined.push_back(xmid);
                     }
 
                     // repeat the same for the other domain
                     for (size_t i = 0; i < comp_other; i++) {
                         double xmid = 0.5*(other.value(n, i, m) + other.value(n, i, m+1));
-                        xnew_other.push_back(xmid);
+                        m_xrefined_other.push_back(xmid);
                     }
 
                 }
@@ -431,26 +468,26 @@ int Sim1D::refine_and_sync(int loglevel, Sim1D& other)
                 }
             }
         }
-        dsize.push_back(znew.size() - nstart);
+        m_dsize.push_back(m_znew.size() - nstart);
     }
 
-    // At this point, the new grid znew and the new solution vector xnew have
-    // been constructed, but the domains themselves have not yet been modified.
-    // Now update each domain with the new grid.
+    // At this point, the new grid m_znew and the new solution vector
+    // m_xrefined have been constructed, but the domains themselves have not
+    // yet been modified. Now update each domain with the new grid.
 
     size_t gridstart = 0, gridsize;
     for (size_t n = 0; n < nDomains(); n++) {
         Domain1D& d = domain(n);
         Domain1D& d_other = other.domain(n);
-        gridsize = dsize[n];
-        d.setupGrid(gridsize, &znew[gridstart]);
-        d_other.setupGrid(gridsize, &znew[gridstart]);
+        gridsize = m_dsize[n];
+        d.setupGrid(gridsize, &m_znew[gridstart]);
+        d_other.setupGrid(gridsize, &m_znew[gridstart]);
         gridstart += gridsize;
     }
 
     // Replace the current solution vector with the new one
-    m_x = xnew;
-    other.solutionVector() = xnew_other;
+    m_x.swap(m_xrefined);
+    other.solutionVector().swap(m_xrefined_other);
     resize();
     finalize();
     other.resize();
@@ -461,19 +498,21 @@ int Sim1D::refine_and_sync(int loglevel, Sim1D& other)
 
 int Sim1D::refine(int loglevel)
 {
+    AllocationPhase phase(SolverPhase::Refine);
     int ianalyze, np = 0;
-    vector_fp znew, xnew;
-    std::vector<size_t> dsize;
+    m_znew.clear();
+    m_xrefined.clear();
+    m_dsize.clear();
 
     m_xlast_ss = m_x;
-    m_grid_last_ss.clear();
+    m_grid_last_ss.resize(nDomains());
 
     for (size_t n = 0; n < nDomains(); n++) {
         Domain1D& d = domain(n);
         Refiner& r = d.refiner();
 
         // Save the old grid corresponding to the converged solution
-        m_grid_last_ss.push_back(d.grid());
+        m_grid_last_ss[n] = d.grid();
 
         // determine where new points are needed
         ianalyze = r.analyze(d.grid().size(), d.grid().data(), &m_x[start(n)]);
@@ -490,31 +529,31 @@ int Sim1D::refine(int loglevel)
 
         // loop over points in the current grid
         size_t npnow = d.nPoints();
-        size_t nstart = znew.size();
+        size_t nstart = m_znew.size();
         for (size_t m = 0; m < npnow; m++) {
             if (r.keepPoint(m)) {
                 // add the current grid point to the new grid
-                znew.push_back(d.grid(m));
+                m_znew.push_back(d.grid(m));
 
                 // do the same for the solution at this point
                 for (size_t i = 0; i < comp; i++) {
-                    xnew.push_back(value(n, i, m));
+                    m_xrefined.push_back(value(n, i, m));
                 }
 
                 // now check whether a new point is needed in the interval to
-                // the right of point m, and if so, add entries to znew and xnew
-                // for this new point
+                // the right of point m, and if so, add entries to m_znew and
+                // m_xrefined for this new point
                 if (r.newPointNeeded(m) && m + 1 < npnow) {
                     // add new point at midpoint
                     double zmid = 0.5*(d.grid(m) + d.grid(m+1));
-                    znew.push_back(zmid);
+                    m_znew.push_back(zmid);
                     np++;
 
                     // for each component, linearly interpolate
                     // the solution to this point
                     for (size_t i = 0; i < comp; i++) {
                         double xmid = 0.5*(value(n, i, m) + value(n, i, m+1));
-                        xnew.push_back(xmid);
+                        m_xrefined.push_back(xmid);
                     }
                 }
             } else {
@@ -523,23 +562,23 @@ int Sim1D::refine(int loglevel)
                 }
             }
         }
-        dsize.push_back(znew.size() - nstart);
+        m_dsize.push_back(m_znew.size() - nstart);
     }
 
-    // At this point, the new grid znew and the new solution vector xnew have
-    // been constructed, but the domains themselves have not yet been modified.
-    // Now update each domain with the new grid.
+    // At this point, the new grid m_znew and the new solution vector
+    // m_xrefined have been constructed, but the domains themselves have not
+    // yet been modified. Now update each domain with the new grid.
 
     size_t gridstart = 0, gridsize;
     for (size_t n = 0; n < nDomains(); n++) {
         Domain1D& d = domain(n);
-        gridsize = dsize[n];
-        d.setupGrid(gridsize, &znew[gridstart]);
+        gridsize = m_dsize[n];
+        d.setupGrid(gridsize, &m_znew[gridstart]);
         gridstart += gridsize;
     }
 
     // Replace the current solution vector with the new one
-    m_x = xnew;
+    m_x.swap(m_xrefined);
     resize();
     finalize();
     return np;
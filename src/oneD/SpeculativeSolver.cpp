@@ -0,0 +1,264 @@
+//! @file SpeculativeSolver.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/oneD/SpeculativeSolver.h"
+#include "cantera/oneD/Sim1D.h"
+#include "cantera/oneD/MultiNewton.h"
+#include "cantera/numerics/Func1.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace std;
+
+namespace Cantera
+{
+
+namespace
+{
+
+typedef chrono::steady_clock Clock;
+
+// Thrown from the interrupt of a strategy which has been cancelled. Not
+// derived from CanteraError, so that it is not caught by the solver.
+struct SolveCancelled
+{
+};
+
+// Interrupt which cancels a strategy once another one has converged, or
+// when the time limit has been reached
+class CancelInterrupt : public Func1
+{
+public:
+    CancelInterrupt(const atomic<bool>& done, Clock::time_point deadline,
+                    bool limited) :
+        m_done(done),
+        m_deadline(deadline),
+        m_limited(limited)
+    {
+    }
+
+    virtual doublereal eval(doublereal t) const {
+        if (m_done.load(memory_order_relaxed)
+            || (m_limited && Clock::now() > m_deadline)) {
+            throw SolveCancelled();
+        }
+        return 0.0;
+    }
+
+private:
+    const atomic<bool>& m_done;
+    Clock::time_point m_deadline;
+    bool m_limited;
+};
+
+void applyStrategy(const SolveStrategy& s, Sim1D& sim)
+{
+    if (!s.restoreFile.empty()) {
+        sim.restore(s.restoreFile, s.restoreId, 0);
+    }
+    if (s.timeStep > 0.0 || !s.timeSteps.empty()) {
+        vector_int steps = s.timeSteps;
+        if (steps.empty()) {
+            steps.push_back(10);
+        }
+        sim.setTimeStep(s.timeStep > 0.0 ? s.timeStep : 1.0e-5, steps.size(),
+                        steps.data());
+    }
+    if (s.ssJacAge > 0 || s.tsJacAge > 0) {
+        sim.setJacAge(s.ssJacAge > 0 ? s.ssJacAge : sim.steadyJacAge(),
+                      s.tsJacAge > 0 ? s.tsJacAge : sim.transientJacAge());
+    }
+    if (s.maxTimeStep > 0.0) {
+        sim.setMaxTimeStep(s.maxTimeStep);
+    }
+    if (s.timeStepFactor > 0.0) {
+        sim.setTimeStepFactor(s.timeStepFactor);
+    }
+    if (s.dampFactor > 0.0 || s.maxDampSteps > 0) {
+        MultiNewton& newton = sim.newton();
+        newton.setDampingOptions(
+            s.dampFactor > 0.0 ? s.dampFactor : newton.dampFactor(),
+            s.maxDampSteps > 0 ? s.maxDampSteps : newton.maxDampSteps());
+    }
+    if (s.setup) {
+        s.setup(sim);
+    }
+}
+
+}
+
+SpeculativeSolver::SpeculativeSolver() :
+    m_nThreads(0),
+    m_timeLimit(0.0),
+    m_winner(npos)
+{
+}
+
+size_t SpeculativeSolver::addStrategy(const SolveStrategy& strategy)
+{
+    m_strategies.push_back(strategy);
+    if (m_strategies.back().name.empty()) {
+        m_strategies.back().name = fmt::format("strategy {}",
+                                               m_strategies.size() - 1);
+    }
+    return m_strategies.size() - 1;
+}
+
+const SolveStrategy& SpeculativeSolver::strategy(size_t i) const
+{
+    if (i >= m_strategies.size()) {
+        throw IndexError("SpeculativeSolver::strategy", "m_strategies", i,
+                         m_strategies.size() - 1);
+    }
+    return m_strategies[i];
+}
+
+size_t SpeculativeSolver::solve(
+    const function<unique_ptr<SpeculativeModel>()>& factory)
+{
+    size_t n = m_strategies.size();
+    if (n == 0) {
+        throw CanteraError("SpeculativeSolver::solve",
+                           "No strategies have been added.");
+    }
+    size_t nThreads = (m_nThreads == 0) ? n : min(m_nThreads, n);
+
+    m_winner = npos;
+    m_model.reset();
+    m_status.assign(n, Status::NotRun);
+    m_errors.assign(n, "");
+    m_elapsed.assign(n, 0.0);
+
+    atomic<bool> done(false);
+    Clock::time_point deadline = Clock::now() +
+        chrono::duration_cast<Clock::duration>(
+            chrono::duration<double>(m_timeLimit));
+    CancelInterrupt interrupt(done, deadline, m_timeLimit > 0.0);
+
+    // Create the models and apply the strategies from this thread, since
+    // constructing Cantera objects from input files is not necessarily
+    // thread-safe
+    vector<unique_ptr<SpeculativeModel>> models;
+    for (size_t i = 0; i < n; i++) {
+        models.push_back(factory());
+        Sim1D& sim = models.back()->simulation();
+        try {
+            applyStrategy(m_strategies[i], sim);
+        } catch (CanteraError& err) {
+            m_status[i] = Status::Failed;
+            m_errors[i] = err.getMessage();
+        }
+        sim.setInterrupt(&interrupt);
+    }
+
+    atomic<size_t> next(0);
+    atomic<size_t> winner(npos);
+    vector<exception_ptr> errors(n);
+
+    auto work = [&]() {
+        size_t i;
+        while (!done.load() && (i = next.fetch_add(1)) < n) {
+            if (m_status[i] == Status::Failed) {
+                continue;
+            }
+            Clock::time_point t0 = Clock::now();
+            try {
+                models[i]->simulation().solve(0, m_strategies[i].refine);
+                size_t none = npos;
+                if (winner.compare_exchange_strong(none, i)) {
+                    done.store(true);
+                }
+                m_status[i] = Status::Converged;
+            } catch (SolveCancelled&) {
+                m_status[i] = Status::Cancelled;
+            } catch (CanteraError& err) {
+                m_status[i] = Status::Failed;
+                m_errors[i] = err.getMessage();
+            } catch (...) {
+                m_status[i] = Status::Failed;
+                errors[i] = current_exception();
+                // Unexpected errors are rethrown, so stop the other strategies
+                done.store(true);
+            }
+            m_elapsed[i] = chrono::duration<double>(Clock::now() - t0).count();
+        }
+    };
+
+    vector<thread> threads;
+    for (size_t t = 1; t < nThreads; t++) {
+        threads.emplace_back(work);
+    }
+    work();
+    for (auto& th : threads) {
+        th.join();
+    }
+    for (auto& model : models) {
+        model->simulation().setInterrupt(0);
+    }
+    for (auto& err : errors) {
+        if (err) {
+            rethrow_exception(err);
+        }
+    }
+
+    m_winner = winner.load();
+    if (m_winner == npos) {
+        string msg;
+        for (size_t i = 0; i < n; i++) {
+            msg += fmt::format("\n{}: {}", m_strategies[i].name,
+                m_status[i] == Status::Cancelled ? "time limit reached"
+                                                 : m_errors[i]);
+        }
+        throw CanteraError("SpeculativeSolver::solve",
+                           "No strategy converged:{}", msg);
+    }
+    m_model = std::move(models[m_winner]);
+    return m_winner;
+}
+
+SpeculativeModel& SpeculativeSolver::model()
+{
+    if (!m_model) {
+        throw CanteraError("SpeculativeSolver::model",
+                           "No strategy has converged.");
+    }
+    return *m_model;
+}
+
+void SpeculativeSolver::getSolution(Sim1D& sim)
+{
+    sim.mapSolution(model().simulation(), true, 0);
+}
+
+SpeculativeSolver::Status SpeculativeSolver::status(size_t i) const
+{
+    if (i >= m_status.size()) {
+        throw IndexError("SpeculativeSolver::status", "m_status", i,
+                         m_status.size() - 1);
+    }
+    return m_status[i];
+}
+
+const string& SpeculativeSolver::errorMessage(size_t i) const
+{
+    if (i >= m_errors.size()) {
+        throw IndexError("SpeculativeSolver::errorMessage", "m_errors", i,
+                         m_errors.size() - 1);
+    }
+    return m_errors[i];
+}
+
+double SpeculativeSolver::elapsedTime(size_t i) const
+{
+    if (i >= m_elapsed.size()) {
+        throw IndexError("SpeculativeSolver::elapsedTime", "m_elapsed", i,
+                         m_elapsed.size() - 1);
+    }
+    return m_elapsed[i];
+}
+
+}
@@ -4,7 +4,9 @@
 // at http://www.cantera.org/license.txt for license and copyright information.
 
 #include "cantera/oneD/StFlow.h"
+#include "cantera/oneD/MultiJac.h"
 #include "cantera/base/ctml.h"
+#include "cantera/base/Tracer.h"
 #include "cantera/transport/TransportBase.h"
 #include "cantera/numerics/funcs.h"
 
@@ -31,6 +33,7 @@ StFlow::StFlow(IdealGasPhase* ph, size_t nsp, size_t points) :
     m_type = cFlowType;
     m_points = points;
     m_thermo = ph;
+    m_radiation.reset(new PlanckMeanRadiation());
 
     if (ph == 0) {
         return; // used to create a dummy object
@@ -52,6 +55,7 @@ StFlow::StFlow(IdealGasPhase* ph, size_t nsp, size_t points) :
 
     // enable all species equations by default
     m_do_species.resize(m_nsp, true);
+    m_qss.resize(m_nsp, false);
 
     // but turn off the energy equation at all points
     m_do_energy.resize(m_points,false);
@@ -90,11 +94,18 @@ StFlow::StFlow(IdealGasPhase* ph, size_t nsp, size_t points) :
     setupGrid(m_points, gr.data());
     setID("stagnation flow");
 
-    // Find indices for radiating species
-    m_kRadiating.resize(2, npos);
-    m_kRadiating[0] = m_thermo->speciesIndex("CO2");
-    m_kRadiating[1] = m_thermo->speciesIndex("H2O");
+    m_radiation->init(*m_thermo);
+}
 
+void StFlow::updateQSSSpecies()
+{
+    m_qss.resize(m_nsp, false);
+    size_t nqss = 0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_qss[k] = m_kin && m_kin->isQSSSpecies(k);
+        nqss += m_qss[k];
+    }
+    m_qssConc.resize(nqss);
 }
 
 void StFlow::resize(size_t ncomponents, size_t points)
@@ -113,6 +124,7 @@ void StFlow::resize(size_t ncomponents, size_t points)
     }
     m_flux.resize(m_nsp,m_points);
     m_wdot.resize(m_nsp,m_points, 0.0);
+    updateQSSSpecies();
     m_do_energy.resize(m_points,false);
     m_qdotRadiation.resize(m_points, 0.0);
     m_HRR.resize(m_points, 0.0);
@@ -276,69 +288,13 @@ void StFlow::eval(size_t jg, doublereal* xg,
     // grid points
     //----------------------------------------------------
 
-    // calculation of qdotRadiation
-
-    // The simple radiation model used was established by Y. Liu and B. Rogg [Y.
-    // Liu and B. Rogg, Modelling of thermally radiating diffusion flames with
-    // detailed chemistry and transport, EUROTHERM Seminars, 17:114-127, 1991].
-    // This model uses the optically thin limit and the gray-gas approximation
-    // to simply calculate a volume specified heat flux out of the Planck
-    // absorption coefficients, the boundary emissivities and the temperature.
-    // The model considers only CO2 and H2O as radiating species. Polynomial
-    // lines calculate the species Planck coefficients for H2O and CO2. The data
-    // for the lines is taken from the RADCAL program [Grosshandler, W. L.,
-    // RADCAL: A Narrow-Band Model for Radiation Calculations in a Combustion
-    // Environment, NIST technical note 1402, 1993]. The coefficients for the
-    // polynomials are taken from [http://www.sandia.gov/TNF/radiation.html].
-
-    if (m_do_radiation) {
-        // variable definitions for the Planck absorption coefficient and the
-        // radiation calculation:
-        doublereal k_P_ref = 1.0*OneAtm;
-
-        // polynomial coefficients:
-        const doublereal c_H2O[6] = {-0.23093, -1.12390, 9.41530, -2.99880,
-                                     0.51382, -1.86840e-5};
-        const doublereal c_CO2[6] = {18.741, -121.310, 273.500, -194.050,
-                                     56.310, -5.8169};
-
-        // calculation of the two boundary values
-        double boundary_Rad_left = m_epsilon_left * StefanBoltz * pow(T(x, 0), 4);
-        double boundary_Rad_right = m_epsilon_right * StefanBoltz * pow(T(x, m_points - 1), 4);
-
-        // loop over all grid points
-        for (size_t j = jmin; j < jmax; j++) {
-            // helping variable for the calculation
-            double radiative_heat_loss = 0;
-
-            // calculation of the mean Planck absorption coefficient
-            double k_P = 0;
-            // absorption coefficient for H2O
-            if (m_kRadiating[1] != npos) {
-                double k_P_H2O = 0;
-                for (size_t n = 0; n <= 5; n++) {
-                    k_P_H2O += c_H2O[n] * pow(1000 / T(x, j), (double) n);
-                }
-                k_P_H2O /= k_P_ref;
-                k_P += m_press * X(x, m_kRadiating[1], j) * k_P_H2O;
-            }
-            // absorption coefficient for CO2
-            if (m_kRadiating[0] != npos) {
-                double k_P_CO2 = 0;
-                for (size_t n = 0; n <= 5; n++) {
-                    k_P_CO2 += c_CO2[n] * pow(1000 / T(x, j), (double) n);
-                }
-                k_P_CO2 /= k_P_ref;
-                k_P += m_press * X(x, m_kRadiating[0], j) * k_P_CO2;
-            }
-
-            // calculation of the radiative heat loss term
-            radiative_heat_loss = 2 * k_P *(2 * StefanBoltz * pow(T(x, j), 4)
-            - boundary_Rad_left - boundary_Rad_right);
-
-            // set the radiative heat loss vector
-            m_qdotRadiation[j] = radiative_heat_loss;
-        }
+    // The radiative heat loss is computed only when evaluating the full
+    // residual, and is held constant while evaluating the Jacobian.
+    if (m_do_radiation && jg == npos) {
+        m_radiation->eval(m_points, m_z.data(), x + c_offset_T,
+                          x + c_offset_Y, m_nv, m_wtm.data(), m_press,
+                          m_epsilon_left, m_epsilon_right,
+                          m_qdotRadiation.data());
     }
 
     for (size_t j = jmin; j <= jmax; j++) {
@@ -395,9 +351,22 @@ void StFlow::eval(size_t jg, doublereal* xg,
             //
             //   \rho dY_k/dt + \rho u dY_k/dz + dJ_k/dz
             //   = M_k\omega_k
+            //
+            //   The mass fractions of quasi-steady species are set to the
+            //   values computed by the kinetics manager.
             //-------------------------------------------------
             getWdot(x,j);
+            if (!m_qssConc.empty()) {
+                m_kin->getQSSConcentrations(m_qssConc.data());
+            }
+            size_t q = 0;
             for (size_t k = 0; k < m_nsp; k++) {
+                if (m_qss[k]) {
+                    rsd[index(c_offset_Y + k, j)] = Y(x,k,j)
+                        - m_qssConc[q++] * m_wt[k] / m_rho[j];
+                    diag[index(c_offset_Y + k, j)] = 0;
+                    continue;
+                }
                 double convec = rho_u(x,j)*dYdz(x,k,j);
                 double diffus = 2.0*(m_flux(k,j) - m_flux(k,j-1))
                                 / (z(j+1) - z(j-1));
@@ -751,6 +720,85 @@ void StFlow::restore(const XML_Node& dom, doublereal* soln, int loglevel)
     }
 }
 
+void StFlow::mapSolution(const Domain1D& src, const doublereal* xsrc,
+                         doublereal* soln, int loglevel)
+{
+    Domain1D::mapSolution(src, xsrc, soln, loglevel);
+    const StFlow& flow = dynamic_cast<const StFlow&>(src);
+    setPressure(flow.pressure());
+    m_zfix = flow.m_zfix;
+    m_tfix = flow.m_tfix;
+
+    // The energy equation is enabled where it is enabled at the nearest point
+    // of the source grid
+    size_t jsrc = 0;
+    for (size_t j = 0; j < m_points; j++) {
+        while (jsrc + 1 < flow.nPoints() &&
+               flow.grid(jsrc+1) - z(j) < z(j) - flow.grid(jsrc)) {
+            jsrc++;
+        }
+        m_do_energy[j] = flow.m_do_energy[jsrc];
+    }
+
+    // Species which are not part of the source mechanism are estimated from
+    // the local equilibrium composition at the mapped temperature, pressure
+    // and elemental composition. The mapped composition is blended with this
+    // equilibrium composition, using the mass fraction of the missing species
+    // at equilibrium as the weight of the equilibrium composition. Since both
+    // compositions have the same elemental composition, the blend conserves
+    // the elemental mass fractions and sums to one, while the mass fractions
+    // of the matched species change by no more than this weight.
+    vector<size_t> missing;
+    vector<bool> matched(m_nsp, true);
+    for (size_t k = 0; k < m_nsp; k++) {
+        if (flow.componentIndex(componentName(k + c_offset_Y)) == npos) {
+            missing.push_back(k);
+            matched[k] = false;
+        }
+    }
+    if (loglevel >= 1 && !missing.empty()) {
+        writelog("Domain '{}': estimating {} species from local "
+                 "equilibrium.\n", id(), missing.size());
+    }
+    vector_fp ymapped(m_nsp);
+    for (size_t j = 0; j < m_points; j++) {
+        double* y = &Y(soln, 0, j);
+        double sum = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            ymapped[k] = matched[k] ? y[k] : 0.0;
+            sum += ymapped[k];
+        }
+        if (sum <= 0.0) {
+            continue;
+        }
+        for (size_t k = 0; k < m_nsp; k++) {
+            ymapped[k] /= sum;
+            y[k] = ymapped[k];
+        }
+        if (missing.empty()) {
+            continue;
+        }
+        try {
+            m_thermo->setState_TPY(T(soln, j), m_press, ymapped.data());
+            m_thermo->equilibrate("TP");
+        } catch (CanteraError& err) {
+            if (loglevel >= 2) {
+                writelog("Equilibrium estimate failed at point {}:\n{}",
+                         j, err.getMessage());
+            }
+            continue;
+        }
+        const double* yeq = m_thermo->massFractions();
+        double weight = 0.0;
+        for (size_t k : missing) {
+            weight += yeq[k];
+        }
+        for (size_t k = 0; k < m_nsp; k++) {
+            y[k] = (1.0 - weight) * ymapped[k] + weight * yeq[k];
+        }
+    }
+}
+
 XML_Node& StFlow::save(XML_Node& o, const doublereal* const sol)
 {
     Array2D soln(m_nv, m_points, sol + loc());
@@ -847,6 +895,39 @@ void StFlow::setBoundaryEmissivities(doublereal e_left, doublereal e_right)
     }
 }
 
+void StFlow::setRadiationModel(RadiationModel* model)
+{
+    if (!model) {
+        throw CanteraError("StFlow::setRadiationModel",
+                           "Radiation model must not be null");
+    }
+    m_radiation.reset(model);
+    if (m_thermo) {
+        m_radiation->init(*m_thermo);
+    }
+}
+
+void StFlow::setAbsorptionCoeffs(const std::string& species,
+                                 const vector_fp& T, const vector_fp& kP)
+{
+    auto model = dynamic_cast<PlanckMeanRadiation*>(m_radiation.get());
+    if (!model) {
+        throw CanteraError("StFlow::setAbsorptionCoeffs",
+                           "Radiation model is not a PlanckMeanRadiation");
+    }
+    model->setAbsorptionCoeffs(species, T, kP);
+}
+
+void StFlow::setSootVolumeFraction(const vector_fp& z, const vector_fp& fv)
+{
+    auto model = dynamic_cast<PlanckMeanRadiation*>(m_radiation.get());
+    if (!model) {
+        throw CanteraError("StFlow::setSootVolumeFraction",
+                           "Radiation model is not a PlanckMeanRadiation");
+    }
+    model->setSootVolumeFraction(z, fv);
+}
+
 void StFlow::fixTemperature(size_t j)
 {
     bool changed = false;
@@ -1005,6 +1086,18 @@ void FreeFlame::restore(const XML_Node& dom, doublereal* soln, int loglevel)
     getOptionalFloat(dom, "z_fixed", m_zfixed);
 }
 
+void FreeFlame::mapSolution(const Domain1D& src, const doublereal* xsrc,
+                            doublereal* soln, int loglevel)
+{
+    StFlow::mapSolution(src, xsrc, soln, loglevel);
+    const FreeFlame* flame = dynamic_cast<const FreeFlame*>(&src);
+    if (flame) {
+        // _finalize moves the fixed point onto the new grid if necessary
+        m_zfixed = flame->m_zfixed;
+        m_tfixed = flame->m_tfixed;
+    }
+}
+
 XML_Node& FreeFlame::save(XML_Node& o, const doublereal* const sol)
 {
     XML_Node& flow = StFlow::save(o, sol);
@@ -1050,6 +1143,10 @@ SprayLiquid::SprayLiquid()
     m_type = cSprayType;
     m_prs_B = 1730.63;
     m_prs_C = 233.426-273.15;
+    m_Tb = 373.15;
+    m_cvt = mmHg2Pa;
+    // latent heat [J/kg]
+    m_Lv = 2.257e+06;
     // liquid density
     m_rhol_A = 0.14395;
     m_rhol_B = 0.0112;
@@ -1057,6 +1154,14 @@ SprayLiquid::SprayLiquid()
     m_rhol_D = 0.05107;
     // heat capacity [J/kmol/K]
     m_cpl = 76.0e+03;
+    // set by SprayInlet1D
+    m_ml0 = 0.0;
+    m_nl0 = 0.0;
+    m_accel_evap = false;
+    m_t = 0.0;
+    m_evap_cst = 1.0;
+    m_gas = 0;
+    m_analyticJac = true;
 }
 
 void SprayLiquid::resize(size_t ncomponents, size_t points)
@@ -1065,11 +1170,15 @@ void SprayLiquid::resize(size_t ncomponents, size_t points)
     m_dz.resize(m_points-1);
     m_z.resize(m_points);
     m_zl.resize(m_points);
+    m_xdual.resize(m_nv*m_points);
+    m_rdual.resize(m_nv*m_points);
+    m_diag_work.resize(m_nv*m_points);
 }
 
 void SprayLiquid::eval(size_t jg, doublereal* xg,
                   doublereal* rg, integer* diagg, doublereal rdt)
 {
+    TraceSpan span("SprayLiquid::eval", "oneD");
     // start of local part of global arrays
     doublereal* x = xg + loc();
     doublereal* rsd = rg + loc();
@@ -1085,6 +1194,13 @@ void SprayLiquid::eval(size_t jg, doublereal* xg,
         jmax = std::min(jpt+1,m_points-1);
     }
 
+    evalLiquid(jmin, jmax, x, rsd, diag, rdt);
+}
+
+template <class S>
+void SprayLiquid::evalLiquid(size_t jmin, size_t jmax, S* x, S* rsd,
+                             integer* diag, doublereal rdt)
+{
     // Liquid phase
     for (size_t j = jmin; j <= jmax; j++) {
         //----------------------------------------------
@@ -1118,13 +1234,13 @@ void SprayLiquid::eval(size_t jg, doublereal* xg,
             diag[index(c_offset_ml, 0)] = 0;
 
         } else if (j == m_points - 1) {
-            evalRightBoundaryLiquid(x, rsd, diag, rdt);
+            rightBoundaryResidual(x, rsd, diag, rdt);
         } else { // interior points
 
             //------------------------------------------------
             //    Number density equation
             //------------------------------------------------
-            evalNumberDensity(j, x, rsd, diag, rdt);
+            numberDensityResidual(j, x, rsd, diag, rdt);
 
             //------------------------------------------------
             //    Mass equation
@@ -1180,6 +1296,13 @@ void SprayLiquid::eval(size_t jg, doublereal* xg,
 
 void SprayLiquid::evalNumberDensity(size_t j, doublereal* x, doublereal* rsd,
                                   integer* diag, doublereal rdt)
+{
+    numberDensityResidual(j, x, rsd, diag, rdt);
+}
+
+template <class S>
+void SprayLiquid::numberDensityResidual(size_t j, S* x, S* rsd,
+                                        integer* diag, doublereal rdt)
 {
      //----------------------------------------------
      //    Number density equation
@@ -1204,6 +1327,13 @@ void SprayLiquid::evalNumberDensity(size_t j, doublereal* x, doublereal* rsd,
 
 void SprayLiquid::evalRightBoundaryLiquid(doublereal* x, doublereal* rsd,
                                          integer* diag, doublereal rdt)
+{
+    rightBoundaryResidual(x, rsd, diag, rdt);
+}
+
+template <class S>
+void SprayLiquid::rightBoundaryResidual(S* x, S* rsd, integer* diag,
+                                        doublereal rdt)
 {
     size_t j = m_points - 1;
 
@@ -1225,6 +1355,40 @@ void SprayLiquid::evalRightBoundaryLiquid(doublereal* x, doublereal* rsd,
     diag[index(c_offset_ml, j)] = 0;
 }
 
+bool SprayLiquid::evalJacobianColumns(size_t jg, doublereal* xg,
+                                      MultiJac& jac)
+{
+    // Columns near the ends of the domain also enter the residuals of the
+    // adjacent boundary domains, and are left to finite differences
+    size_t j = jg - firstPoint();
+    if (!m_analyticJac || j < 2 || j + 3 > m_points) {
+        return false;
+    }
+
+    // The residuals at points j-1 through j+1 depend on the solution at
+    // points j-2 through j+2, which are the only ones set in the workspace
+    const doublereal* x = xg + loc();
+    for (size_t i = index(0, j-2); i < index(0, j+3); i++) {
+        m_xdual[i] = x[i];
+    }
+    for (size_t n = 0; n < m_nv; n++) {
+        m_xdual[index(n,j)].setDerivative(n, 1.0);
+    }
+    for (size_t i = index(0, j-1); i < index(0, j+2); i++) {
+        m_rdual[i] = 0.0;
+    }
+    evalLiquid(j-1, j+1, m_xdual.data(), m_rdual.data(), m_diag_work.data(),
+               0.0);
+
+    for (size_t n = 0; n < m_nv; n++) {
+        size_t col = loc() + index(n,j);
+        for (size_t i = index(0, j-1); i < index(0, j+2); i++) {
+            jac.value(loc() + i, col) = m_rdual[i].derivative(n);
+        }
+    }
+    return true;
+}
+
 string SprayLiquid::componentName(size_t n) const
 {
     switch (n) {
@@ -1353,6 +1517,7 @@ void SprayGas::eval(size_t jg, doublereal* xg,
 {
     // Get the residual from the gaseous phase equations
     AxiStagnFlow::eval(jg,xg,rg,diagg,rdt);
+    TraceSpan span("SprayGas::sourceTerms", "oneD");
 
     // start of local part of global arrays
     doublereal* x = xg + loc();
@@ -1417,6 +1582,9 @@ void SprayGas::eval(size_t jg, doublereal* xg,
             //     + (\delta_kf - Y_k) nl mdot
             //-------------------------------------------------
             for (size_t k = 0; k < m_nsp; k++) {
+                if (m_qss[k]) {
+                    continue;
+                }
                 doublereal delta_kf;
                 if (k == c_offset_fuel) {
                     delta_kf = 1.0;
@@ -1447,30 +1615,28 @@ void SprayGas::eval(size_t jg, doublereal* xg,
     }
 }
 
+bool SprayGas::equilibrium_status(size_t j) {
+  // True if super-saturated, false if sub-saturated
+  return Y_prev(c_offset_fuel,j) >= m_liq->prs(T_prev(j))/m_press;
+}
+
 std::vector<bool> SprayGas::get_equilibrium_status() {
   std::vector<bool> eq_stat(m_points);
   for (size_t i = 0; i < m_points; i++) {
-    // Set to 1 if super-saturated, 0 if sub-saturated
-    eq_stat[i] = (Y_prev(c_offset_fuel,i) >= m_liq->prs(T_prev(i))/m_press ? 1 : 0);
+    eq_stat[i] = equilibrium_status(i);
   }
   return eq_stat;
 }
 
 bool SprayGas::check_for_liquid_step() {
-  std::vector<bool> curr_stat = get_equilibrium_status();
-
-  // Compare with previous status
+  // Compare with previous status, and store the new status as current
+  bool changed = false;
   for (size_t i = 0; i < m_points; i++) {
-    if (curr_stat[i] != m_eq_stat[i]) {
-      // Store new as current
-      m_eq_stat = curr_stat; 
-      return true;
-    }
+    bool stat = equilibrium_status(i);
+    changed |= (stat != m_eq_stat[i]);
+    m_eq_stat[i] = stat;
   }
-
-  // Store new status as current
-  m_eq_stat = curr_stat;
-  return false;
+  return changed;
 }
 
 void SprayGas::setLiquidDomain(SprayLiquid* liq) {
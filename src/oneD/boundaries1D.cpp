@@ -5,6 +5,7 @@
 
 #include "cantera/oneD/Inlet1D.h"
 #include "cantera/oneD/OneDim.h"
+#include "cantera/oneD/MultiJac.h"
 #include "cantera/base/ctml.h"
 #include "cantera/oneD/StFlow.h"
 
@@ -620,6 +621,8 @@ ReactingSurf1D::ReactingSurf1D()
     : m_kin(0)
     , m_surfindex(0)
     , m_nsp(0)
+    , m_quasiSteady(false)
+    , m_analyticJac(true)
 {
     m_type = cSurfType;
 }
@@ -649,6 +652,10 @@ void ReactingSurf1D::init()
     m_fixed_cov.resize(m_nsp, 0.0);
     m_fixed_cov[0] = 1.0;
     m_work.resize(m_kin->nTotalSpecies(), 0.0);
+    m_dwdot.resize(m_kin->nTotalSpecies() * m_nsp, 0.0);
+    m_qss_cov.resize(m_nsp);
+    m_sphase->getCoverages(m_qss_cov.data());
+    m_cachedState.clear();
 
     for (size_t n = 0; n < m_nsp; n++) {
         setBounds(n, -1.0e-5, 2.0);
@@ -661,6 +668,55 @@ void ReactingSurf1D::resetBadValues(double* xg) {
     m_sphase->getCoverages(x);
 }
 
+void ReactingSurf1D::setState(const doublereal* xg)
+{
+    m_sphase->setTemperature(m_temp);
+    if (m_quasiSteady) {
+        m_sphase->setCoveragesNoNorm(m_qss_cov.data());
+    } else {
+        m_sphase->setCoveragesNoNorm(xg + loc());
+    }
+
+    // set the gas state to the adjacent points
+    if (m_flow_left) {
+        m_flow_left->setGas(xg + m_flow_left->loc(),
+                            m_flow_left->nPoints() - 1);
+    }
+    if (m_flow_right) {
+        m_flow_right->setGas(xg + m_flow_right->loc(), 0);
+    }
+}
+
+void ReactingSurf1D::updateRates(size_t jg, const doublereal* xg)
+{
+    // The rates depend on the coverages and on the adjacent gas points, which
+    // are stored contiguously with the coverages
+    size_t ncl = m_flow_left ? m_flow_left->nComponents() : 0;
+    size_t ncr = m_flow_right ? m_flow_right->nComponents() : 0;
+    const doublereal* x0 = xg + loc() - ncl;
+    size_t n = ncl + m_nsp + ncr;
+
+    if (jg != npos && m_cachedState.size() == n &&
+        std::equal(x0, x0 + n, m_cachedState.begin())) {
+        m_work = m_cachedRates;
+        m_qss_cov = m_cachedCov;
+        return;
+    }
+
+    setState(xg);
+    if (m_quasiSteady) {
+        m_kin->solvePseudoSteadyStateProblem();
+        m_sphase->getCoverages(m_qss_cov.data());
+    }
+    m_kin->getNetProductionRates(m_work.data());
+
+    if (jg == npos) {
+        m_cachedState.assign(x0, x0 + n);
+        m_cachedRates = m_work;
+        m_cachedCov = m_qss_cov;
+    }
+}
+
 void ReactingSurf1D::eval(size_t jg, doublereal* xg, doublereal* rg,
                           integer* diagg, doublereal rdt)
 {
@@ -673,42 +729,22 @@ void ReactingSurf1D::eval(size_t jg, doublereal* xg, doublereal* rg,
     doublereal* r = rg + loc();
     integer* diag = diagg + loc();
 
-    // set the coverages
-    doublereal sum = 0.0;
-    for (size_t k = 0; k < m_nsp; k++) {
-        m_work[k] = x[k];
-        sum += x[k];
-    }
-    m_sphase->setTemperature(m_temp);
-    m_sphase->setCoveragesNoNorm(m_work.data());
-
-    // set the left gas state to the adjacent point
-
-    size_t leftloc = 0, rightloc = 0;
-    size_t pnt = 0;
-
-    if (m_flow_left) {
-        leftloc = m_flow_left->loc();
-        pnt = m_flow_left->nPoints() - 1;
-        m_flow_left->setGas(xg + leftloc, pnt);
-    }
-
-    if (m_flow_right) {
-        rightloc = m_flow_right->loc();
-        m_flow_right->setGas(xg + rightloc, 0);
-    }
-
-    m_kin->getNetProductionRates(m_work.data());
+    updateRates(jg, xg);
     doublereal rs0 = 1.0/m_sphase->siteDensity();
     size_t ioffset = m_kin->kineticsSpeciesIndex(0, m_surfindex);
 
-    if (m_enabled) {
-        doublereal maxx = -1.0;
+    if (m_quasiSteady) {
+        for (size_t k = 0; k < m_nsp; k++) {
+            r[k] = x[k] - m_qss_cov[k];
+            diag[k] = 0;
+        }
+    } else if (m_enabled) {
+        doublereal sum = 0.0;
         for (size_t k = 0; k < m_nsp; k++) {
             r[k] = m_work[k + ioffset] * m_sphase->size(k) * rs0;
             r[k] -= rdt*(x[k] - prevSoln(k,0));
             diag[k] = 1;
-            maxx = std::max(x[k], maxx);
+            sum += x[k];
         }
         r[0] = 1.0 - sum;
         diag[0] = 0;
@@ -739,6 +775,54 @@ void ReactingSurf1D::eval(size_t jg, doublereal* xg, doublereal* rg,
     }
 }
 
+bool ReactingSurf1D::evalJacobianColumns(size_t jg, doublereal* xg,
+                                         MultiJac& jac)
+{
+    if (!m_analyticJac || !m_kin->coverageDerivativesAvailable()) {
+        return false;
+    }
+
+    // With quasi-steady coverages, the production rates do not depend on the
+    // coverage components of the solution vector
+    size_t nt = m_kin->nTotalSpecies();
+    if (m_quasiSteady) {
+        fill(m_dwdot.begin(), m_dwdot.end(), 0.0);
+    } else {
+        setState(xg);
+        m_kin->getNetProductionRatesCoverageDerivatives(m_dwdot.data());
+    }
+
+    size_t iloc = loc();
+    doublereal rs0 = 1.0/m_sphase->siteDensity();
+    size_t ioffset = m_kin->kineticsSpeciesIndex(0, m_surfindex);
+    for (size_t n = 0; n < m_nsp; n++) {
+        size_t col = iloc + n;
+        const double* dwdot = &m_dwdot[n * nt];
+        if (m_enabled && !m_quasiSteady) {
+            for (size_t k = 0; k < m_nsp; k++) {
+                jac.value(iloc + k, col) = dwdot[k + ioffset] *
+                                           m_sphase->size(k) * rs0;
+            }
+            jac.value(iloc, col) = -1.0;
+        } else {
+            jac.value(col, col) = 1.0;
+        }
+
+        if (m_flow_left) {
+            size_t nc = m_flow_left->nComponents();
+            const vector_fp& mwleft = m_phase_left->molecularWeights();
+            size_t nSkip = m_flow_left->rightExcessSpecies();
+            for (size_t nl = 0; nl < m_left_nsp; nl++) {
+                if (nl != nSkip) {
+                    jac.value(iloc - nc + c_offset_Y + nl, col) =
+                        dwdot[nl] * mwleft[nl];
+                }
+            }
+        }
+    }
+    return true;
+}
+
 XML_Node& ReactingSurf1D::save(XML_Node& o, const doublereal* const soln)
 {
     const doublereal* s = soln + loc();
@@ -69,16 +69,18 @@ int Refiner::analyze(size_t n, const doublereal* z,
     }
 
     // find locations where cell size ratio is too large.
-    vector_fp v(n), s(n-1);
-
-    vector_fp dz(n-1);
+    m_v.resize(n);
+    m_s.resize(n-1);
+    m_dz.resize(n-1);
+    vector_fp& v = m_v;
+    vector_fp& s = m_s;
+    vector_fp& dz = m_dz;
     for (size_t j = 0; j < n-1; j++) {
         dz[j] = z[j+1] - z[j];
     }
 
     for (size_t i = 0; i < m_nv; i++) {
         if (m_active[i]) {
-            string name = m_domain->componentName(i);
             // get component i at all points
             for (size_t j = 0; j < n; j++) {
                 v[j] = value(x, i, j);
@@ -111,7 +113,7 @@ int Refiner::analyze(size_t n, const doublereal* z,
                     doublereal r = fabs(v[j+1] - v[j])/dmax;
                     if (r > 1.0 && dz[j] >= 2 * m_gridmin) {
                         m_loc[j] = 1;
-                        m_c[name] = 1;
+                        m_c[m_domain->componentName(i)] = 1;
                     }
                     if (r >= m_prune) {
                         m_keep[j] = 1;
@@ -134,7 +136,7 @@ int Refiner::analyze(size_t n, const doublereal* z,
                     doublereal r = fabs(s[j+1] - s[j]) / (dmax + m_thresh/dz[j]);
                     if (r > 1.0 && dz[j] >= 2 * m_gridmin &&
                             dz[j+1] >= 2 * m_gridmin) {
-                        m_c[name] = 1;
+                        m_c[m_domain->componentName(i)] = 1;
                         m_loc[j] = 1;
                         m_loc[j+1] = 1;
                     }
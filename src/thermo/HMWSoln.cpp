@@ -65,6 +65,7 @@ HMWSoln::HMWSoln() :
     CROP_ln_gamma_k_min(-5.0),
     CROP_ln_gamma_k_max(15.0),
     m_last_is(-1.0),
+    m_last_is_gfunc(-1.0),
     m_debugCalc(0)
 {
 }
@@ -114,6 +115,7 @@ HMWSoln::HMWSoln(const std::string& inputFile, const std::string& id_) :
     CROP_ln_gamma_k_min(-5.0),
     CROP_ln_gamma_k_max(15.0),
     m_last_is(-1.0),
+    m_last_is_gfunc(-1.0),
     m_debugCalc(0)
 {
     initThermoFile(inputFile, id_);
@@ -160,6 +162,7 @@ HMWSoln::HMWSoln(XML_Node& phaseRoot, const std::string& id_) :
     CROP_ln_gamma_k_min(-5.0),
     CROP_ln_gamma_k_max(15.0),
     m_last_is(-1.0),
+    m_last_is_gfunc(-1.0),
     m_debugCalc(0)
 {
     importPhase(phaseRoot, this);
@@ -985,7 +988,13 @@ void HMWSoln::counterIJ_setup() const
 
 void HMWSoln::s_updatePitzer_CoeffWRTemp(int doDerivs) const
 {
+    // The coefficients and their derivatives depend only on the temperature
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
     double T = temperature();
+    if (cached.validate(T)) {
+        return;
+    }
     const double twoT = 2.0 * T;
     const double invT = 1.0 / T;
     const double invT2 = invT * invT;
@@ -1298,53 +1307,10 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
         }
     }
 
-    debuglog(" Step 3: \n"
-             " Species          Species            g(x)  hfunc(x)\n",
-             m_debugCalc);
-
-    // calculate g(x) and hfunc(x) for each cation-anion pair MX. In the
-    // original literature, hfunc, was called gprime. However, it's not the
-    // derivative of g(x), so I renamed it.
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // Only loop over oppositely charge species
-            if (charge(i)*charge(j) < 0) {
-                // x is a reduced function variable
-                double x1 = sqrtIs * m_Alpha1MX_ij[counterIJ];
-                if (x1 > 1.0E-100) {
-                    m_gfunc_IJ[counterIJ] = 2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-                    m_hfunc_IJ[counterIJ] = -2.0 *
-                                       (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    m_gfunc_IJ[counterIJ] = 0.0;
-                    m_hfunc_IJ[counterIJ] = 0.0;
-                }
-
-                if (m_Beta2MX_ij[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * m_Alpha2MX_ij[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        m_g2func_IJ[counterIJ] = 2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        m_h2func_IJ[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        m_g2func_IJ[counterIJ] = 0.0;
-                        m_h2func_IJ[counterIJ] = 0.0;
-                    }
-                }
-            } else {
-                m_gfunc_IJ[counterIJ] = 0.0;
-                m_hfunc_IJ[counterIJ] = 0.0;
-            }
-            if (m_debugCalc) {
-                writelogf(" %-16s %-16s %9.5f %9.5f \n", speciesName(i),
-                          speciesName(j), m_gfunc_IJ[counterIJ], m_hfunc_IJ[counterIJ]);
-            }
-        }
-    }
+    // Step 3: Find g(x) and hfunc(x) for each cation-anion pair MX. These
+    // depend only on the ionic strength, and are shared with the other
+    // activity coefficient routines.
+    calc_gfuncs(Is);
 
     // SUBSECTION TO CALCULATE BMX, BprimeMX, BphiMX
     // Agrees with Pitzer, Eq. (49), (51), (55)
@@ -2024,55 +1990,10 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
         }
     }
 
-    debuglog(" Step 3: \n"
-             " Species          Species            g(x)  hfunc(x)   \n",
-             m_debugCalc);
-
-    // calculate g(x) and hfunc(x) for each cation-anion pair MX
-    // In the original literature, hfunc, was called gprime. However,
-    // it's not the derivative of g(x), so I renamed it.
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // Only loop over oppositely charge species
-            if (charge(i)*charge(j) < 0) {
-                // x is a reduced function variable
-                double x1 = sqrtIs * m_Alpha1MX_ij[counterIJ];
-                if (x1 > 1.0E-100) {
-                    m_gfunc_IJ[counterIJ] = 2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-                    m_hfunc_IJ[counterIJ] = -2.0 *
-                                       (1.0-(1.0 + x1 + 0.5 * x1 *x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    m_gfunc_IJ[counterIJ] = 0.0;
-                    m_hfunc_IJ[counterIJ] = 0.0;
-                }
-
-                if (m_Beta2MX_ij_L[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * m_Alpha2MX_ij[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        m_g2func_IJ[counterIJ] = 2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        m_h2func_IJ[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        m_g2func_IJ[counterIJ] = 0.0;
-                        m_h2func_IJ[counterIJ] = 0.0;
-                    }
-                }
-            } else {
-                m_gfunc_IJ[counterIJ] = 0.0;
-                m_hfunc_IJ[counterIJ] = 0.0;
-            }
-            if (m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                writelogf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
-                          m_gfunc_IJ[counterIJ], m_hfunc_IJ[counterIJ]);
-            }
-        }
-    }
+    // Step 3: Find g(x) and hfunc(x) for each cation-anion pair MX. These
+    // depend only on the ionic strength, and are shared with the other
+    // activity coefficient routines.
+    calc_gfuncs(Is);
 
     // SUBSECTION TO CALCULATE BMX_L, BprimeMX_L, BphiMX_L
     // These are now temperature derivatives of the previously calculated
@@ -2633,53 +2554,10 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
         }
     }
 
-    debuglog(" Step 3: \n"
-             " Species          Species            g(x)  hfunc(x)   \n",
-             m_debugCalc);
-
-    // calculate gfunc(x) and hfunc(x) for each cation-anion pair MX. In the
-    // original literature, hfunc, was called gprime. However, it's not the
-    // derivative of gfunc(x), so I renamed it.
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // Only loop over oppositely charge species
-            if (charge(i)*charge(j) < 0) {
-                // x is a reduced function variable
-                double x1 = sqrtIs * m_Alpha1MX_ij[counterIJ];
-                if (x1 > 1.0E-100) {
-                    m_gfunc_IJ[counterIJ] = 2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 *x1);
-                    m_hfunc_IJ[counterIJ] = -2.0*
-                                       (1.0-(1.0 + x1 + 0.5*x1 * x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    m_gfunc_IJ[counterIJ] = 0.0;
-                    m_hfunc_IJ[counterIJ] = 0.0;
-                }
-
-                if (m_Beta2MX_ij_LL[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * m_Alpha2MX_ij[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        m_g2func_IJ[counterIJ] = 2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        m_h2func_IJ[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        m_g2func_IJ[counterIJ] = 0.0;
-                        m_h2func_IJ[counterIJ] = 0.0;
-                    }
-                }
-            } else {
-                m_gfunc_IJ[counterIJ] = 0.0;
-                m_hfunc_IJ[counterIJ] = 0.0;
-            }
-            if (m_debugCalc) {
-                writelogf(" %-16s %-16s %9.5f %9.5f \n", speciesName(i), speciesName(j),
-                          m_gfunc_IJ[counterIJ], m_hfunc_IJ[counterIJ]);
-            }
-        }
-    }
+    // Step 3: Find g(x) and hfunc(x) for each cation-anion pair MX. These
+    // depend only on the ionic strength, and are shared with the other
+    // activity coefficient routines.
+    calc_gfuncs(Is);
 
     // SUBSECTION TO CALCULATE BMX_L, BprimeMX_LL, BphiMX_L
     // These are now temperature derivatives of the previously calculated
@@ -3238,53 +3116,10 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
         }
     }
 
-    debuglog(" Step 3: \n"
-             " Species          Species            g(x)  hfunc(x)\n",
-             m_debugCalc);
-
-    // calculate g(x) and hfunc(x) for each cation-anion pair MX
-    // In the original literature, hfunc, was called gprime. However,
-    // it's not the derivative of g(x), so I renamed it.
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // Only loop over oppositely charge species
-            if (charge(i)*charge(j) < 0) {
-                // x is a reduced function variable
-                double x1 = sqrtIs * m_Alpha1MX_ij[counterIJ];
-                if (x1 > 1.0E-100) {
-                    m_gfunc_IJ[counterIJ] = 2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-                    m_hfunc_IJ[counterIJ] = -2.0*
-                                       (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    m_gfunc_IJ[counterIJ] = 0.0;
-                    m_hfunc_IJ[counterIJ] = 0.0;
-                }
-
-                if (m_Beta2MX_ij_P[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * m_Alpha2MX_ij[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        m_g2func_IJ[counterIJ] = 2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        m_h2func_IJ[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        m_g2func_IJ[counterIJ] = 0.0;
-                        m_h2func_IJ[counterIJ] = 0.0;
-                    }
-                }
-            } else {
-                m_gfunc_IJ[counterIJ] = 0.0;
-                m_hfunc_IJ[counterIJ] = 0.0;
-            }
-            if (m_debugCalc) {
-                writelogf(" %-16s %-16s %9.5f %9.5f \n", speciesName(i),
-                          speciesName(j), m_gfunc_IJ[counterIJ], m_hfunc_IJ[counterIJ]);
-            }
-        }
-    }
+    // Step 3: Find g(x) and hfunc(x) for each cation-anion pair MX. These
+    // depend only on the ionic strength, and are shared with the other
+    // activity coefficient routines.
+    calc_gfuncs(Is);
 
     // SUBSECTION TO CALCULATE BMX_P, BprimeMX_P, BphiMX_P
     // These are now temperature derivatives of the previously calculated
@@ -3799,6 +3634,54 @@ void HMWSoln::calc_lambdas(double is) const
     }
 }
 
+void HMWSoln::calc_gfuncs(double is) const
+{
+    if (m_last_is_gfunc == is) {
+        return;
+    }
+    m_last_is_gfunc = is;
+    double sqrtIs = sqrt(is);
+    debuglog(" Step 3: \n"
+             " Species          Species            g(x)  hfunc(x)\n",
+             m_debugCalc);
+    for (size_t i = 1; i < (m_kk - 1); i++) {
+        for (size_t j = (i+1); j < m_kk; j++) {
+            size_t counterIJ = m_CounterIJ[m_kk*i + j];
+            if (charge(i)*charge(j) < 0) {
+                // x is a reduced function variable
+                double x1 = sqrtIs * m_Alpha1MX_ij[counterIJ];
+                if (x1 > 1.0E-100) {
+                    double ex = exp(-x1);
+                    m_gfunc_IJ[counterIJ] = 2.0*(1.0-(1.0 + x1) * ex) / (x1 * x1);
+                    m_hfunc_IJ[counterIJ] = -2.0 *
+                        (1.0-(1.0 + x1 + 0.5 * x1 * x1) * ex) / (x1 * x1);
+                } else {
+                    m_gfunc_IJ[counterIJ] = 0.0;
+                    m_hfunc_IJ[counterIJ] = 0.0;
+                }
+
+                double x2 = sqrtIs * m_Alpha2MX_ij[counterIJ];
+                if (x2 > 1.0E-100) {
+                    double ex = exp(-x2);
+                    m_g2func_IJ[counterIJ] = 2.0*(1.0-(1.0 + x2) * ex) / (x2 * x2);
+                    m_h2func_IJ[counterIJ] = -2.0 *
+                        (1.0-(1.0 + x2 + 0.5 * x2 * x2) * ex) / (x2 * x2);
+                } else {
+                    m_g2func_IJ[counterIJ] = 0.0;
+                    m_h2func_IJ[counterIJ] = 0.0;
+                }
+            } else {
+                m_gfunc_IJ[counterIJ] = 0.0;
+                m_hfunc_IJ[counterIJ] = 0.0;
+            }
+            if (m_debugCalc) {
+                writelogf(" %-16s %-16s %9.5f %9.5f \n", speciesName(i),
+                          speciesName(j), m_gfunc_IJ[counterIJ], m_hfunc_IJ[counterIJ]);
+            }
+        }
+    }
+}
+
 void HMWSoln::calc_thetas(int z1, int z2,
                           double* etheta, double* etheta_prime) const
 {
@@ -1221,6 +1221,10 @@ void HMWSoln::initThermoXML(XML_Node& phaseNode, const std::string& id_)
 
         // Go look up the optional Cropping parameters
         readXMLCroppingCoefficients(acNode);
+
+        // Values which depend on the Pitzer coefficients may have been cached
+        m_cache.clear();
+        m_last_is_gfunc = -1.0;
     }
 
     // Fill in the vector specifying the electrolyte species type
@@ -11,6 +11,7 @@
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/thermo/ThermoFactory.h"
 #include "cantera/base/utilities.h"
+#include "cantera/base/Tracer.h"
 
 using namespace std;
 
@@ -284,6 +285,7 @@ void IdealGasPhase::_updateThermo() const
     // If the temperature has changed since the last time these
     // properties were computed, recompute them.
     if (cached.state1 != tnow) {
+        TraceSpan span("IdealGasPhase::_updateThermo", "thermo");
         m_spthermo.update(tnow, &m_cp0_R[0], &m_h0_RT[0], &m_s0_R[0]);
         cached.state1 = tnow;
 
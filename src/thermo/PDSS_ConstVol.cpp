@@ -101,4 +101,13 @@ doublereal PDSS_ConstVol::satPressure(doublereal t)
     return 1.0E-200;
 }
 
+bool PDSS_ConstVol::getMolarVolumeDerivs(double temp, double& V, double& dVdT,
+                                         double& d2VdT2) const
+{
+    V = m_constMolarVolume;
+    dVdT = 0.0;
+    d2VdT2 = 0.0;
+    return true;
+}
+
 }
@@ -19,12 +19,187 @@ using namespace std;
 
 namespace Cantera
 {
+
+HKFT_SolventProps::HKFT_SolventProps(PDSS_Water* water)
+    : m_water(water)
+    , m_waterProps(new WaterProps(water))
+    , m_last(0)
+    , m_Tpref(-1.0)
+    , m_pref(0.0)
+{
+    for (State& s : m_states) {
+        s.temp = -1.0;
+        s.pres = -1.0;
+        s.gstarValid = false;
+    }
+}
+
+HKFT_SolventProps::~HKFT_SolventProps()
+{
+}
+
+HKFT_SolventProps::State& HKFT_SolventProps::state(double temp, double pres)
+{
+    for (size_t i = 0; i < 2; i++) {
+        State& s = m_states[(m_last + i) % 2];
+        if (s.temp == temp && s.pres == pres) {
+            m_last = (m_last + i) % 2;
+            return s;
+        }
+    }
+    // Replace the least recently used state
+    m_last = 1 - m_last;
+    State& s = m_states[m_last];
+    s.temp = temp;
+    s.pres = pres;
+    for (int ifunc = 0; ifunc < 4; ifunc++) {
+        s.relEps[ifunc] = m_waterProps->relEpsilon(temp, pres, ifunc);
+    }
+    s.gstarValid = false;
+    return s;
+}
+
+double HKFT_SolventProps::relEpsilon(double temp, double pres, int ifunc)
+{
+    return state(temp, pres).relEps[ifunc];
+}
+
+double HKFT_SolventProps::gstar(double temp, double pres, int ifunc)
+{
+    State& s = state(temp, pres);
+    if (!s.gstarValid) {
+        calcGstar(s);
+    }
+    return s.gstar[ifunc];
+}
+
+double HKFT_SolventProps::pref_safe(double temp)
+{
+    if (temp != m_Tpref) {
+        m_pref = m_water->pref_safe(temp);
+        m_Tpref = temp;
+    }
+    return m_pref;
+}
+
+void HKFT_SolventProps::calcGstar(State& s)
+{
+    double temp = s.temp;
+    s.gstarValid = true;
+    for (int ifunc = 0; ifunc < 4; ifunc++) {
+        s.gstar[ifunc] = - f(temp, s.pres, ifunc);
+    }
+
+    // Function g appearing in the Johnson et al. formulation
+    double afunc = ag(temp, 0);
+    double bfunc = bg(temp, 0);
+    m_water->setState_TP(temp, s.pres);
+    // density in gm cm-3
+    double dens = m_water->density() * 1.0E-3;
+    if (dens >= 1.0) {
+        return;
+    }
+    double gval = afunc * pow((1.0-dens), bfunc);
+    s.gstar[0] += gval;
+
+    double afuncdT = ag(temp, 1);
+    double bfuncdT = bg(temp, 1);
+    double alpha = m_water->thermalExpansionCoeff();
+
+    double fac1 = afuncdT * gval / afunc;
+    double fac2 = bfuncdT * gval * log(1.0 - dens);
+    double fac3 = gval * alpha * bfunc * dens / (1.0 - dens);
+
+    double dgdt = fac1 + fac2 + fac3;
+    s.gstar[1] += dgdt;
+
+    double beta = m_water->isothermalCompressibility();
+    s.gstar[3] += - bfunc * gval * dens * beta / (1.0 - dens);
+
+    double afuncdT2 = ag(temp, 2);
+    double bfuncdT2 = bg(temp, 2);
+    double dfac1dT = dgdt * afuncdT / afunc + afuncdT2 * gval / afunc
+                     -  afuncdT * afuncdT * gval / (afunc * afunc);
+    double ddensdT = - alpha * dens;
+    double dfac2dT = bfuncdT2 * gval * log(1.0 - dens)
+                     + bfuncdT * dgdt * log(1.0 - dens)
+                     - bfuncdT * gval /(1.0 - dens) * ddensdT;
+    double dalphadT = m_water->dthermalExpansionCoeffdT();
+    double dfac3dT = dgdt * alpha * bfunc * dens / (1.0 - dens)
+                     + gval * dalphadT * bfunc * dens / (1.0 - dens)
+                     + gval * alpha * bfuncdT * dens / (1.0 - dens)
+                     + gval * alpha * bfunc * ddensdT / (1.0 - dens)
+                     + gval * alpha * bfunc * dens / ((1.0 - dens) * (1.0 - dens)) * ddensdT;
+    s.gstar[2] += dfac1dT + dfac2dT + dfac3dT;
+}
+
+double HKFT_SolventProps::ag(double temp, int ifunc)
+{
+    static doublereal ag_coeff[3] = { -2.037662, 5.747000E-3, -6.557892E-6};
+    if (ifunc == 0) {
+        return ag_coeff[0] + ag_coeff[1] * temp + ag_coeff[2] * temp * temp;
+    } else if (ifunc == 1) {
+        return ag_coeff[1] + ag_coeff[2] * 2.0 * temp;
+    }
+    if (ifunc != 2) {
+        return 0.0;
+    }
+    return ag_coeff[2] * 2.0;
+}
+
+double HKFT_SolventProps::bg(double temp, int ifunc)
+{
+    static doublereal bg_coeff[3] = { 6.107361, -1.074377E-2, 1.268348E-5};
+    if (ifunc == 0) {
+        return bg_coeff[0] + bg_coeff[1] * temp + bg_coeff[2] * temp * temp;
+    }   else if (ifunc == 1) {
+        return bg_coeff[1] + bg_coeff[2] * 2.0 * temp;
+    }
+    if (ifunc != 2) {
+        return 0.0;
+    }
+    return bg_coeff[2] * 2.0;
+}
+
+double HKFT_SolventProps::f(double temp, double pres, int ifunc)
+{
+    static doublereal af_coeff[3] = { 3.666666E1, -0.1504956E-9, 0.5107997E-13};
+    doublereal TC = temp - 273.15;
+    doublereal presBar = pres / 1.0E5;
+
+    if (TC < 155.0) {
+        return 0.0;
+    }
+    TC = std::min(TC, 355.0);
+    if (presBar > 1000.) {
+        return 0.0;
+    }
+
+    doublereal T1 = (TC-155.0)/300.;
+    doublereal p2 = (1000. - presBar) * (1000. - presBar);
+    doublereal p3 = (1000. - presBar) * p2;
+    doublereal p4 = p2 * p2;
+    doublereal fac2 = af_coeff[1] * p3 + af_coeff[2] * p4;
+    if (ifunc == 0) {
+        return pow(T1,4.8) + af_coeff[0] * pow(T1, 16.0) * fac2;
+    } else if (ifunc == 1) {
+        return (4.8 * pow(T1,3.8) + 16.0 * af_coeff[0] * pow(T1, 15.0)) / 300. * fac2;
+    } else if (ifunc == 2) {
+        return (4.8 * 3.8 * pow(T1,2.8) + 16.0 * 15.0 * af_coeff[0] * pow(T1, 14.0)) / (300. * 300.) * fac2;
+    } else if (ifunc == 3) {
+        double fac1 = pow(T1,4.8) + af_coeff[0] * pow(T1, 16.0);
+        fac2 = - (3.0 * af_coeff[1] * p2 + 4.0 * af_coeff[2] * p3)/ 1.0E5;
+        return fac1 * fac2;
+    } else {
+        throw CanteraError("HKFT_SolventProps::f", "unimplemented");
+    }
+}
+
 // Set the default to error exit if there is an input file inconsistency
 int PDSS_HKFT::s_InputInconsistencyErrorExit = 1;
 
 PDSS_HKFT::PDSS_HKFT()
     : m_waterSS(0)
-    , m_densWaterSS(-1.0)
     , m_born_coeff_j(-1.0)
     , m_r_e_j(-1.0)
     , m_deltaG_formation_tr_pr(0.0)
@@ -115,10 +290,10 @@ doublereal PDSS_HKFT::cp_mole() const
                              -2.0*m_charge_j*dgvaldT*dgvaldT/(r_e_H2*r_e_H) + m_charge_j*d2gvaldT2 /r_e_H2);
     }
 
-    doublereal relepsilon = m_waterProps->relEpsilon(m_temp, m_pres, 0);
-    doublereal drelepsilondT = m_waterProps->relEpsilon(m_temp, m_pres, 1);
+    doublereal relepsilon = m_solvent->relEpsilon(m_temp, m_pres, 0);
+    doublereal drelepsilondT = m_solvent->relEpsilon(m_temp, m_pres, 1);
     doublereal Y = drelepsilondT / (relepsilon * relepsilon);
-    doublereal d2relepsilondT2 = m_waterProps->relEpsilon(m_temp, m_pres, 2);
+    doublereal d2relepsilondT2 = m_solvent->relEpsilon(m_temp, m_pres, 2);
 
     doublereal X = d2relepsilondT2 / (relepsilon* relepsilon) - 2.0 * relepsilon * Y * Y;
     doublereal Z = -1.0 / relepsilon;
@@ -167,8 +342,8 @@ doublereal PDSS_HKFT::molarVolume() const
                      + nu * m_charge_j / (r_e_H * r_e_H) * dgvaldP;
     }
 
-    doublereal drelepsilondP = m_waterProps->relEpsilon(m_temp, m_pres, 3);
-    doublereal relepsilon = m_waterProps->relEpsilon(m_temp, m_pres, 0);
+    doublereal drelepsilondP = m_solvent->relEpsilon(m_temp, m_pres, 3);
+    doublereal relepsilon = m_solvent->relEpsilon(m_temp, m_pres, 0);
     doublereal Q = drelepsilondP / (relepsilon * relepsilon);
     doublereal Z = -1.0 / relepsilon;
     doublereal wterm = - domega_jdP * (Z + 1.0);
@@ -187,7 +362,7 @@ doublereal PDSS_HKFT::density() const
 doublereal PDSS_HKFT::gibbs_RT_ref() const
 {
     doublereal m_psave = m_pres;
-    m_pres = m_waterSS->pref_safe(m_temp);
+    m_pres = m_solvent->pref_safe(m_temp);
     doublereal ee = gibbs_RT();
     m_pres = m_psave;
     return ee;
@@ -196,7 +371,7 @@ doublereal PDSS_HKFT::gibbs_RT_ref() const
 doublereal PDSS_HKFT::enthalpy_RT_ref() const
 {
     doublereal m_psave = m_pres;
-    m_pres = m_waterSS->pref_safe(m_temp);
+    m_pres = m_solvent->pref_safe(m_temp);
     doublereal hh = enthalpy_RT();
     m_pres = m_psave;
     return hh;
@@ -205,7 +380,7 @@ doublereal PDSS_HKFT::enthalpy_RT_ref() const
 doublereal PDSS_HKFT::entropy_R_ref() const
 {
     doublereal m_psave = m_pres;
-    m_pres = m_waterSS->pref_safe(m_temp);
+    m_pres = m_solvent->pref_safe(m_temp);
     doublereal ee = entropy_R();
     m_pres = m_psave;
     return ee;
@@ -214,7 +389,7 @@ doublereal PDSS_HKFT::entropy_R_ref() const
 doublereal PDSS_HKFT::cp_R_ref() const
 {
     doublereal m_psave = m_pres;
-    m_pres = m_waterSS->pref_safe(m_temp);
+    m_pres = m_solvent->pref_safe(m_temp);
     doublereal ee = cp_R();
     m_pres = m_psave;
     return ee;
@@ -223,7 +398,7 @@ doublereal PDSS_HKFT::cp_R_ref() const
 doublereal PDSS_HKFT::molarVolume_ref() const
 {
     doublereal m_psave = m_pres;
-    m_pres = m_waterSS->pref_safe(m_temp);
+    m_pres = m_solvent->pref_safe(m_temp);
     doublereal ee = molarVolume();
     m_pres = m_psave;
     return ee;
@@ -241,16 +416,25 @@ void PDSS_HKFT::initThermo()
 
     m_waterSS = &dynamic_cast<PDSS_Water&>(*m_tp->providePDSS(0));
 
+    // Share the solvent properties with the other HKFT species in the phase
+    m_solvent.reset();
+    for (size_t k = 0; k < m_spindex && !m_solvent; k++) {
+        auto other = dynamic_cast<PDSS_HKFT*>(m_tp->providePDSS(k));
+        if (other && other->m_solvent && other->m_waterSS == m_waterSS) {
+            m_solvent = other->m_solvent;
+        }
+    }
+    if (!m_solvent) {
+        m_solvent = make_shared<HKFT_SolventProps>(m_waterSS);
+    }
+
     // Section to initialize m_Z_pr_tr and m_Y_pr_tr
     m_temp = 273.15 + 25.;
     m_pres = OneAtm;
-    doublereal relepsilon = m_waterProps->relEpsilon(m_temp, m_pres, 0);
-    m_waterSS->setState_TP(m_temp, m_pres);
-    m_densWaterSS = m_waterSS->density();
+    doublereal relepsilon = m_solvent->relEpsilon(m_temp, m_pres, 0);
     m_Z_pr_tr = -1.0 / relepsilon;
-    doublereal drelepsilondT = m_waterProps->relEpsilon(m_temp, m_pres, 1);
+    doublereal drelepsilondT = m_solvent->relEpsilon(m_temp, m_pres, 1);
     m_Y_pr_tr = drelepsilondT / (relepsilon * relepsilon);
-    m_waterProps.reset(new WaterProps(m_waterSS));
     m_presR_bar = OneAtm / 1.0E5;
     m_presR_bar = 1.0;
     m_charge_j = m_tp->charge(m_spindex);
@@ -462,8 +646,8 @@ doublereal PDSS_HKFT::deltaH() const
                      + nu * m_charge_j / (3.082 + gval) / (3.082 + gval) * dgvaldT;
     }
 
-    doublereal relepsilon = m_waterProps->relEpsilon(m_temp, m_pres, 0);
-    doublereal drelepsilondT = m_waterProps->relEpsilon(m_temp, m_pres, 1);
+    doublereal relepsilon = m_solvent->relEpsilon(m_temp, m_pres, 0);
+    doublereal drelepsilondT = m_solvent->relEpsilon(m_temp, m_pres, 1);
 
     doublereal Y = drelepsilondT / (relepsilon * relepsilon);
     doublereal Z = -1.0 / relepsilon;
@@ -507,7 +691,7 @@ doublereal PDSS_HKFT::deltaG() const
         omega_j = nu * (m_charge_j * m_charge_j / r_e_j - m_charge_j / (3.082 + gval));
     }
 
-    doublereal relepsilon = m_waterProps->relEpsilon(m_temp, m_pres, 0);
+    doublereal relepsilon = m_solvent->relEpsilon(m_temp, m_pres, 0);
     doublereal Z = -1.0 / relepsilon;
     doublereal wterm = - omega_j * (Z + 1.0);
     doublereal wrterm = m_omega_pr_tr * (m_Z_pr_tr + 1.0);
@@ -545,8 +729,8 @@ doublereal PDSS_HKFT::deltaS() const
                      + nu * m_charge_j / (3.082 + gval) / (3.082 + gval) * dgvaldT;
     }
 
-    doublereal relepsilon = m_waterProps->relEpsilon(m_temp, m_pres, 0);
-    doublereal drelepsilondT = m_waterProps->relEpsilon(m_temp, m_pres, 1);
+    doublereal relepsilon = m_solvent->relEpsilon(m_temp, m_pres, 0);
+    doublereal drelepsilondT = m_solvent->relEpsilon(m_temp, m_pres, 1);
     doublereal Y = drelepsilondT / (relepsilon * relepsilon);
     doublereal Z = -1.0 / relepsilon;
     doublereal wterm = omega_j * Y;
@@ -559,127 +743,9 @@ doublereal PDSS_HKFT::deltaS() const
     return deltaS_calgmol * toSI("cal/gmol");
 }
 
-doublereal PDSS_HKFT::ag(const doublereal temp, const int ifunc) const
-{
-    static doublereal ag_coeff[3] = { -2.037662, 5.747000E-3, -6.557892E-6};
-    if (ifunc == 0) {
-        return ag_coeff[0] + ag_coeff[1] * temp + ag_coeff[2] * temp * temp;
-    } else if (ifunc == 1) {
-        return ag_coeff[1] + ag_coeff[2] * 2.0 * temp;
-    }
-    if (ifunc != 2) {
-        return 0.0;
-    }
-    return ag_coeff[2] * 2.0;
-}
-
-doublereal PDSS_HKFT::bg(const doublereal temp, const int ifunc) const
-{
-    static doublereal bg_coeff[3] = { 6.107361, -1.074377E-2, 1.268348E-5};
-    if (ifunc == 0) {
-        return bg_coeff[0] + bg_coeff[1] * temp + bg_coeff[2] * temp * temp;
-    }   else if (ifunc == 1) {
-        return bg_coeff[1] + bg_coeff[2] * 2.0 * temp;
-    }
-    if (ifunc != 2) {
-        return 0.0;
-    }
-    return bg_coeff[2] * 2.0;
-}
-
-doublereal PDSS_HKFT::f(const doublereal temp, const doublereal pres, const int ifunc) const
-{
-    static doublereal af_coeff[3] = { 3.666666E1, -0.1504956E-9, 0.5107997E-13};
-    doublereal TC = temp - 273.15;
-    doublereal presBar = pres / 1.0E5;
-
-    if (TC < 155.0) {
-        return 0.0;
-    }
-    TC = std::min(TC, 355.0);
-    if (presBar > 1000.) {
-        return 0.0;
-    }
-
-    doublereal T1 = (TC-155.0)/300.;
-    doublereal p2 = (1000. - presBar) * (1000. - presBar);
-    doublereal p3 = (1000. - presBar) * p2;
-    doublereal p4 = p2 * p2;
-    doublereal fac2 = af_coeff[1] * p3 + af_coeff[2] * p4;
-    if (ifunc == 0) {
-        return pow(T1,4.8) + af_coeff[0] * pow(T1, 16.0) * fac2;
-    } else if (ifunc == 1) {
-        return (4.8 * pow(T1,3.8) + 16.0 * af_coeff[0] * pow(T1, 15.0)) / 300. * fac2;
-    } else if (ifunc == 2) {
-        return (4.8 * 3.8 * pow(T1,2.8) + 16.0 * 15.0 * af_coeff[0] * pow(T1, 14.0)) / (300. * 300.) * fac2;
-    } else if (ifunc == 3) {
-        double fac1 = pow(T1,4.8) + af_coeff[0] * pow(T1, 16.0);
-        fac2 = - (3.0 * af_coeff[1] * p2 + 4.0 * af_coeff[2] * p3)/ 1.0E5;
-        return fac1 * fac2;
-    } else {
-        throw CanteraError("HKFT_PDSS::gg", "unimplemented");
-    }
-}
-
-doublereal PDSS_HKFT::g(const doublereal temp, const doublereal pres, const int ifunc) const
-{
-    doublereal afunc = ag(temp, 0);
-    doublereal bfunc = bg(temp, 0);
-    m_waterSS->setState_TP(temp, pres);
-    m_densWaterSS = m_waterSS->density();
-    // density in gm cm-3
-    doublereal dens = m_densWaterSS * 1.0E-3;
-    doublereal gval = afunc * pow((1.0-dens), bfunc);
-    if (dens >= 1.0) {
-        return 0.0;
-    }
-    if (ifunc == 0) {
-        return gval;
-    } else if (ifunc == 1 || ifunc == 2) {
-        doublereal afuncdT = ag(temp, 1);
-        doublereal bfuncdT = bg(temp, 1);
-        doublereal alpha = m_waterSS->thermalExpansionCoeff();
-
-        doublereal fac1 = afuncdT * gval / afunc;
-        doublereal fac2 = bfuncdT * gval * log(1.0 - dens);
-        doublereal fac3 = gval * alpha * bfunc * dens / (1.0 - dens);
-
-        doublereal dgdt = fac1 + fac2 + fac3;
-        if (ifunc == 1) {
-            return dgdt;
-        }
-
-        doublereal afuncdT2 = ag(temp, 2);
-        doublereal bfuncdT2 = bg(temp, 2);
-        doublereal dfac1dT = dgdt * afuncdT / afunc + afuncdT2 * gval / afunc
-                             -  afuncdT * afuncdT * gval / (afunc * afunc);
-        doublereal ddensdT = - alpha * dens;
-        doublereal dfac2dT = bfuncdT2 * gval * log(1.0 - dens)
-                              + bfuncdT * dgdt * log(1.0 - dens)
-                              - bfuncdT * gval /(1.0 - dens) * ddensdT;
-        doublereal dalphadT = m_waterSS->dthermalExpansionCoeffdT();
-        doublereal dfac3dT = dgdt * alpha * bfunc * dens / (1.0 - dens)
-                             + gval * dalphadT * bfunc * dens / (1.0 - dens)
-                             + gval * alpha * bfuncdT * dens / (1.0 - dens)
-                             + gval * alpha * bfunc * ddensdT / (1.0 - dens)
-                             + gval * alpha * bfunc * dens / ((1.0 - dens) * (1.0 - dens)) * ddensdT;
-
-        return dfac1dT + dfac2dT + dfac3dT;
-    } else if (ifunc == 3) {
-        doublereal beta = m_waterSS->isothermalCompressibility();
-        return - bfunc * gval * dens * beta / (1.0 - dens);
-    } else {
-        throw CanteraError("HKFT_PDSS::g", "unimplemented");
-    }
-    return 0.0;
-}
-
 doublereal PDSS_HKFT::gstar(const doublereal temp, const doublereal pres, const int ifunc) const
 {
-    doublereal gval = g(temp, pres, ifunc);
-    doublereal fval = f(temp, pres, ifunc);
-    double res = gval - fval;
-    return res;
+    return m_solvent->gstar(temp, pres, ifunc);
 }
 
 doublereal PDSS_HKFT::LookupGe(const std::string& elemName)
@@ -19,10 +19,8 @@ namespace Cantera
 PDSS_SSVol::PDSS_SSVol()
     : volumeModel_(SSVolume_Model::constant)
     , m_constMolarVolume(-1.0)
+    , TCoeff_(4, 0.0)
 {
-    TCoeff_[0] = 0.0;
-    TCoeff_[1] = 0.0;
-    TCoeff_[2] = 0.0;
 }
 
 void PDSS_SSVol::setParametersFromXML(const XML_Node& speciesNode)
@@ -80,24 +78,33 @@ doublereal PDSS_SSVol::cv_mole() const
 }
 
 void PDSS_SSVol::calcMolarVolume()
+{
+    getMolarVolumeDerivs(m_temp, m_Vss, dVdT_, d2VdT2_);
+}
+
+bool PDSS_SSVol::getMolarVolumeDerivs(double temp, double& V, double& dVdT,
+                                      double& d2VdT2) const
 {
     if (volumeModel_ == SSVolume_Model::constant) {
-        m_Vss = m_constMolarVolume;
+        V = m_constMolarVolume;
+        dVdT = 0.0;
+        d2VdT2 = 0.0;
     } else if (volumeModel_ == SSVolume_Model::tpoly) {
-        m_Vss = TCoeff_[0] + m_temp * (TCoeff_[1] + m_temp * (TCoeff_[2] + m_temp * TCoeff_[3]));
-        dVdT_ = TCoeff_[1] + 2.0 * m_temp * TCoeff_[2] + 3.0 * m_temp * m_temp * TCoeff_[3];
-        d2VdT2_ = 2.0 * TCoeff_[2] + 6.0 * m_temp * TCoeff_[3];
+        V = TCoeff_[0] + temp * (TCoeff_[1] + temp * (TCoeff_[2] + temp * TCoeff_[3]));
+        dVdT = TCoeff_[1] + 2.0 * temp * TCoeff_[2] + 3.0 * temp * temp * TCoeff_[3];
+        d2VdT2 = 2.0 * TCoeff_[2] + 6.0 * temp * TCoeff_[3];
     } else if (volumeModel_ == SSVolume_Model::density_tpoly) {
-        doublereal dens = TCoeff_[0] + m_temp * (TCoeff_[1] + m_temp * (TCoeff_[2] + m_temp * TCoeff_[3]));
-        m_Vss = m_mw / dens;
+        doublereal dens = TCoeff_[0] + temp * (TCoeff_[1] + temp * (TCoeff_[2] + temp * TCoeff_[3]));
+        V = m_mw / dens;
         doublereal dens2 = dens * dens;
-        doublereal ddensdT = TCoeff_[1] + 2.0 * m_temp * TCoeff_[2] + 3.0 * m_temp * m_temp * TCoeff_[3];
-        doublereal d2densdT2 = 2.0 * TCoeff_[2] + 6.0 * m_temp * TCoeff_[3];
-        dVdT_ = - m_mw / dens2 * ddensdT;
-        d2VdT2_ = 2.0 * m_mw / (dens2 * dens) * ddensdT * ddensdT - m_mw / dens2 * d2densdT2;
+        doublereal ddensdT = TCoeff_[1] + 2.0 * temp * TCoeff_[2] + 3.0 * temp * temp * TCoeff_[3];
+        doublereal d2densdT2 = 2.0 * TCoeff_[2] + 6.0 * temp * TCoeff_[3];
+        dVdT = - m_mw / dens2 * ddensdT;
+        d2VdT2 = 2.0 * m_mw / (dens2 * dens) * ddensdT * ddensdT - m_mw / dens2 * d2densdT2;
     } else {
-        throw CanteraError("PDSS_SSVol::calcMolarVolume", "unimplemented");
+        throw CanteraError("PDSS_SSVol::getMolarVolumeDerivs", "unimplemented");
     }
+    return true;
 }
 
 void PDSS_SSVol::setPressure(doublereal p)
@@ -115,7 +122,7 @@ void PDSS_SSVol::setPressure(doublereal p)
         m_hss_RT = m_h0_RT + sV_term + del_pRT * m_Vss;
         m_sss_R = m_s0_R + sV_term;
         m_gss_RT = m_hss_RT - m_sss_R;
-        m_cpss_R = m_cp0_R - m_temp * deltaP * d2VdT2_;
+        m_cpss_R = m_cp0_R - m_temp * deltaP * d2VdT2_ / GasConstant;
     }
 }
 
@@ -137,7 +144,7 @@ void PDSS_SSVol::setTemperature(doublereal temp)
         m_hss_RT = m_h0_RT + sV_term + del_pRT * m_Vss;
         m_sss_R = m_s0_R + sV_term;
         m_gss_RT = m_hss_RT - m_sss_R;
-        m_cpss_R = m_cp0_R - m_temp * deltaP * d2VdT2_;
+        m_cpss_R = m_cp0_R - m_temp * deltaP * d2VdT2_ / GasConstant;
     }
 }
 
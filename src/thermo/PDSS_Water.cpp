@@ -92,6 +92,10 @@ doublereal PDSS_Water::molarVolume() const
 doublereal PDSS_Water::gibbs_RT_ref() const
 {
     doublereal T = m_temp;
+    WaterPropsTable::State ref;
+    if (lookup(T, m_p0, ref)) {
+        return (ref.enthalpy + EW_Offset - SW_Offset*T)/(T * GasConstant);
+    }
     m_sub.density(T, m_p0, m_iState);
     doublereal h = m_sub.enthalpy();
     m_sub.setState_TR(m_temp, m_dens);
@@ -101,6 +105,10 @@ doublereal PDSS_Water::gibbs_RT_ref() const
 doublereal PDSS_Water::enthalpy_RT_ref() const
 {
     doublereal T = m_temp;
+    WaterPropsTable::State ref;
+    if (lookup(T, m_p0, ref)) {
+        return (ref.enthalpy + EW_Offset)/(T * GasConstant);
+    }
     m_sub.density(T, m_p0, m_iState);
     doublereal h = m_sub.enthalpy();
     m_sub.setState_TR(m_temp, m_dens);
@@ -110,6 +118,10 @@ doublereal PDSS_Water::enthalpy_RT_ref() const
 doublereal PDSS_Water::entropy_R_ref() const
 {
     doublereal T = m_temp;
+    WaterPropsTable::State ref;
+    if (lookup(T, m_p0, ref)) {
+        return (ref.entropy + SW_Offset)/GasConstant;
+    }
     m_sub.density(T, m_p0, m_iState);
     doublereal s = m_sub.entropy();
     m_sub.setState_TR(m_temp, m_dens);
@@ -119,6 +131,10 @@ doublereal PDSS_Water::entropy_R_ref() const
 doublereal PDSS_Water::cp_R_ref() const
 {
     doublereal T = m_temp;
+    WaterPropsTable::State ref;
+    if (lookup(T, m_p0, ref)) {
+        return ref.cp/GasConstant;
+    }
     m_sub.density(T, m_p0, m_iState);
     doublereal cp = m_sub.cp();
     m_sub.setState_TR(m_temp, m_dens);
@@ -128,6 +144,10 @@ doublereal PDSS_Water::cp_R_ref() const
 doublereal PDSS_Water::molarVolume_ref() const
 {
     doublereal T = m_temp;
+    WaterPropsTable::State ref;
+    if (lookup(T, m_p0, ref)) {
+        return m_mw / ref.density;
+    }
     m_sub.density(T, m_p0, m_iState);
     doublereal mv = m_sub.molarVolume();
     m_sub.setState_TR(m_temp, m_dens);
@@ -151,7 +171,25 @@ void PDSS_Water::setPressure(doublereal p)
         waterState = WATER_SUPERCRIT;
     }
 
-    doublereal dd = m_sub.density(T, p, waterState, dens);
+    doublereal dd = -1.0;
+    WaterPropsTable::State s;
+    if (lookup(T, p, s)) {
+        // Refine the tabulated density with Newton iterations on the
+        // equation of state, as in WaterSSTP::setPressure
+        dd = s.density;
+        for (int n = 0; n < 5; n++) {
+            m_sub.setState_TR(T, dd);
+            double ddens = (p - m_sub.pressure()) * dd *
+                           m_sub.isothermalCompressibility();
+            dd += ddens;
+            if (std::abs(ddens) < 1e-14 * dd) {
+                break;
+            }
+        }
+        m_sub.setState_TR(T, dd);
+    } else {
+        dd = m_sub.density(T, p, waterState, dens);
+    }
     if (dd <= 0.0) {
         throw CanteraError("PDSS_Water:setPressure()",
             "Failed to set water SS state: T = {} K and p = {} Pa", T, p);
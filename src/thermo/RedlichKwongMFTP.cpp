@@ -24,6 +24,8 @@ RedlichKwongMFTP::RedlichKwongMFTP() :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_a0_mix(0.0),
+    m_a1_mix(0.0),
     NSolns_(0),
     Vroot_{0.0, 0.0, 0.0},
     dpdV_(0.0),
@@ -35,6 +37,8 @@ RedlichKwongMFTP::RedlichKwongMFTP(const std::string& infile, const std::string&
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_a0_mix(0.0),
+    m_a1_mix(0.0),
     NSolns_(0),
     Vroot_{0.0, 0.0, 0.0},
     dpdV_(0.0),
@@ -47,6 +51,8 @@ RedlichKwongMFTP::RedlichKwongMFTP(XML_Node& phaseRefRoot, const std::string& id
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_a0_mix(0.0),
+    m_a1_mix(0.0),
     NSolns_(0),
     Vroot_{0.0, 0.0, 0.0},
     dpdV_(0.0),
@@ -86,8 +92,9 @@ void RedlichKwongMFTP::setSpeciesCoeffs(const std::string& species,
             a_coeff_vec(1, k + m_kk * j) = a1kj;
         }
     }
-    a_coeff_vec.getRow(0, a_vec_Curr_.data());
     b_vec_Curr_[k] = b;
+    updateMixingSums();
+    updateAB();
 }
 
 void RedlichKwongMFTP::setBinaryCoeffs(const std::string& species_i,
@@ -111,7 +118,8 @@ void RedlichKwongMFTP::setBinaryCoeffs(const std::string& species_i,
     size_t counter2 = kj + m_kk * ki;
     a_coeff_vec(0, counter1) = a_coeff_vec(0, counter2) = a0;
     a_coeff_vec(1, counter1) = a_coeff_vec(1, counter2) = a1;
-    a_vec_Curr_[counter1] = a_vec_Curr_[counter2] = a0;
+    updateMixingSums();
+    updateAB();
 }
 
 // ------------Molar Thermodynamic Properties -------------------------
@@ -196,6 +204,7 @@ void RedlichKwongMFTP::setTemperature(const doublereal temp)
 void RedlichKwongMFTP::compositionChanged()
 {
     MixtureFugacityTP::compositionChanged();
+    updateMixingSums();
     updateAB();
 }
 
@@ -220,20 +229,13 @@ void RedlichKwongMFTP::getActivityCoefficients(doublereal* ac) const
     doublereal vpb = mv + m_b_current;
     doublereal vmb = mv - m_b_current;
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
     doublereal pres = pressure();
 
     for (size_t k = 0; k < m_kk; k++) {
         ac[k] = (- RT() * log(pres * mv / RT())
                  + RT() * log(mv / vmb)
                  + RT() * b_vec_Curr_[k] / vmb
-                 - 2.0 * m_pp[k] / (m_b_current * sqt) * log(vpb/mv)
+                 - 2.0 * m_aSum[k] / (m_b_current * sqt) * log(vpb/mv)
                  + m_a_current * b_vec_Curr_[k] / (m_b_current * m_b_current * sqt) * log(vpb/mv)
                  - m_a_current / (m_b_current * sqt) * (b_vec_Curr_[k]/vpb)
                 );
@@ -266,13 +268,6 @@ void RedlichKwongMFTP::getChemPotentials(doublereal* mu) const
     doublereal vpb = mv + m_b_current;
     doublereal vmb = mv - m_b_current;
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
     doublereal pres = pressure();
     doublereal refP = refPressure();
 
@@ -280,7 +275,7 @@ void RedlichKwongMFTP::getChemPotentials(doublereal* mu) const
         mu[k] += (RT() * log(pres/refP) - RT() * log(pres * mv / RT())
                   + RT() * log(mv / vmb)
                   + RT() * b_vec_Curr_[k] / vmb
-                  - 2.0 * m_pp[k] / (m_b_current * sqt) * log(vpb/mv)
+                  - 2.0 * m_aSum[k] / (m_b_current * sqt) * log(vpb/mv)
                   + m_a_current * b_vec_Curr_[k] / (m_b_current * m_b_current * sqt) * log(vpb/mv)
                   - m_a_current / (m_b_current * sqt) * (b_vec_Curr_[k]/vpb)
                  );
@@ -300,32 +295,19 @@ void RedlichKwongMFTP::getPartialMolarEnthalpies(doublereal* hbar) const
     doublereal vpb = mv + m_b_current;
     doublereal vmb = mv - m_b_current;
     for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
-    for (size_t k = 0; k < m_kk; k++) {
-        dpdni_[k] = RT()/vmb + RT() * b_vec_Curr_[k] / (vmb * vmb) - 2.0 * m_pp[k] / (sqt * mv * vpb)
+        dpdni_[k] = RT()/vmb + RT() * b_vec_Curr_[k] / (vmb * vmb) - 2.0 * m_aSum[k] / (sqt * mv * vpb)
                     + m_a_current * b_vec_Curr_[k]/(sqt * mv * vpb * vpb);
     }
     doublereal dadt = da_dt();
     doublereal fac = TKelvin * dadt - 3.0 * m_a_current / 2.0;
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_tmpV[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_tmpV[k] += 2.0 * moleFractions_[i] * TKelvin * a_coeff_vec(1,counter) - 3.0 * moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
 
     pressureDerivatives();
     doublereal fac2 = mv + TKelvin * dpdT_ / dpdV_;
     for (size_t k = 0; k < m_kk; k++) {
         double hE_v = (mv * dpdni_[k] - RT() - b_vec_Curr_[k]/ (m_b_current * m_b_current * sqt) * log(vpb/mv)*fac
-                       + 1.0 / (m_b_current * sqt) * log(vpb/mv) * m_tmpV[k]
+                       + 1.0 / (m_b_current * sqt) * log(vpb/mv)
+                           * (2.0 * TKelvin * m_a1Sum[k] - 3.0 * m_aSum[k])
                        +  b_vec_Curr_[k] / vpb / (m_b_current * sqt) * fac);
         hbar[k] = hbar[k] + hE_v;
         hbar[k] -= fac2 * dpdni_[k];
@@ -345,20 +327,6 @@ void RedlichKwongMFTP::getPartialMolarEntropies(doublereal* sbar) const
         doublereal xx = std::max(SmallNumber, moleFraction(k));
         sbar[k] += GasConstant * (- log(xx));
     }
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
-    for (size_t k = 0; k < m_kk; k++) {
-        m_tmpV[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_tmpV[k] += moleFractions_[i] * a_coeff_vec(1,counter);
-        }
-    }
 
     doublereal dadt = da_dt();
     doublereal fac = dadt - m_a_current / (2.0 * TKelvin);
@@ -369,8 +337,8 @@ void RedlichKwongMFTP::getPartialMolarEntropies(doublereal* sbar) const
                    + GasConstant
                    + GasConstant * log(mv/vmb)
                    + GasConstant * b_vec_Curr_[k]/vmb
-                   + m_pp[k]/(m_b_current * TKelvin * sqt) * log(vpb/mv)
-                   - 2.0 * m_tmpV[k]/(m_b_current * sqt) * log(vpb/mv)
+                   + m_aSum[k]/(m_b_current * TKelvin * sqt) * log(vpb/mv)
+                   - 2.0 * m_a1Sum[k]/(m_b_current * sqt) * log(vpb/mv)
                    + b_vec_Curr_[k] / (m_b_current * m_b_current * sqt) * log(vpb/mv) * fac
                    - 1.0 / (m_b_current * sqt) * b_vec_Curr_[k] / vpb * fac
                   );
@@ -397,20 +365,6 @@ void RedlichKwongMFTP::getPartialMolarCp(doublereal* cpbar) const
 
 void RedlichKwongMFTP::getPartialMolarVolumes(doublereal* vbar) const
 {
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
-    for (size_t k = 0; k < m_kk; k++) {
-        m_tmpV[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_tmpV[k] += moleFractions_[i] * a_coeff_vec(1,counter);
-        }
-    }
 
     doublereal sqt = sqrt(temperature());
     doublereal mv = molarVolume();
@@ -419,7 +373,7 @@ void RedlichKwongMFTP::getPartialMolarVolumes(doublereal* vbar) const
     for (size_t k = 0; k < m_kk; k++) {
         doublereal num = (RT() + RT() * m_b_current/ vmb + RT() * b_vec_Curr_[k] / vmb
                           + RT() * m_b_current * b_vec_Curr_[k] /(vmb * vmb)
-                          - 2.0 * m_pp[k] / (sqt * vpb)
+                          - 2.0 * m_aSum[k] / (sqt * vpb)
                           + m_a_current * b_vec_Curr_[k] / (sqt * vpb * vpb)
                          );
         doublereal denom = (pressure() + RT() * m_b_current/(vmb * vmb) - m_a_current / (sqt * vpb * vpb)
@@ -431,80 +385,40 @@ void RedlichKwongMFTP::getPartialMolarVolumes(doublereal* vbar) const
 doublereal RedlichKwongMFTP::critTemperature() const
 {
     double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
+    calcCriticalConditions(m_a_current, m_b_current, m_a0_mix, m_a1_mix,
+                           pc, tc, vc);
     return tc;
 }
 
 doublereal RedlichKwongMFTP::critPressure() const
 {
     double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
+    calcCriticalConditions(m_a_current, m_b_current, m_a0_mix, m_a1_mix,
+                           pc, tc, vc);
     return pc;
 }
 
 doublereal RedlichKwongMFTP::critVolume() const
 {
     double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
+    calcCriticalConditions(m_a_current, m_b_current, m_a0_mix, m_a1_mix,
+                           pc, tc, vc);
     return vc;
 }
 
 doublereal RedlichKwongMFTP::critCompressibility() const
 {
     double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
+    calcCriticalConditions(m_a_current, m_b_current, m_a0_mix, m_a1_mix,
+                           pc, tc, vc);
     return pc*vc/tc/GasConstant;
 }
 
 doublereal RedlichKwongMFTP::critDensity() const
 {
     double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] *a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] *a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
+    calcCriticalConditions(m_a_current, m_b_current, m_a0_mix, m_a1_mix,
+                           pc, tc, vc);
     double mmw = meanMolecularWeight();
     return mmw / vc;
 }
@@ -543,8 +457,10 @@ bool RedlichKwongMFTP::addSpecies(shared_ptr<Species> spec)
 {
     bool added = MixtureFugacityTP::addSpecies(spec);
     if (added) {
-        a_vec_Curr_.resize(m_kk * m_kk, 0.0);
         b_vec_Curr_.push_back(0.0);
+        m_a0Sum.push_back(0.0);
+        m_a1Sum.push_back(0.0);
+        m_aSum.push_back(0.0);
 
         a_coeff_vec.resize(2, m_kk * m_kk, 0.0);
 
@@ -754,39 +670,9 @@ doublereal RedlichKwongMFTP::densityCalc(doublereal TKelvin, doublereal presPa,
 
     doublereal volguess = mmw / rhoguess;
     NSolns_ = NicholsSolve(TKelvin, presPa, m_a_current, m_b_current, Vroot_);
-
-    doublereal molarVolLast = Vroot_[0];
-    if (NSolns_ >= 2) {
-        if (phaseRequested >= FLUID_LIQUID_0) {
-            molarVolLast = Vroot_[0];
-        } else if (phaseRequested == FLUID_GAS || phaseRequested == FLUID_SUPERCRIT) {
-            molarVolLast = Vroot_[2];
-        } else {
-            if (volguess > Vroot_[1]) {
-                molarVolLast = Vroot_[2];
-            } else {
-                molarVolLast = Vroot_[0];
-            }
-        }
-    } else if (NSolns_ == 1) {
-        if (phaseRequested == FLUID_GAS || phaseRequested == FLUID_SUPERCRIT || phaseRequested == FLUID_UNDEFINED) {
-            molarVolLast = Vroot_[0];
-        } else {
-            return -2.0;
-        }
-    } else if (NSolns_ == -1) {
-        if (phaseRequested >= FLUID_LIQUID_0 || phaseRequested == FLUID_UNDEFINED || phaseRequested == FLUID_SUPERCRIT) {
-            molarVolLast = Vroot_[0];
-        } else if (TKelvin > tcrit) {
-            molarVolLast = Vroot_[0];
-        } else {
-            return -2.0;
-        }
-    } else {
-        molarVolLast = Vroot_[0];
-        return -1.0;
-    }
-    return mmw / molarVolLast;
+    double molarVol = selectMolarVolume(NSolns_, Vroot_, phaseRequested,
+                                        TKelvin > tcrit, volguess);
+    return (molarVol > 0.0) ? mmw / molarVol : molarVol;
 }
 
 doublereal RedlichKwongMFTP::densSpinodalLiquid() const
@@ -876,63 +762,60 @@ void RedlichKwongMFTP::updateMixingExpressions()
 
 void RedlichKwongMFTP::updateAB()
 {
-    double temp = temperature();
-    if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                a_vec_Curr_[counter] = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
-            }
-        }
+    double temp = (m_formTempParam == 1) ? temperature() : 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        m_aSum[k] = m_a0Sum[k] + temp * m_a1Sum[k];
     }
+    m_a_current = m_a0_mix + temp * m_a1_mix;
+}
 
+void RedlichKwongMFTP::updateMixingSums()
+{
+    // The coefficient matrices are symmetric, so each off-diagonal element is
+    // used for both of the species it couples. The constant and
+    // temperature-dependent parts of each element are stored next to each
+    // other in a_coeff_vec.
+    const double* x = moleFractions_.data();
+    double* s0 = m_a0Sum.data();
+    double* s1 = m_a1Sum.data();
+    std::fill(s0, s0 + m_kk, 0.0);
+    std::fill(s1, s1 + m_kk, 0.0);
     m_b_current = 0.0;
-    m_a_current = 0.0;
     for (size_t i = 0; i < m_kk; i++) {
-        m_b_current += moleFractions_[i] * b_vec_Curr_[i];
-        for (size_t j = 0; j < m_kk; j++) {
-            m_a_current += a_vec_Curr_[i * m_kk + j] * moleFractions_[i] * moleFractions_[j];
+        const double* ai = a_coeff_vec.ptrColumn(i * m_kk);
+        double xi = x[i];
+        double sum0 = ai[2*i] * xi;
+        double sum1 = ai[2*i+1] * xi;
+        for (size_t j = i + 1; j < m_kk; j++) {
+            sum0 += ai[2*j] * x[j];
+            sum1 += ai[2*j+1] * x[j];
+            s0[j] += ai[2*j] * xi;
+            s1[j] += ai[2*j+1] * xi;
         }
+        s0[i] += sum0;
+        s1[i] += sum1;
+        m_b_current += xi * b_vec_Curr_[i];
+    }
+    m_a0_mix = 0.0;
+    m_a1_mix = 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        m_a0_mix += x[k] * s0[k];
+        m_a1_mix += x[k] * s1[k];
     }
 }
 
 void RedlichKwongMFTP::calculateAB(doublereal temp, doublereal& aCalc, doublereal& bCalc) const
 {
-    bCalc = 0.0;
-    aCalc = 0.0;
+    bCalc = m_b_current;
+    aCalc = m_a0_mix;
     if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            bCalc += moleFractions_[i] * b_vec_Curr_[i];
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                doublereal a_vec_Curr = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
-                aCalc += a_vec_Curr * moleFractions_[i] * moleFractions_[j];
-            }
-        }
-    } else {
-        for (size_t i = 0; i < m_kk; i++) {
-            bCalc += moleFractions_[i] * b_vec_Curr_[i];
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                doublereal a_vec_Curr = a_coeff_vec(0,counter);
-                aCalc += a_vec_Curr * moleFractions_[i] * moleFractions_[j];
-            }
-        }
+        aCalc += m_a1_mix * temp;
     }
 }
 
 doublereal RedlichKwongMFTP::da_dt() const
 {
-    doublereal dadT = 0.0;
-    if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                dadT+= a_coeff_vec(1,counter) * moleFractions_[i] * moleFractions_[j];
-            }
-        }
-    }
-    return dadT;
+    return (m_formTempParam == 1) ? m_a1_mix : 0.0;
 }
 
 void RedlichKwongMFTP::calcCriticalConditions(doublereal a, doublereal b, doublereal a0_coeff, doublereal aT_coeff,
@@ -980,202 +863,176 @@ void RedlichKwongMFTP::calcCriticalConditions(doublereal a, doublereal b, double
 int RedlichKwongMFTP::NicholsSolve(double TKelvin, double pres, doublereal a, doublereal b,
                                    doublereal Vroot[3]) const
 {
-    Vroot[0] = 0.0;
-    Vroot[1] = 0.0;
-    Vroot[2] = 0.0;
     if (TKelvin <= 0.0) {
         throw CanteraError("RedlichKwongMFTP::NicholsSolve()", "neg temperature");
     }
+    int nRoots;
+    solveCubic(1, &TKelvin, &pres, &a, &b, Vroot, &nRoots);
+    if (nRoots == 0) {
+        throw CanteraError("RedlichKwongMFTP::NicholsSolve()",
+            "No physical root at T = {}, p = {}", TKelvin, pres);
+    }
+    return classifyRoots(TKelvin, pres, a, b, Vroot, nRoots);
+}
 
-    // Derive the coefficients of the cubic polynomial to solve.
-    doublereal an = 1.0;
-    doublereal bn = - GasConstant * TKelvin / pres;
-    doublereal sqt = sqrt(TKelvin);
-    doublereal cn = - (GasConstant * TKelvin * b / pres - a/(pres * sqt) + b * b);
-    doublereal dn = - (a * b / (pres * sqt));
-
-    double tmp = a * omega_b / (b * omega_a * GasConstant);
-    double pp = 2./3.;
-    double tc = pow(tmp, pp);
-    double pc = omega_b * GasConstant * tc / b;
-    double vc = omega_vc * GasConstant * tc / pc;
-    // Derive the center of the cubic, x_N
-    doublereal xN = - bn /(3 * an);
-
-    // Derive the value of delta**2. This is a key quantity that determines the
-    // number of turning points
-    doublereal delta2 = (bn * bn - 3 * an * cn) / (9 * an * an);
-    doublereal delta = 0.0;
-
-    // Calculate a couple of ratios
-    doublereal ratio1 = 3.0 * an * cn / (bn * bn);
-    doublereal ratio2 = pres * b / (GasConstant * TKelvin);
-    if (fabs(ratio1) < 1.0E-7) {
-        doublereal ratio3 = a / (GasConstant * sqt) * pres / (GasConstant * TKelvin);
-        if (fabs(ratio2) < 1.0E-5 && fabs(ratio3) < 1.0E-5) {
-            doublereal zz = 1.0;
-            for (int i = 0; i < 10; i++) {
-                doublereal znew = zz / (zz - ratio2) - ratio3 / (zz + ratio1);
-                doublereal deltaz = znew - zz;
-                zz = znew;
-                if (fabs(deltaz) < 1.0E-14) {
-                    break;
-                }
-            }
-            doublereal v = zz * GasConstant * TKelvin / pres;
-            Vroot[0] = v;
-            return 1;
+int RedlichKwongMFTP::classifyRoots(double T, double P, double a, double b,
+                                    double* Vroot, int nRoots)
+{
+    if (nRoots == 2) {
+        // The smallest root was not physical. Of the remaining two, the
+        // smaller one is on the mechanically unstable branch, so only the
+        // gas root is kept.
+        Vroot[0] = Vroot[1];
+        Vroot[1] = 0.0;
+        nRoots = 1;
+    }
+    if (nRoots == 1) {
+        // Determine whether the only root is on the liquid branch, by
+        // comparing it to the critical volume of a pure fluid with the same
+        // a and b, or to the inflection point of the cubic below the critical
+        // temperature.
+        double tc = pow(a * omega_b / (b * omega_a * GasConstant), 2./3.);
+        double vc = omega_vc * b / omega_b;
+        double vN = GasConstant * T / (3 * P);
+        if (Vroot[0] < ((T > tc) ? vc : vN)) {
+            return -1;
         }
     }
+    return nRoots;
+}
 
-    int nSolnValues;
-    double h2 = 4. * an * an * delta2 * delta2 * delta2;
-    if (delta2 > 0.0) {
-        delta = sqrt(delta2);
+double RedlichKwongMFTP::selectMolarVolume(int nSolns, const double* Vroot,
+                                           int phase, bool supercritical,
+                                           double volguess)
+{
+    if (nSolns == 3) {
+        if (phase >= FLUID_LIQUID_0) {
+            return Vroot[0];
+        } else if (phase == FLUID_GAS || phase == FLUID_SUPERCRIT) {
+            return Vroot[2];
+        } else {
+            return (volguess > Vroot[1]) ? Vroot[2] : Vroot[0];
+        }
+    } else if (nSolns == 1) {
+        if (phase == FLUID_GAS || phase == FLUID_SUPERCRIT ||
+            phase == FLUID_UNDEFINED) {
+            return Vroot[0];
+        }
+        return -2.0;
+    } else if (nSolns == -1) {
+        if (phase >= FLUID_LIQUID_0 || phase == FLUID_UNDEFINED ||
+            phase == FLUID_SUPERCRIT || supercritical) {
+            return Vroot[0];
+        }
+        return -2.0;
     }
+    return -1.0;
+}
 
-    doublereal h = 2.0 * an * delta * delta2;
-    doublereal yN = 2.0 * bn * bn * bn / (27.0 * an * an) - bn * cn / (3.0 * an) + dn;
-    doublereal desc = yN * yN - h2;
-
-    if (fabs(fabs(h) - fabs(yN)) < 1.0E-10) {
-        if (desc != 0.0) {
-            // this is for getting to other cases
-            throw CanteraError("NicholsSolve()", "numerical issues");
-        }
-        desc = 0.0;
+void RedlichKwongMFTP::solveCubic(size_t n, const double* T, const double* P,
+                                  const double* a, const double* b,
+                                  double* Vroot, int* nRoots)
+{
+    // In terms of the compressibility factor Z = P V / (R T), the equation of
+    // state is Z^3 - Z^2 + (A - B - B^2) Z - A B = 0, with
+    // A = a P / (R^2 T^2.5) and B = b P / (R T). Substituting Z = t + 1/3
+    // gives the depressed cubic t^3 + p t + q = 0.
+    const double third = 1.0 / 3.0;
+    const double twoPi3 = 2.0 * Pi / 3.0;
+    vector_fp Z(3*n), c1(n), c0(n), B(n);
+    vector_int three(n);
+    for (size_t i = 0; i < n; i++) {
+        double RT = GasConstant * T[i];
+        double A = a[i] * P[i] / (RT * RT * sqrt(T[i]));
+        B[i] = b[i] * P[i] / RT;
+        c1[i] = A - B[i] - B[i] * B[i];
+        c0[i] = - A * B[i];
+        double p = c1[i] - third;
+        double q = c1[i] * third + c0[i] - 2.0 / 27.0;
+        double disc = 0.25 * q * q + p * p * p / 27.0;
+        three[i] = (disc < 0.0);
+
+        // One real root (Cardano)
+        double sd = sqrt(std::max(disc, 0.0));
+        double t1 = cbrt(-0.5 * q + sd) + cbrt(-0.5 * q - sd);
+
+        // Three real roots (trigonometric form). With p < 0, the roots in
+        // decreasing order are m cos(phi), m cos(phi - 2 pi/3) and
+        // m cos(phi - 4 pi/3).
+        double pn = std::min(p, -1e-300);
+        double m = 2.0 * sqrt(-pn * third);
+        double c = 1.5 * q / pn * sqrt(-3.0 / pn);
+        double phi = third * acos(std::max(-1.0, std::min(1.0, c)));
+        double tg = m * cos(phi);
+        double tm = m * cos(phi - twoPi3);
+        double tl = m * cos(phi - 2.0 * twoPi3);
+
+        Z[3*i] = third + (three[i] ? tl : t1);
+        Z[3*i+1] = third + (three[i] ? tm : t1);
+        Z[3*i+2] = third + (three[i] ? tg : t1);
     }
 
-    if (desc < 0.0) {
-        nSolnValues = 3;
-    } else if (desc == 0.0) {
-        nSolnValues = 2;
-        // We are here as p goes to zero.
-    } else if (desc > 0.0) {
-        nSolnValues = 1;
+    // Polish the roots with Newton's method
+    for (size_t j = 0; j < 3*n; j++) {
+        size_t i = j / 3;
+        double z = Z[j];
+        for (int iter = 0; iter < 3; iter++) {
+            double f = ((z - 1.0) * z + c1[i]) * z + c0[i];
+            double df = (3.0 * z - 2.0) * z + c1[i];
+            z -= (df != 0.0) ? f / df : 0.0;
+        }
+        Z[j] = z;
     }
 
-    // One real root -> have to determine whether gas or liquid is the root
-    if (desc > 0.0) {
-        doublereal tmpD = sqrt(desc);
-        doublereal tmp1 = (- yN + tmpD) / (2.0 * an);
-        doublereal sgn1 = 1.0;
-        if (tmp1 < 0.0) {
-            sgn1 = -1.0;
-            tmp1 = -tmp1;
+    // Keep the physical roots (V > b), in increasing order
+    for (size_t i = 0; i < n; i++) {
+        double* V = Vroot + 3*i;
+        double* z = &Z[3*i];
+        if (z[0] > z[1]) {
+            std::swap(z[0], z[1]);
         }
-        doublereal tmp2 = (- yN - tmpD) / (2.0 * an);
-        doublereal sgn2 = 1.0;
-        if (tmp2 < 0.0) {
-            sgn2 = -1.0;
-            tmp2 = -tmp2;
+        if (z[1] > z[2]) {
+            std::swap(z[1], z[2]);
         }
-        doublereal p1 = pow(tmp1, 1./3.);
-        doublereal p2 = pow(tmp2, 1./3.);
-        doublereal alpha = xN + sgn1 * p1 + sgn2 * p2;
-        Vroot[0] = alpha;
-        Vroot[1] = 0.0;
-        Vroot[2] = 0.0;
-        tmp = an * Vroot[0] * Vroot[0] * Vroot[0] + bn * Vroot[0] * Vroot[0] + cn * Vroot[0] + dn;
-    } else if (desc < 0.0) {
-        doublereal tmp = - yN/h;
-        doublereal val = acos(tmp);
-        doublereal theta = val / 3.0;
-        doublereal oo = 2. * Pi / 3.;
-        doublereal alpha = xN + 2. * delta * cos(theta);
-        doublereal beta = xN + 2. * delta * cos(theta + oo);
-        doublereal gamma = xN + 2. * delta * cos(theta + 2.0 * oo);
-        Vroot[0] = beta;
-        Vroot[1] = gamma;
-        Vroot[2] = alpha;
-
-        for (int i = 0; i < 3; i++) {
-            tmp = an * Vroot[i] * Vroot[i] * Vroot[i] + bn * Vroot[i] * Vroot[i] + cn * Vroot[i] + dn;
-            if (fabs(tmp) > 1.0E-4) {
-                for (int j = 0; j < 3; j++) {
-                    if (j != i && fabs(Vroot[i] - Vroot[j]) < 1.0E-4 * (fabs(Vroot[i]) + fabs(Vroot[j]))) {
-                        writelog("RedlichKwongMFTP::NicholsSolve(T = {}, p = {}):"
-                                 " WARNING roots have merged: {}, {}\n",
-                                 TKelvin, pres, Vroot[i], Vroot[j]);
-                    }
-                }
-            }
+        if (z[0] > z[1]) {
+            std::swap(z[0], z[1]);
         }
-    } else if (desc == 0.0) {
-        if (yN == 0.0 && h == 0.0) {
-            Vroot[0] = xN;
-            Vroot[1] = xN;
-            Vroot[2] = xN;
-        } else {
-            // need to figure out whether delta is pos or neg
-            if (yN > 0.0) {
-                tmp = pow(yN/(2*an), 1./3.);
-                if (fabs(tmp - delta) > 1.0E-9) {
-                    throw CanteraError("RedlichKwongMFTP::NicholsSolve()", "unexpected");
-                }
-                Vroot[1] = xN + delta;
-                Vroot[0] = xN - 2.0*delta; // liquid phase root
-            } else {
-                tmp = pow(yN/(2*an), 1./3.);
-                if (fabs(tmp - delta) > 1.0E-9) {
-                    throw CanteraError("RedlichKwongMFTP::NicholsSolve()", "unexpected");
-                }
-                delta = -delta;
-                Vroot[0] = xN + delta;
-                Vroot[1] = xN - 2.0*delta; // gas phase root
+        int nr = 0;
+        for (int k = (three[i] ? 0 : 2); k < 3; k++) {
+            if (z[k] > B[i]) {
+                V[nr++] = z[k] * GasConstant * T[i] / P[i];
             }
         }
-        for (int i = 0; i < 2; i++) {
-            tmp = an * Vroot[i] * Vroot[i] * Vroot[i] + bn * Vroot[i] * Vroot[i] + cn * Vroot[i] + dn;
+        nRoots[i] = nr;
+        for (int k = nr; k < 3; k++) {
+            V[k] = 0.0;
         }
     }
+}
 
-    // Unfortunately, there is a heavy amount of roundoff error due to bad
-    // conditioning in this
-    double res, dresdV = 0.0;
-    for (int i = 0; i < nSolnValues; i++) {
-        for (int n = 0; n < 20; n++) {
-            res = an * Vroot[i] * Vroot[i] * Vroot[i] + bn * Vroot[i] * Vroot[i] + cn * Vroot[i] + dn;
-            if (fabs(res) < 1.0E-14) {
-                break;
-            }
-            dresdV = 3.0 * an * Vroot[i] * Vroot[i] + 2.0 * bn * Vroot[i] + cn;
-            double del = - res / dresdV;
-            Vroot[i] += del;
-            if (fabs(del) / (fabs(Vroot[i]) + fabs(del)) < 1.0E-14) {
-                break;
-            }
-            double res2 = an * Vroot[i] * Vroot[i] * Vroot[i] + bn * Vroot[i] * Vroot[i] + cn * Vroot[i] + dn;
-            if (fabs(res2) < fabs(res)) {
-                continue;
-            } else {
-                Vroot[i] -= del;
-                Vroot[i] += 0.1 * del;
-            }
-        }
-        if ((fabs(res) > 1.0E-14) && (fabs(res) > 1.0E-14 * fabs(dresdV) * fabs(Vroot[i]))) {
-            writelog("RedlichKwongMFTP::NicholsSolve(T = {}, p = {}): "
-                "WARNING root didn't converge V = {}", TKelvin, pres, Vroot[i]);
-            writelogendl();
-        }
+void RedlichKwongMFTP::getDensities(size_t n, const double* T,
+                                    const double* P, int phase,
+                                    double* rho) const
+{
+    vector_fp a(n), b(n, m_b_current), Vroot(3*n);
+    vector_int nRoots(n);
+    for (size_t i = 0; i < n; i++) {
+        calculateAB(T[i], a[i], b[i]);
     }
-
-    if (nSolnValues == 1) {
-        if (TKelvin > tc) {
-            if (Vroot[0] < vc) {
-                nSolnValues = -1;
-            }
-        } else {
-            if (Vroot[0] < xN) {
-                nSolnValues = -1;
-            }
-        }
-    } else {
-        if (nSolnValues == 2 && delta > 0.0) {
-            nSolnValues = -2;
+    solveCubic(n, T, P, a.data(), b.data(), Vroot.data(), nRoots.data());
+    double mmw = meanMolecularWeight();
+    double tcrit = critTemperature();
+    for (size_t i = 0; i < n; i++) {
+        double* V = &Vroot[3*i];
+        if (nRoots[i] == 0) {
+            rho[i] = -1.0;
+            continue;
         }
+        int nsol = classifyRoots(T[i], P[i], a[i], b[i], V, nRoots[i]);
+        double molarVol = selectMolarVolume(nsol, V, phase, T[i] > tcrit,
+                                            GasConstant * T[i] / P[i]);
+        rho[i] = (molarVol > 0.0) ? mmw / molarVol : molarVol;
     }
-    return nSolnValues;
 }
 
 }
@@ -160,6 +160,24 @@ void VPStandardStateTP::initThermo()
         }
         kPDSS->initThermo();
     }
+
+    // Group the species whose standard states only need the reference state
+    // thermo and a temperature-dependent molar volume
+    m_volOnlyThermo.reset(new MultiSpeciesThermo());
+    m_kVolOnly.clear();
+    m_kGeneric.clear();
+    for (size_t k = 0; k < m_kk; k++) {
+        PDSS* kPDSS = m_PDSS_storage[k].get();
+        double V, dVdT, d2VdT2;
+        if (!kPDSS->useSTITbyPDSS() &&
+            kPDSS->getMolarVolumeDerivs(temperature(), V, dVdT, d2VdT2)) {
+            m_volOnlyThermo->install_STIT(k, species(k)->thermo);
+            m_kVolOnly.push_back(k);
+        } else {
+            m_kGeneric.push_back(k);
+        }
+    }
+    m_Tlast_ss += 0.0001234;
 }
 
 bool VPStandardStateTP::addSpecies(shared_ptr<Species> spec)
@@ -238,6 +256,9 @@ void VPStandardStateTP::installPDSS(size_t k, unique_ptr<PDSS>&& pdss)
         m_PDSS_storage.resize(k+1);
     }
     m_PDSS_storage[k].swap(pdss);
+    // The species are grouped again by initThermo()
+    m_kVolOnly.clear();
+    m_kGeneric.clear();
 }
 
 PDSS* VPStandardStateTP::providePDSS(size_t k)
@@ -259,7 +280,38 @@ void VPStandardStateTP::invalidateCache()
 void VPStandardStateTP::_updateStandardStateThermo() const
 {
     double Tnow = temperature();
-    for (size_t k = 0; k < m_kk; k++) {
+    // Species are only grouped once all of the PDSS objects are initialized
+    bool grouped = (m_kVolOnly.size() + m_kGeneric.size() == m_kk);
+
+    if (grouped && !m_kVolOnly.empty()) {
+        // reference state thermo for all species at once
+        if (Tnow != m_tlast) {
+            m_volOnlyThermo->update(Tnow, &m_cp0_R[0], &m_h0_RT[0], &m_s0_R[0]);
+        }
+        // standard state thermo, with the pressure correction determined by
+        // the molar volume and its temperature derivatives
+        for (size_t k : m_kVolOnly) {
+            const PDSS& pdss = *m_PDSS_storage[k];
+            double V, dVdT, d2VdT2;
+            pdss.getMolarVolumeDerivs(Tnow, V, dVdT, d2VdT2);
+            double deltaP = m_Pcurrent - pdss.refPressure();
+            double del_pRT = deltaP / (GasConstant * Tnow);
+            if (Tnow != m_tlast) {
+                m_g0_RT[k] = m_h0_RT[k] - m_s0_R[k];
+            }
+            m_V0[k] = V;
+            double sV_term = - deltaP / GasConstant * dVdT;
+            m_hss_RT[k] = m_h0_RT[k] + sV_term + del_pRT * V;
+            m_sss_R[k] = m_s0_R[k] + sV_term;
+            m_gss_RT[k] = m_hss_RT[k] - m_sss_R[k];
+            m_cpss_R[k] = m_cp0_R[k] - Tnow * deltaP * d2VdT2 / GasConstant;
+            m_Vss[k] = V;
+        }
+    }
+
+    size_t nGeneric = grouped ? m_kGeneric.size() : m_kk;
+    for (size_t i = 0; i < nGeneric; i++) {
+        size_t k = grouped ? m_kGeneric[i] : i;
         PDSS* kPDSS = m_PDSS_storage[k].get();
         kPDSS->setState_TP(Tnow, m_Pcurrent);
         // reference state thermo
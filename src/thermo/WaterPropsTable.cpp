@@ -0,0 +1,349 @@
+/**
+ * @file WaterPropsTable.cpp
+ * Definitions for a tabulated approximation to the IAPWS 1995 equation of
+ * state for water (see \ref thermoprops and class
+ * \link Cantera::WaterPropsTable WaterPropsTable\endlink).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/thermo/WaterPropsTable.h"
+#include "cantera/thermo/WaterPropsIAPWS.h"
+#include "cantera/base/ctexceptions.h"
+
+namespace Cantera
+{
+
+namespace {
+
+//! Number of tabulated properties, in the order of the members of
+//! WaterPropsTable::State
+const size_t nProps = 7;
+
+//! Triple point temperature of water [K]
+const double T_triple = 273.16;
+
+//! Convert the state `s` at pressure `P` to the tabulated values `v`. The
+//! density and compressibility are tabulated as logarithms. For the vapor, the
+//! leading-order pressure dependence of the ideal gas is removed from the
+//! density, entropy and compressibility, so that the tabulated values vary
+//! smoothly with pressure down to the limit P -> 0.
+void toArray(const WaterPropsTable::State& s, double P, int phase, double* v)
+{
+    double lnP = (phase == WATER_GAS) ? log(P) : 0.0;
+    v[0] = log(s.density) - lnP;
+    v[1] = s.enthalpy;
+    v[2] = s.entropy + GasConstant * lnP;
+    v[3] = s.cp;
+    v[4] = s.cv;
+    v[5] = log(s.compressibility) + lnP;
+    v[6] = s.expansion;
+}
+
+//! Inverse of toArray()
+void fromArray(const double* v, double P, int phase, WaterPropsTable::State& s)
+{
+    double lnP = (phase == WATER_GAS) ? log(P) : 0.0;
+    s.density = exp(v[0] + lnP);
+    s.enthalpy = v[1];
+    s.entropy = v[2] - GasConstant * lnP;
+    s.cp = v[3];
+    s.cv = v[4];
+    s.compressibility = exp(v[5] - lnP);
+    s.expansion = v[6];
+}
+
+//! Pressure corresponding to the scaled pressure coordinate `x`, for a region
+//! with pressure limits `Plow` and `Phigh`. The grid points are clustered
+//! toward the saturation curve (x = 0 for the liquid and x = 1 for the vapor),
+//! where the properties vary most rapidly.
+double scaledToPressure(double x, double Plow, double Phigh, int phase)
+{
+    double y = (phase == WATER_LIQUID) ? x * x : x * (2.0 - x);
+    return Plow + (Phigh - Plow) * y;
+}
+
+//! Inverse of scaledToPressure()
+double pressureToScaled(double P, double Plow, double Phigh, int phase)
+{
+    double y = (P - Plow) / (Phigh - Plow);
+    return (phase == WATER_LIQUID) ? sqrt(y) : 1.0 - sqrt(1.0 - y);
+}
+
+//! Value at a ghost node, using quadratic extrapolation from the three
+//! nearest nodes inside the grid
+double extrapolate(double f0, double f1, double f2)
+{
+    return 3.0 * f0 - 3.0 * f1 + f2;
+}
+
+}
+
+WaterPropsTable::WaterPropsTable(size_t nT, size_t nP, double Tmin,
+                                 double Tsat, double Tmax, double Pmin,
+                                 double Pmax) :
+    m_Tmin(Tmin),
+    m_Tsat(Tsat),
+    m_Tmax(Tmax),
+    m_Pmin(Pmin),
+    m_Pmax(Pmax),
+    m_dT((Tsat - Tmin) / nT)
+{
+    WaterPropsIAPWS water;
+    if (nT < 2 || nP < 2) {
+        throw CanteraError("WaterPropsTable::WaterPropsTable",
+            "At least 2 intervals are required in each direction.");
+    } else if (Tmin < T_triple - 1e-8 || Tsat <= Tmin) {
+        throw CanteraError("WaterPropsTable::WaterPropsTable",
+            "Invalid temperature range: Tmin = {}, Tsat = {}", Tmin, Tsat);
+    } else if (Tsat >= water.Tcrit()) {
+        throw CanteraError("WaterPropsTable::WaterPropsTable",
+            "Tsat = {} must be below the critical temperature", Tsat);
+    } else if (Pmin <= 0.0 || Pmin >= water.psat(Tmin, WATER_GAS)) {
+        throw CanteraError("WaterPropsTable::WaterPropsTable",
+            "Pmin = {} must be positive and below the saturation pressure "
+            "at Tmin", Pmin);
+    } else if (Pmax <= water.psat(Tsat)) {
+        throw CanteraError("WaterPropsTable::WaterPropsTable",
+            "Pmax = {} must be above the saturation pressure at Tsat", Pmax);
+    }
+
+    // Saturation curve
+    m_lnPsat.resize(nT + 3);
+    for (size_t i = 0; i <= nT; i++) {
+        m_lnPsat[i+1] = log(water.psat(Tmin + i * m_dT));
+    }
+    m_lnPsat[0] = extrapolate(m_lnPsat[1], m_lnPsat[2], m_lnPsat[3]);
+    m_lnPsat[nT+2] = extrapolate(m_lnPsat[nT+1], m_lnPsat[nT], m_lnPsat[nT-1]);
+
+    // All regions use the same temperature spacing, with Tmax rounded up to
+    // the next grid point
+    m_liquid.T0 = Tmin;
+    m_liquid.nT = nT;
+    m_liquid.nP = nP;
+    m_liquid.phase = WATER_LIQUID;
+    m_vapor.T0 = Tmin;
+    m_vapor.nT = nT;
+    m_vapor.nP = nP;
+    m_vapor.phase = WATER_GAS;
+    m_superheated.T0 = Tsat;
+    m_superheated.nT = std::max<size_t>(2, ceil((Tmax - Tsat) / m_dT - 1e-8));
+    m_superheated.nP = nP;
+    m_superheated.phase = WATER_GAS;
+    m_Tmax = Tsat + m_superheated.nT * m_dT;
+
+    fillRegion(water, m_liquid);
+    fillRegion(water, m_vapor);
+    fillRegion(water, m_superheated);
+}
+
+shared_ptr<WaterPropsTable> WaterPropsTable::build(double tol)
+{
+    size_t nT = 60;
+    size_t nP = 20;
+    double err = 0.0;
+    for (int n = 0; n < 5; n++) {
+        auto table = std::make_shared<WaterPropsTable>(nT, nP);
+        err = table->maxError();
+        if (err < tol) {
+            return table;
+        }
+        nT *= 2;
+        nP *= 2;
+    }
+    throw CanteraError("WaterPropsTable::build", "Unable to reach the "
+        "tolerance of {}. The error of the finest table is {}.", tol, err);
+}
+
+void WaterPropsTable::fillRegion(WaterPropsIAPWS& water, Region& r)
+{
+    size_t ld = r.nP + 3;
+    r.data.assign(nProps * (r.nT + 3) * ld, 0.0);
+    State s;
+    for (size_t i = 0; i <= r.nT; i++) {
+        double T = r.T0 + i * m_dT;
+        double Plow, Phigh;
+        pressureRange(r, T, Plow, Phigh);
+        for (size_t j = 0; j <= r.nP; j++) {
+            double P = scaledToPressure(double(j) / r.nP, Plow, Phigh,
+                                        r.phase);
+            // Avoid roundoff taking the end points into the other phase
+            if (j == 0 && r.phase == WATER_LIQUID) {
+                P *= 1.0 + 1e-12;
+            } else if (j == r.nP && r.phase == WATER_GAS && T <= m_Tsat) {
+                P *= 1.0 - 1e-12;
+            }
+            evaluate(water, T, P, r.phase, s);
+            toArray(s, P, r.phase, &r.data[nProps * ((i+1) * ld + j + 1)]);
+        }
+    }
+
+    // Ghost nodes in the temperature direction, then in the pressure
+    // direction (including the corners)
+    double* d = r.data.data();
+    for (size_t j = 1; j <= r.nP + 1; j++) {
+        for (size_t k = 0; k < nProps; k++) {
+            d[nProps * j + k] = extrapolate(d[nProps * (ld + j) + k],
+                d[nProps * (2 * ld + j) + k], d[nProps * (3 * ld + j) + k]);
+            size_t n = r.nT + 1;
+            d[nProps * ((n + 1) * ld + j) + k] = extrapolate(
+                d[nProps * (n * ld + j) + k],
+                d[nProps * ((n - 1) * ld + j) + k],
+                d[nProps * ((n - 2) * ld + j) + k]);
+        }
+    }
+    for (size_t i = 0; i < r.nT + 3; i++) {
+        double* row = d + nProps * i * ld;
+        for (size_t k = 0; k < nProps; k++) {
+            row[k] = extrapolate(row[nProps + k], row[2 * nProps + k],
+                                 row[3 * nProps + k]);
+            size_t n = r.nP + 1;
+            row[nProps * (n + 1) + k] = extrapolate(row[nProps * n + k],
+                row[nProps * (n - 1) + k], row[nProps * (n - 2) + k]);
+        }
+    }
+}
+
+void WaterPropsTable::pressureRange(const Region& r, double T, double& Plow,
+                                    double& Phigh) const
+{
+    if (r.phase == WATER_LIQUID) {
+        Plow = exp(lnSatPressure(T));
+        Phigh = m_Pmax;
+    } else {
+        Plow = m_Pmin;
+        Phigh = exp(lnSatPressure(T));
+    }
+}
+
+double WaterPropsTable::lnSatPressure(double T) const
+{
+    size_t nT = m_liquid.nT;
+    double u = (std::min(std::max(T, m_Tmin), m_Tsat) - m_Tmin) / m_dT;
+    size_t i = std::min(static_cast<size_t>(u), nT - 1);
+    double w[4];
+    weights(u - i, w);
+    return w[0] * m_lnPsat[i] + w[1] * m_lnPsat[i+1]
+           + w[2] * m_lnPsat[i+2] + w[3] * m_lnPsat[i+3];
+}
+
+double WaterPropsTable::satPressure(double T) const
+{
+    if (T < m_Tmin || T > m_Tsat) {
+        return -1.0;
+    }
+    return exp(lnSatPressure(T));
+}
+
+void WaterPropsTable::weights(double t, double* w)
+{
+    double t2 = t * t;
+    double t3 = t2 * t;
+    w[0] = 0.5 * (-t3 + 2.0 * t2 - t);
+    w[1] = 0.5 * (3.0 * t3 - 5.0 * t2 + 2.0);
+    w[2] = 0.5 * (-3.0 * t3 + 4.0 * t2 + t);
+    w[3] = 0.5 * (t3 - t2);
+}
+
+void WaterPropsTable::interpolate(const Region& r, double T, double P,
+                                  double x, State& state) const
+{
+    double u = (T - r.T0) / m_dT;
+    size_t i = std::min(static_cast<size_t>(std::max(u, 0.0)), r.nT - 1);
+    double v = x * r.nP;
+    size_t j = std::min(static_cast<size_t>(std::max(v, 0.0)), r.nP - 1);
+    double wT[4], wP[4];
+    weights(u - i, wT);
+    weights(v - j, wP);
+
+    size_t ld = r.nP + 3;
+    double values[nProps] = {0.0};
+    for (size_t a = 0; a < 4; a++) {
+        const double* row = &r.data[nProps * ((i + a) * ld + j)];
+        for (size_t b = 0; b < 4; b++) {
+            double w = wT[a] * wP[b];
+            for (size_t k = 0; k < nProps; k++) {
+                values[k] += w * row[nProps * b + k];
+            }
+        }
+    }
+    fromArray(values, P, r.phase, state);
+}
+
+bool WaterPropsTable::lookup(double T, double P, int phase,
+                             State& state) const
+{
+    const Region* r;
+    if (phase == WATER_LIQUID) {
+        r = &m_liquid;
+        if (T < m_Tmin || T > m_Tsat) {
+            return false;
+        }
+    } else if (phase == WATER_GAS) {
+        r = (T <= m_Tsat) ? &m_vapor : &m_superheated;
+        if (T < m_Tmin || T > m_Tmax) {
+            return false;
+        }
+    } else {
+        return false;
+    }
+
+    double Plow, Phigh;
+    pressureRange(*r, T, Plow, Phigh);
+    if (P < Plow || P > Phigh) {
+        return false;
+    }
+    interpolate(*r, T, P, pressureToScaled(P, Plow, Phigh, phase), state);
+    return true;
+}
+
+void WaterPropsTable::evaluate(WaterPropsIAPWS& water, double T, double P,
+                               int phase, State& state)
+{
+    double rho = water.density(T, P, phase);
+    if (rho <= 0.0) {
+        throw CanteraError("WaterPropsTable::evaluate", "Unable to solve for "
+            "the density of water at T = {}, P = {}", T, P);
+    }
+    state.density = rho;
+    state.enthalpy = water.enthalpy();
+    state.entropy = water.entropy();
+    state.cp = water.cp();
+    state.cv = water.cv();
+    state.compressibility = water.isothermalCompressibility();
+    state.expansion = water.coeffThermExp();
+}
+
+double WaterPropsTable::maxError() const
+{
+    WaterPropsIAPWS water;
+    State exact, approx;
+    double err = 0.0;
+    for (const Region* r : {&m_liquid, &m_vapor, &m_superheated}) {
+        for (size_t i = 0; i < r->nT; i++) {
+            double T = r->T0 + (i + 0.5) * m_dT;
+            double Plow, Phigh;
+            pressureRange(*r, T, Plow, Phigh);
+            for (size_t j = 0; j < r->nP; j++) {
+                double x = (j + 0.5) / r->nP;
+                double P = scaledToPressure(x, Plow, Phigh, r->phase);
+                evaluate(water, T, P, r->phase, exact);
+                interpolate(*r, T, P, x, approx);
+                double RT = GasConstant * T;
+                err = std::max({err,
+                    std::abs(approx.density / exact.density - 1.0),
+                    std::abs(approx.enthalpy - exact.enthalpy) / RT,
+                    std::abs(approx.entropy - exact.entropy) / GasConstant,
+                    std::abs(approx.cp / exact.cp - 1.0),
+                    std::abs(approx.cv / exact.cv - 1.0),
+                    std::abs(approx.compressibility / exact.compressibility - 1.0),
+                    std::abs(approx.expansion - exact.expansion) /
+                        std::max(std::abs(exact.expansion), 1.0 / T)});
+            }
+        }
+    }
+    return err;
+}
+
+}
@@ -154,6 +154,11 @@ doublereal WaterSSTP::cv_mole() const
 
 void WaterSSTP::getEnthalpy_RT_ref(doublereal* hrt) const
 {
+    WaterPropsTable::State ref;
+    if (lookup(temperature(), OneAtm, ref)) {
+        *hrt = (ref.enthalpy + EW_Offset) / RT();
+        return;
+    }
     doublereal p = pressure();
     double T = temperature();
     double dens = density();
@@ -173,6 +178,12 @@ void WaterSSTP::getEnthalpy_RT_ref(doublereal* hrt) const
 
 void WaterSSTP::getGibbs_RT_ref(doublereal* grt) const
 {
+    WaterPropsTable::State ref;
+    if (lookup(temperature(), OneAtm, ref)) {
+        double T = temperature();
+        *grt = (ref.enthalpy - T * ref.entropy + EW_Offset - SW_Offset*T) / RT();
+        return;
+    }
     doublereal p = pressure();
     double T = temperature();
     double dens = density();
@@ -201,6 +212,11 @@ void WaterSSTP::getGibbs_ref(doublereal* g) const
 
 void WaterSSTP::getEntropy_R_ref(doublereal* sr) const
 {
+    WaterPropsTable::State ref;
+    if (lookup(temperature(), OneAtm, ref)) {
+        *sr = (ref.entropy + SW_Offset) / GasConstant;
+        return;
+    }
     doublereal p = pressure();
     double T = temperature();
     double dens = density();
@@ -223,6 +239,11 @@ void WaterSSTP::getEntropy_R_ref(doublereal* sr) const
 
 void WaterSSTP::getCp_R_ref(doublereal* cpr) const
 {
+    WaterPropsTable::State ref;
+    if (lookup(temperature(), OneAtm, ref)) {
+        *cpr = ref.cp / GasConstant;
+        return;
+    }
     doublereal p = pressure();
     double T = temperature();
     double dens = density();
@@ -243,6 +264,11 @@ void WaterSSTP::getCp_R_ref(doublereal* cpr) const
 
 void WaterSSTP::getStandardVolumes_ref(doublereal* vol) const
 {
+    WaterPropsTable::State ref;
+    if (lookup(temperature(), OneAtm, ref)) {
+        *vol = meanMolecularWeight() / ref.density;
+        return;
+    }
     doublereal p = pressure();
     double T = temperature();
     double dens = density();
@@ -267,6 +293,28 @@ doublereal WaterSSTP::pressure() const
 void WaterSSTP::setPressure(doublereal p)
 {
     double T = temperature();
+    WaterPropsTable::State s;
+    if (lookup(T, p, s)) {
+        // The tabulated density is only accurate to the tolerance of the
+        // table. Newton iterations on the equation of state, seeded with the
+        // tabulated density, make it consistent with the pressure so that
+        // the properties evaluated by m_sub are those of the actual state.
+        // Two iterations usually suffice. For the liquid, the residual
+        // pressure is limited by round-off in the density rather than by
+        // convergence, so the iteration stops when the density step does.
+        double rho = s.density;
+        for (int n = 0; n < 5; n++) {
+            m_sub.setState_TR(T, rho);
+            double drho = (p - m_sub.pressure()) * rho *
+                          m_sub.isothermalCompressibility();
+            rho += drho;
+            if (std::abs(drho) < 1e-14 * rho) {
+                break;
+            }
+        }
+        setDensity(rho);
+        return;
+    }
     double dens = density();
     int waterState = WATER_GAS;
     double rc = m_sub.Rhocrit();
@@ -334,6 +382,25 @@ void WaterSSTP::setDensity(const doublereal dens)
     m_sub.setState_TR(temperature(), dens);
 }
 
+void WaterSSTP::setTabulation(shared_ptr<WaterPropsTable> table)
+{
+    m_table = table;
+}
+
+void WaterSSTP::enableTabulation(double tol)
+{
+    setTabulation(WaterPropsTable::build(tol));
+}
+
+bool WaterSSTP::lookup(double T, double P, WaterPropsTable::State& state) const
+{
+    if (!m_table) {
+        return false;
+    }
+    int waterState = (density() > m_sub.Rhocrit()) ? WATER_LIQUID : WATER_GAS;
+    return m_table->lookup(T, P, waterState, state);
+}
+
 doublereal WaterSSTP::satPressure(doublereal t) {
     doublereal tsave = temperature();
     doublereal dsave = density();
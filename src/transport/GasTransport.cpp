@@ -6,6 +6,7 @@
 #include "cantera/transport/GasTransport.h"
 #include "MMCollisionInt.h"
 #include "cantera/base/stringUtils.h"
+#include "cantera/base/Tracer.h"
 #include "cantera/numerics/polyfit.h"
 #include "cantera/transport/TransportData.h"
 
@@ -96,6 +97,7 @@ doublereal GasTransport::viscosity()
 
 void GasTransport::updateViscosity_T()
 {
+    TraceSpan span("GasTransport::updateViscosity_T", "transport");
     if (!m_spvisc_ok) {
         updateSpeciesViscosities();
     }
@@ -135,6 +137,7 @@ void GasTransport::updateSpeciesViscosities()
 
 void GasTransport::updateDiff_T()
 {
+    TraceSpan span("GasTransport::updateDiff_T", "transport");
     update_T();
     // evaluate binary diffusion coefficients at unit pressure
     size_t ic = 0;
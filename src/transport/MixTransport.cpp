@@ -8,6 +8,7 @@
 
 #include "cantera/transport/MixTransport.h"
 #include "cantera/base/stringUtils.h"
+#include "cantera/base/Tracer.h"
 
 using namespace std;
 
@@ -124,6 +125,7 @@ void MixTransport::update_C()
 
 void MixTransport::updateCond_T()
 {
+    TraceSpan span("MixTransport::updateCond_T", "transport");
     if (m_mode == CK_Mode) {
         for (size_t k = 0; k < m_nsp; k++) {
             m_cond[k] = exp(dot4(m_polytempvec, m_condcoeffs[k]));
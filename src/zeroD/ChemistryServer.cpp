@@ -0,0 +1,606 @@
+//! @file ChemistryServer.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zeroD/ChemistryServer.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/ConstPressureReactor.h"
+#include "cantera/zeroD/IdealGasConstPressureReactor.h"
+#include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/transport/TransportBase.h"
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace Cantera
+{
+
+namespace {
+
+// Layout of the shared memory segment. The header is followed by the names
+// of the species, each terminated by a newline, and then by the slots, which
+// start at 64-byte boundaries so that clients working on neighboring slots do
+// not share cache lines. Each slot consists of a SlotHeader, the input array
+// and the output array.
+const char server_magic[8] = {'C', 'T', 'C', 'H', 'E', 'M', 'S', '\0'};
+const uint32_t server_version = 1;
+const size_t server_align = 64;
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2,
+              "ChemistryServer requires lock-free atomic integers");
+
+enum RequestType : uint32_t {
+    NetProductionRatesRequest = 1,
+    PropertiesRequest,
+    ReactorRequest,
+    ShutdownRequest
+};
+
+//! States of a slot. The slot is owned by the client when it is idle or
+//! done, and by the server when it holds a request. A request is abandoned
+//! when the client stops waiting for it, in which case the server releases
+//! the slot once it has dealt with the request.
+enum SlotState : uint32_t {
+    SlotIdle = 0,
+    SlotRequest,
+    SlotDone,
+    SlotAbandoned
+};
+
+struct SegmentHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t nSlots;
+    uint64_t nSpecies;
+    uint64_t maxPoints;
+    uint64_t slotSize;
+    uint64_t slotsOffset;
+    uint64_t namesSize;
+
+    //! Set when the segment has been initialized
+    std::atomic<uint32_t> ready;
+
+    //! Set by a shutdown request
+    std::atomic<uint32_t> shutdown;
+
+    //! Number of published requests that the server has not yet taken,
+    //! so that an idle server does not have to scan all of the slots
+    std::atomic<uint32_t> pending;
+};
+
+struct SlotHeader {
+    //! Nonzero if the slot is assigned to a client
+    std::atomic<uint32_t> owner;
+    std::atomic<uint32_t> state;
+    uint32_t type;
+    int32_t status;
+    uint64_t nPoints;
+    double dt;
+    char message[512];
+};
+
+size_t alignUp(size_t n)
+{
+    return (n + server_align - 1) / server_align * server_align;
+}
+
+// Number of doubles in the input and output arrays of each slot
+size_t inputSize(size_t nsp, size_t maxPoints)
+{
+    return maxPoints * (2 + nsp);
+}
+
+size_t outputSize(size_t nsp, size_t maxPoints)
+{
+    return maxPoints * (nServerProperties + nsp);
+}
+
+SegmentHeader* segmentHeader(char* map)
+{
+    return reinterpret_cast<SegmentHeader*>(map);
+}
+
+SlotHeader* slotHeader(char* map, size_t n)
+{
+    SegmentHeader* h = segmentHeader(map);
+    return reinterpret_cast<SlotHeader*>(map + h->slotsOffset + n * h->slotSize);
+}
+
+double* slotInput(char* map, size_t n)
+{
+    return reinterpret_cast<double*>(
+        reinterpret_cast<char*>(slotHeader(map, n)) + alignUp(sizeof(SlotHeader)));
+}
+
+double* slotOutput(char* map, size_t n)
+{
+    SegmentHeader* h = segmentHeader(map);
+    return slotInput(map, n) + inputSize(h->nSpecies, h->maxPoints);
+}
+
+string segmentName(const string& name)
+{
+    return (name.empty() || name[0] != '/') ? "/" + name : name;
+}
+
+// Return a slot to the pool of free slots
+void releaseSlot(SlotHeader* s)
+{
+    s->state.store(SlotIdle, memory_order_relaxed);
+    s->owner.store(0, memory_order_release);
+}
+
+}
+
+ChemistryServer::ChemistryServer(const string& name, ThermoPhase& thermo,
+                                 Kinetics& kin, Transport* trans,
+                                 size_t nSlots, size_t maxPoints) :
+    m_name(segmentName(name)),
+    m_thermo(thermo),
+    m_kin(kin),
+    m_trans(trans),
+    m_rtol(1e-9),
+    m_atol(1e-15),
+    m_map(0),
+    m_mapSize(0),
+    m_stop(false)
+{
+    if (nSlots == 0 || maxPoints == 0) {
+        throw CanteraError("ChemistryServer::ChemistryServer",
+            "The number of slots and the number of points per request must be "
+            "positive.");
+    }
+#ifdef _WIN32
+    throw CanteraError("ChemistryServer::ChemistryServer",
+        "Shared memory servers are not supported on this platform.");
+#else
+    size_t nsp = thermo.nSpecies();
+    string names;
+    for (size_t k = 0; k < nsp; k++) {
+        names += thermo.speciesName(k) + "\n";
+    }
+    size_t slotsOffset = alignUp(sizeof(SegmentHeader) + names.size());
+    size_t slotSize = alignUp(alignUp(sizeof(SlotHeader)) + sizeof(double) *
+        (inputSize(nsp, maxPoints) + outputSize(nsp, maxPoints)));
+    size_t size = slotsOffset + nSlots * slotSize;
+
+    int fd = shm_open(m_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        throw CanteraError("ChemistryServer::ChemistryServer",
+            "Could not create shared memory segment '{}': {}", m_name,
+            strerror(errno));
+    }
+    void* map = MAP_FAILED;
+    if (ftruncate(fd, size) == 0) {
+        map = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+    if (map == MAP_FAILED) {
+        int err = errno;
+        shm_unlink(m_name.c_str());
+        throw CanteraError("ChemistryServer::ChemistryServer",
+            "Could not map shared memory segment '{}': {}", m_name,
+            strerror(err));
+    }
+    m_map = static_cast<char*>(map);
+    m_mapSize = size;
+
+    SegmentHeader* h = new (m_map) SegmentHeader();
+    copy_n(server_magic, 8, h->magic);
+    h->version = server_version;
+    h->nSlots = static_cast<uint32_t>(nSlots);
+    h->nSpecies = nsp;
+    h->maxPoints = maxPoints;
+    h->slotSize = slotSize;
+    h->slotsOffset = slotsOffset;
+    h->namesSize = names.size();
+    h->shutdown.store(0);
+    h->pending.store(0);
+    copy(names.begin(), names.end(), m_map + sizeof(SegmentHeader));
+    for (size_t n = 0; n < nSlots; n++) {
+        SlotHeader* s = new (slotHeader(m_map, n)) SlotHeader();
+        s->owner.store(0);
+        s->state.store(SlotIdle);
+    }
+    // Clients check this flag before using the segment
+    h->ready.store(1, memory_order_release);
+#endif
+}
+
+ChemistryServer::~ChemistryServer()
+{
+#ifndef _WIN32
+    if (m_map) {
+        segmentHeader(m_map)->shutdown.store(1, memory_order_release);
+        munmap(m_map, m_mapSize);
+        shm_unlink(m_name.c_str());
+    }
+#endif
+}
+
+void ChemistryServer::serve()
+{
+    SegmentHeader* h = segmentHeader(m_map);
+    size_t idle = 0;
+    while (!m_stop.load(memory_order_acquire) &&
+           !h->shutdown.load(memory_order_acquire)) {
+        if (poll()) {
+            idle = 0;
+        } else if (++idle < 1000) {
+            this_thread::yield();
+        } else {
+            // Stop spinning if there has been no request for a while
+            this_thread::sleep_for(chrono::microseconds(50));
+        }
+    }
+}
+
+size_t ChemistryServer::poll()
+{
+    SegmentHeader* h = segmentHeader(m_map);
+    if (h->pending.load(memory_order_acquire) == 0) {
+        return 0;
+    }
+    size_t answered = 0;
+    for (size_t n = 0; n < h->nSlots; n++) {
+        SlotHeader* s = slotHeader(m_map, n);
+        uint32_t state = s->state.load(memory_order_acquire);
+        if (state == SlotRequest) {
+            h->pending.fetch_sub(1, memory_order_relaxed);
+            answer(n);
+            answered++;
+        } else if (state == SlotAbandoned) {
+            // The client gave up before the request was taken
+            h->pending.fetch_sub(1, memory_order_relaxed);
+            releaseSlot(s);
+        }
+    }
+    return answered;
+}
+
+void ChemistryServer::stop()
+{
+    m_stop.store(true, memory_order_release);
+}
+
+void ChemistryServer::setTolerances(double rtol, double atol)
+{
+    m_rtol = rtol;
+    m_atol = atol;
+    if (m_net) {
+        m_net->setTolerances(rtol, atol);
+    }
+}
+
+void ChemistryServer::answer(size_t n)
+{
+    SlotHeader* s = slotHeader(m_map, n);
+    size_t nsp = m_thermo.nSpecies();
+    size_t np = s->nPoints;
+    const double* T = slotInput(m_map, n);
+    const double* P = T + np;
+    const double* Y = P + np;
+    double* out = slotOutput(m_map, n);
+    s->status = 0;
+    try {
+        if (np > segmentHeader(m_map)->maxPoints) {
+            throw CanteraError("ChemistryServer::answer",
+                "Request for {} points exceeds the maximum of {}.", np,
+                segmentHeader(m_map)->maxPoints);
+        }
+        if (s->type == NetProductionRatesRequest) {
+            for (size_t i = 0; i < np; i++) {
+                m_thermo.setState_TPY(T[i], P[i], Y + i*nsp);
+                m_kin.getNetProductionRates(out + i*nsp);
+            }
+        } else if (s->type == PropertiesRequest) {
+            if (!m_trans) {
+                throw CanteraError("ChemistryServer::answer",
+                    "The server has no transport manager.");
+            }
+            for (size_t i = 0; i < np; i++) {
+                double* p = out + i*(nServerProperties + nsp);
+                m_thermo.setState_TPY(T[i], P[i], Y + i*nsp);
+                p[0] = m_thermo.density();
+                p[1] = m_thermo.cp_mass();
+                p[2] = m_thermo.enthalpy_mass();
+                p[3] = m_trans->viscosity();
+                p[4] = m_trans->thermalConductivity();
+                m_trans->getMixDiffCoeffs(p + nServerProperties);
+            }
+        } else if (s->type == ReactorRequest) {
+            advanceReactors(n);
+        } else if (s->type == ShutdownRequest) {
+            segmentHeader(m_map)->shutdown.store(1, memory_order_release);
+        } else {
+            throw CanteraError("ChemistryServer::answer",
+                "Unknown request type {}.", s->type);
+        }
+    } catch (std::exception& err) {
+        s->status = -1;
+        strncpy(s->message, err.what(), sizeof(s->message) - 1);
+        s->message[sizeof(s->message) - 1] = '\0';
+    }
+    uint32_t request = SlotRequest;
+    if (!s->state.compare_exchange_strong(request, SlotDone,
+                                          memory_order_acq_rel)) {
+        // The client abandoned the request while it was being answered
+        releaseSlot(s);
+    }
+}
+
+void ChemistryServer::advanceReactors(size_t n)
+{
+    if (!m_reactor) {
+        if (dynamic_cast<IdealGasPhase*>(&m_thermo)) {
+            m_reactor.reset(new IdealGasConstPressureReactor());
+        } else {
+            m_reactor.reset(new ConstPressureReactor());
+        }
+        m_reactor->setThermoMgr(m_thermo);
+        m_reactor->setKineticsMgr(m_kin);
+        m_net.reset(new ReactorNet());
+        m_net->addReactor(*m_reactor);
+        m_net->setTolerances(m_rtol, m_atol);
+    }
+    SlotHeader* s = slotHeader(m_map, n);
+    size_t nsp = m_thermo.nSpecies();
+    size_t np = s->nPoints;
+    const double* T = slotInput(m_map, n);
+    const double* P = T + np;
+    const double* Y = P + np;
+    double* out = slotOutput(m_map, n);
+    for (size_t i = 0; i < np; i++) {
+        m_thermo.setState_TPY(T[i], P[i], Y + i*nsp);
+        m_reactor->syncState();
+        m_net->setInitialTime(0.0);
+        m_net->advance(s->dt);
+        out[i*(nsp+1)] = m_thermo.temperature();
+        m_thermo.getMassFractions(out + i*(nsp+1) + 1);
+    }
+}
+
+// ---------- ChemistryClient ----------
+
+ChemistryClient::ChemistryClient() :
+    m_nsp(0),
+    m_maxPoints(0),
+    m_timeout(60.0),
+    m_map(0),
+    m_mapSize(0),
+    m_slot(npos)
+{
+}
+
+ChemistryClient::ChemistryClient(const string& name) :
+    m_nsp(0),
+    m_maxPoints(0),
+    m_timeout(60.0),
+    m_map(0),
+    m_mapSize(0),
+    m_slot(npos)
+{
+#ifdef _WIN32
+    throw CanteraError("ChemistryClient::ChemistryClient",
+        "Shared memory servers are not supported on this platform.");
+#else
+    string shmName = segmentName(name);
+    int fd = shm_open(shmName.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        throw CanteraError("ChemistryClient::ChemistryClient",
+            "Could not open shared memory segment '{}': {}", shmName,
+            strerror(errno));
+    }
+    struct stat st;
+    void* map = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && size_t(st.st_size) >= sizeof(SegmentHeader)) {
+        map = mmap(0, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+    if (map == MAP_FAILED) {
+        throw CanteraError("ChemistryClient::ChemistryClient",
+            "Could not map shared memory segment '{}'.", shmName);
+    }
+    m_map = static_cast<char*>(map);
+    m_mapSize = st.st_size;
+
+    SegmentHeader* h = segmentHeader(m_map);
+    if (!equal(server_magic, server_magic + 8, h->magic)
+        || h->version != server_version
+        || !h->ready.load(memory_order_acquire)) {
+        munmap(m_map, m_mapSize);
+        m_map = 0;
+        throw CanteraError("ChemistryClient::ChemistryClient",
+            "Shared memory segment '{}' does not belong to a chemistry "
+            "server.", shmName);
+    }
+    m_nsp = h->nSpecies;
+    m_maxPoints = h->maxPoints;
+    const char* names = m_map + sizeof(SegmentHeader);
+    const char* end = names + h->namesSize;
+    while (names < end) {
+        const char* eol = find(names, end, '\n');
+        m_speciesNames.emplace_back(names, eol);
+        names = eol + 1;
+    }
+
+    // Claim the first free slot
+    for (size_t n = 0; n < h->nSlots; n++) {
+        uint32_t free = 0;
+        if (slotHeader(m_map, n)->owner.compare_exchange_strong(free, 1)) {
+            m_slot = n;
+            break;
+        }
+    }
+    if (m_slot == npos) {
+        size_t nSlots = h->nSlots;
+        munmap(m_map, m_mapSize);
+        m_map = 0;
+        throw CanteraError("ChemistryClient::ChemistryClient",
+            "All {} slots of server '{}' are in use.", nSlots, shmName);
+    }
+#endif
+}
+
+ChemistryClient::~ChemistryClient()
+{
+#ifndef _WIN32
+    if (m_map) {
+        // If the server still holds a request, it releases the slot after
+        // dealing with it
+        uint32_t request = SlotRequest;
+        SlotHeader* s = slotHeader(m_map, m_slot);
+        if (!s->state.compare_exchange_strong(request, SlotAbandoned,
+                                              memory_order_acq_rel)) {
+            releaseSlot(s);
+        }
+        munmap(m_map, m_mapSize);
+    }
+#endif
+}
+
+const string& ChemistryClient::speciesName(size_t k) const
+{
+    if (k >= m_nsp) {
+        throw IndexError("ChemistryClient::speciesName", "species", k, m_nsp-1);
+    }
+    return m_speciesNames[k];
+}
+
+size_t ChemistryClient::speciesIndex(const string& name) const
+{
+    for (size_t k = 0; k < m_nsp; k++) {
+        if (m_speciesNames[k] == name) {
+            return k;
+        }
+    }
+    return npos;
+}
+
+void ChemistryClient::getNetProductionRates(size_t n, const double* T,
+                                            const double* P, const double* Y,
+                                            double* wdot)
+{
+    checkAttached("getNetProductionRates");
+    for (size_t i = 0; i < n; i += m_maxPoints) {
+        size_t np = std::min(m_maxPoints, n - i);
+        request(NetProductionRatesRequest, np, 0.0, T + i, P + i,
+                Y + i*m_nsp, wdot + i*m_nsp, m_nsp);
+    }
+}
+
+void ChemistryClient::getProperties(size_t n, const double* T,
+                                    const double* P, const double* Y,
+                                    double* props)
+{
+    checkAttached("getProperties");
+    size_t stride = nServerProperties + m_nsp;
+    for (size_t i = 0; i < n; i += m_maxPoints) {
+        size_t np = std::min(m_maxPoints, n - i);
+        request(PropertiesRequest, np, 0.0, T + i, P + i, Y + i*m_nsp,
+                props + i*stride, stride);
+    }
+}
+
+void ChemistryClient::advanceReactors(size_t n, double dt, double* T,
+                                      const double* P, double* Y)
+{
+    checkAttached("advanceReactors");
+    vector_fp out(std::min(n, m_maxPoints) * (m_nsp + 1));
+    for (size_t i = 0; i < n; i += m_maxPoints) {
+        size_t np = std::min(m_maxPoints, n - i);
+        request(ReactorRequest, np, dt, T + i, P + i, Y + i*m_nsp,
+                out.data(), m_nsp + 1);
+        for (size_t j = 0; j < np; j++) {
+            T[i+j] = out[j*(m_nsp+1)];
+            copy_n(&out[j*(m_nsp+1) + 1], m_nsp, Y + (i+j)*m_nsp);
+        }
+    }
+}
+
+void ChemistryClient::shutdownServer()
+{
+    checkAttached("shutdownServer");
+    request(ShutdownRequest, 0, 0.0, 0, 0, 0, 0, 0);
+}
+
+void ChemistryClient::request(int type, size_t n, double dt, const double* T,
+                              const double* P, const double* Y, double* out,
+                              size_t outStride)
+{
+    SegmentHeader* h = segmentHeader(m_map);
+    SlotHeader* s = slotHeader(m_map, m_slot);
+    if (s->state.load(memory_order_acquire) == SlotRequest) {
+        throw CanteraError("ChemistryClient::request",
+            "The server has not answered a previous request.");
+    }
+    double* in = slotInput(m_map, m_slot);
+    copy_n(T, n, in);
+    copy_n(P, n, in + n);
+    copy_n(Y, n * m_nsp, in + 2*n);
+    s->type = type;
+    s->nPoints = n;
+    s->dt = dt;
+    // Count the request before publishing it, so that the server never sees
+    // a published request while the count is zero
+    h->pending.fetch_add(1, memory_order_release);
+    s->state.store(SlotRequest, memory_order_release);
+
+    auto start = chrono::steady_clock::now();
+    size_t spins = 0;
+    while (s->state.load(memory_order_acquire) != SlotDone) {
+        if (++spins < 1000) {
+            this_thread::yield();
+            continue;
+        }
+        spins = 0;
+        if (h->shutdown.load(memory_order_acquire) && type != ShutdownRequest) {
+            throw CanteraError("ChemistryClient::request",
+                "The server has shut down.");
+        }
+        chrono::duration<double> waited = chrono::steady_clock::now() - start;
+        uint32_t request = SlotRequest;
+        if (m_timeout > 0 && waited.count() > m_timeout &&
+            s->state.compare_exchange_strong(request, SlotAbandoned,
+                                             memory_order_acq_rel)) {
+            // The slot now belongs to the server, which releases it once it
+            // has dealt with the request
+            munmap(m_map, m_mapSize);
+            m_map = 0;
+            m_slot = npos;
+            throw CanteraError("ChemistryClient::request",
+                "No answer from the server after {} s. The client has been "
+                "detached from the server.", waited.count());
+        }
+        this_thread::sleep_for(chrono::microseconds(20));
+    }
+    s->state.store(SlotIdle, memory_order_relaxed);
+    if (s->status != 0) {
+        throw CanteraError("ChemistryClient::request", "Server error: {}",
+                           s->message);
+    }
+    copy_n(slotOutput(m_map, m_slot), n * outStride, out);
+}
+
+void ChemistryClient::checkAttached(const string& method) const
+{
+    if (!m_map) {
+        throw CanteraError("ChemistryClient::" + method,
+                           "Client is not attached to a server.");
+    }
+}
+
+}
@@ -0,0 +1,90 @@
+//! @file IgnitionDelayModel.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zeroD/IgnitionDelayModel.h"
+
+namespace Cantera
+{
+
+IgnitionDelayModel::IgnitionDelayModel(const std::string& infile,
+                                       const std::string& id, double T0,
+                                       double P0, const std::string& X0,
+                                       double deltaT, double tMax) :
+    m_gas(infile, id),
+    m_T0(T0),
+    m_P0(P0),
+    m_deltaT(deltaT),
+    m_tMax(tMax),
+    m_horizon(10.0),
+    m_tau0(Undef),
+    m_h0(0.0)
+{
+    m_gas.setState_TPX(T0, P0, X0);
+    m_Y0.resize(m_gas.nSpecies());
+    m_gas.getMassFractions(m_Y0.data());
+    m_reactor.insert(m_gas);
+    m_net.addReactor(m_reactor);
+}
+
+void IgnitionDelayModel::solveNominal(double* outputs)
+{
+    m_net.setInitialStepSize(0.0);
+    m_tau0 = ignitionDelay(m_tMax, &m_h0);
+    outputs[0] = m_tau0;
+    m_net.setInitialStepSize(m_h0);
+}
+
+bool IgnitionDelayModel::copyNominal(const EnsembleModel& other)
+{
+    auto nominal = dynamic_cast<const IgnitionDelayModel*>(&other);
+    if (!nominal || nominal->m_tau0 == Undef) {
+        return false;
+    }
+    m_tau0 = nominal->m_tau0;
+    m_h0 = nominal->m_h0;
+    m_net.setInitialStepSize(m_h0);
+    return true;
+}
+
+void IgnitionDelayModel::setHorizon(double factor)
+{
+    if (factor <= 1.0) {
+        throw CanteraError("IgnitionDelayModel::setHorizon",
+            "Horizon must be greater than 1. Got {}.", factor);
+    }
+    m_horizon = factor;
+}
+
+void IgnitionDelayModel::solve(double* outputs)
+{
+    outputs[0] = ignitionDelay(std::min(m_tMax, m_horizon * m_tau0));
+}
+
+double IgnitionDelayModel::ignitionDelay(double tEnd, double* h0)
+{
+    m_gas.setState_TPY(m_T0, m_P0, m_Y0.data());
+    m_reactor.syncState();
+    m_net.setInitialTime(0.0);
+    double Tign = m_T0 + m_deltaT;
+    double t = 0.0;
+    double T = m_T0;
+    while (t < tEnd) {
+        double tlast = t;
+        double Tlast = T;
+        t = m_net.step();
+        if (h0 && tlast == 0.0) {
+            *h0 = t;
+        }
+        T = m_reactor.temperature();
+        if (T >= Tign) {
+            // Interpolate linearly within the last step
+            return tlast + (t - tlast) * (Tign - Tlast) / (T - Tlast);
+        }
+    }
+    throw CensoredSampleError("IgnitionDelayModel::ignitionDelay",
+        "No ignition within {} s.", tEnd);
+}
+
+}
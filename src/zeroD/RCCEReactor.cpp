@@ -0,0 +1,145 @@
+//! @file RCCEReactor.cpp A constant pressure zero-dimensional reactor using
+//!     rate-controlled constrained equilibrium
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zeroD/RCCEReactor.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+void RCCEReactor::setThermoMgr(ThermoPhase& thermo)
+{
+    if (thermo.type() != "IdealGas") {
+        throw CanteraError("RCCEReactor::setThermoMgr",
+                           "Incompatible phase type provided");
+    }
+    Reactor::setThermoMgr(thermo);
+}
+
+void RCCEReactor::addConstraint(const string& name,
+                                const compositionMap& coeffs)
+{
+    m_constraints.emplace_back(name, coeffs);
+    m_nv = 0; // require re-initialization
+}
+
+RCCE& RCCEReactor::rcce()
+{
+    if (!m_rcce) {
+        throw CanteraError("RCCEReactor::rcce",
+                           "Reactor '{}' is not initialized", m_name);
+    }
+    return *m_rcce;
+}
+
+void RCCEReactor::initialize(doublereal t0)
+{
+    Reactor::initialize(t0);
+    if (!m_inlet.empty() || !m_outlet.empty() || !m_surfaces.empty()) {
+        throw CanteraError("RCCEReactor::initialize",
+            "Inlets, outlets and surfaces are not supported.");
+    }
+    m_rcce.reset(new RCCE(*m_thermo));
+    for (const auto& c : m_constraints) {
+        m_rcce->addConstraint(c.first, c.second);
+    }
+    m_cdot.resize(m_rcce->nConstraints());
+    m_nv = m_rcce->nConstraints() + 2;
+}
+
+void RCCEReactor::getState(double* y)
+{
+    if (m_thermo == 0) {
+        throw CanteraError("getState",
+                           "Error: reactor is empty.");
+    }
+    m_thermo->restoreState(m_state);
+
+    // set the first component to the total mass
+    m_mass = m_thermo->density() * m_vol;
+    y[0] = m_mass;
+
+    // Move the contents to the constrained-equilibrium state
+    vector_fp c(m_rcce->nConstraints());
+    m_rcce->getConstraints(c.data());
+    m_rcce->setToConstrainedEquilState(c.data(), !m_energy);
+    m_vol = m_mass / m_thermo->density();
+    m_thermo->saveState(m_state);
+
+    // set the second component to the temperature
+    y[1] = m_thermo->temperature();
+
+    // set the remaining components to the constraint potentials
+    const vector_fp& lambda = m_rcce->constraintPotentials();
+    copy(lambda.begin(), lambda.end(), y + 2);
+}
+
+void RCCEReactor::updateState(doublereal* y)
+{
+    // The components of y are [0] the total mass, [1] the temperature, and
+    // [2...] the constraint potentials
+    m_mass = y[0];
+    m_thermo->setState_TP(y[1], m_pressure);
+    m_rcce->setState_Potentials(y + 2, y[1]);
+    m_vol = m_mass / m_thermo->density();
+
+    // save parameters needed by other connected reactors
+    m_enthalpy = m_thermo->enthalpy_mass();
+    m_intEnergy = m_thermo->intEnergy_mass();
+    m_thermo->saveState(m_state);
+}
+
+void RCCEReactor::evalEqs(doublereal time, doublereal* y,
+                          doublereal* ydot, doublereal* params)
+{
+    m_thermo->restoreState(m_state);
+    applySensitivity(params);
+    evalWalls(time);
+
+    if (m_chem) {
+        m_kin->getNetProductionRates(&m_wdot[0]); // "omega dot"
+    }
+    m_rcce->getConstraintRates(m_wdot.data(), m_cdot.data());
+
+    // external heat transfer
+    double dhdt = - m_Q / m_mass;
+
+    ydot[0] = 0.0;
+    ydot[1] = m_rcce->getPotentialRates(m_cdot.data(), dhdt, ydot + 2,
+                                        !m_energy);
+    resetSensitivity(params);
+}
+
+size_t RCCEReactor::componentIndex(const string& nm) const
+{
+    if (nm == "mass") {
+        return 0;
+    } else if (nm == "temperature") {
+        return 1;
+    } else if (m_rcce) {
+        size_t j = m_rcce->constraintIndex(nm);
+        if (j != npos) {
+            return j + 2;
+        }
+    }
+    return npos;
+}
+
+std::string RCCEReactor::componentName(size_t k)
+{
+    if (k == 0) {
+        return "mass";
+    } else if (k == 1) {
+        return "temperature";
+    } else if (m_rcce && k >= 2 && k < neq()) {
+        return m_rcce->constraintName(k - 2);
+    }
+    throw CanteraError("RCCEReactor::componentName",
+                       "Index is out of bounds.");
+}
+
+}
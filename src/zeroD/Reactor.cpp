@@ -166,6 +166,14 @@ void Reactor::updateState(doublereal* y)
     m_thermo->saveState(m_state);
 }
 
+void Reactor::updateQSSState()
+{
+    if (m_chem && m_kin) {
+        m_kin->applyQSSConcentrations();
+        m_thermo->saveState(m_state);
+    }
+}
+
 void Reactor::updateSurfaceState(double* y)
 {
     size_t loc = 0;
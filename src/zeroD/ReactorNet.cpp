@@ -15,7 +15,6 @@ namespace Cantera
 {
 
 ReactorNet::ReactorNet() :
-    m_integ(newIntegrator("CVODE")),
     m_time(0.0), m_init(false), m_integrator_init(false),
     m_nv(0), m_rtol(1.0e-9), m_rtolsens(1.0e-4),
     m_atols(1.0e-15), m_atolsens(1.0e-6),
@@ -23,12 +22,7 @@ ReactorNet::ReactorNet() :
     m_verbose(false)
 {
     suppressErrors(true);
-
-    // use backward differencing, with a full Jacobian computed
-    // numerically, and use a Newton linear iterator
-    m_integ->setMethod(BDF_Method);
-    m_integ->setProblemType(DENSE + NOJAC);
-    m_integ->setIterator(Newton_Iter);
+    setIntegrator("CVODE");
 }
 
 void ReactorNet::setInitialTime(double time)
@@ -43,6 +37,19 @@ void ReactorNet::setMaxTimeStep(double maxstep)
     m_init = false;
 }
 
+void ReactorNet::setIntegrator(const std::string& itype)
+{
+    m_integ.reset(newIntegrator(itype));
+    if (itype == "CVODE") {
+        // use backward differencing, with a full Jacobian computed
+        // numerically, and use a Newton linear iterator
+        m_integ->setMethod(BDF_Method);
+        m_integ->setProblemType(DENSE + NOJAC);
+        m_integ->setIterator(Newton_Iter);
+    }
+    m_init = false;
+}
+
 void ReactorNet::setMaxErrTestFails(int nmax)
 {
     m_maxErrTestFails = nmax;
@@ -60,6 +67,11 @@ void ReactorNet::setTolerances(double rtol, double atol)
     m_init = false;
 }
 
+void ReactorNet::setWarmRestart(bool warm, double jacTol, int maxJacAge)
+{
+    m_integ->setWarmRestart(warm, jacTol, maxJacAge);
+}
+
 void ReactorNet::setSensitivityTolerances(double rtol, double atol)
 {
     if (rtol >= 0.0) {
@@ -134,6 +146,9 @@ void ReactorNet::advance(doublereal time)
     m_integ->integrate(time);
     m_time = time;
     updateState(m_integ->solution());
+    for (auto r : m_reactors) {
+        r->updateQSSState();
+    }
 }
 
 double ReactorNet::step()
@@ -145,6 +160,9 @@ double ReactorNet::step()
     }
     m_time = m_integ->step(m_time + 1.0);
     updateState(m_integ->solution());
+    for (auto r : m_reactors) {
+        r->updateQSSState();
+    }
     return m_time;
 }
 
@@ -180,7 +198,7 @@ double ReactorNet::sensitivity(size_t k, size_t p)
     return m_integ->sensitivity(k, p) / denom;
 }
 
-void ReactorNet::evalJacobian(doublereal t, doublereal* y,
+bool ReactorNet::evalJacobian(doublereal t, doublereal* y,
                               doublereal* ydot, doublereal* p, Array2D* j)
 {
     //evaluate the unperturbed ydot
@@ -201,6 +219,7 @@ void ReactorNet::evalJacobian(doublereal t, doublereal* y,
         }
         y[n] = ysave;
     }
+    return true;
 }
 
 void ReactorNet::updateState(doublereal* y)
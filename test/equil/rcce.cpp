@@ -0,0 +1,205 @@
+#include "gtest/gtest.h"
+
+#include "cantera/equil/RCCE.h"
+#include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/kinetics/importKinetics.h"
+#include "cantera/IdealGasMix.h"
+#include "cantera/zeroD/RCCEReactor.h"
+#include "cantera/zeroD/IdealGasConstPressureReactor.h"
+#include "cantera/zeroD/ReactorNet.h"
+
+using namespace Cantera;
+
+class RCCETest : public testing::Test
+{
+public:
+    RCCETest() : gas("h2o2.cti"), rcce(gas) {
+        gas.setState_TPX(1200, OneAtm, "H2:0.3, O2:0.15, H2O:0.05, AR:0.5");
+    }
+
+    //! Set a state with radicals, so that the constrained-equilibrium state
+    //! is far from equilibrium
+    void addRadicals() {
+        rcce.addConstraint("radicals", {{"H", 1.0}, {"O", 2.0}, {"OH", 1.0}});
+        rcce.addConstraint("HO2", {{"HO2", 1.0}, {"H2O2", 1.0}});
+        gas.setState_TPX(1200, OneAtm, "H2:0.3, O2:0.15, H2O:0.05, AR:0.5, "
+                         "H:1e-3, O:1e-4, OH:1e-3, HO2:1e-5, H2O2:1e-6");
+    }
+
+    IdealGasPhase gas;
+    RCCE rcce;
+};
+
+TEST_F(RCCETest, elements_only)
+{
+    ASSERT_EQ(gas.nElements(), rcce.nConstraints());
+    IdealGasPhase ref("h2o2.cti");
+    ref.setState_TPX(1200, OneAtm, "H2:0.3, O2:0.15, H2O:0.05, AR:0.5");
+    ref.equilibrate("HP", "element_potential");
+
+    vector_fp c(rcce.nConstraints());
+    rcce.getConstraints(c.data());
+    rcce.setToConstrainedEquilState(c.data());
+    EXPECT_NEAR(ref.temperature(), gas.temperature(), 1e-6);
+    for (size_t k = 0; k < gas.nSpecies(); k++) {
+        EXPECT_NEAR(ref.moleFraction(k), gas.moleFraction(k), 1e-8);
+    }
+}
+
+TEST_F(RCCETest, add_constraints)
+{
+    addRadicals();
+    ASSERT_EQ(gas.nElements() + 2, rcce.nConstraints());
+    EXPECT_EQ(gas.nElements() + 1, rcce.constraintIndex("HO2"));
+    EXPECT_EQ("radicals", rcce.constraintName(gas.nElements()));
+    EXPECT_EQ(2.0, rcce.constraintCoeff(gas.speciesIndex("O"),
+                                        rcce.constraintIndex("radicals")));
+    EXPECT_THROW(rcce.addConstraint("HO2", {{"HO2", 1.0}}), CanteraError);
+    EXPECT_THROW(rcce.addConstraint("fuel", {{"CH4", 1.0}}), CanteraError);
+
+    size_t nc = rcce.nConstraints();
+    vector_fp c(nc), c2(nc);
+    double h = gas.enthalpy_mass();
+    double P = gas.pressure();
+    rcce.getConstraints(c.data());
+    rcce.setToConstrainedEquilState(c.data());
+    rcce.getConstraints(c2.data());
+    for (size_t j = 0; j < nc; j++) {
+        EXPECT_NEAR(c[j], c2[j], 1e-9 * c[j]);
+    }
+    EXPECT_NEAR(h, gas.enthalpy_mass(), 1e-8 * std::abs(h));
+    EXPECT_DOUBLE_EQ(P, gas.pressure());
+
+    // The mixture is not at equilibrium
+    IdealGasPhase ref("h2o2.cti");
+    ref.setState_TPY(gas.temperature(), gas.pressure(), gas.massFractions());
+    ref.equilibrate("HP", "element_potential");
+    EXPECT_GT(std::abs(ref.temperature() - gas.temperature()), 10.0);
+
+    // Setting the state from the potentials reproduces the same state
+    vector_fp X(gas.nSpecies());
+    gas.getMoleFractions(X.data());
+    double T = gas.temperature();
+    gas.setState_TPX(300, P, "H2:1.0");
+    rcce.setState_Potentials(rcce.constraintPotentials().data(), T);
+    for (size_t k = 0; k < gas.nSpecies(); k++) {
+        EXPECT_NEAR(X[k], gas.moleFraction(k), 1e-12);
+    }
+}
+
+TEST_F(RCCETest, hold_temperature)
+{
+    addRadicals();
+    vector_fp c(rcce.nConstraints());
+    rcce.getConstraints(c.data());
+    rcce.setToConstrainedEquilState(c.data(), true);
+    EXPECT_DOUBLE_EQ(1200, gas.temperature());
+}
+
+TEST_F(RCCETest, potential_rates)
+{
+    addRadicals();
+    GasKinetics kin;
+    std::vector<ThermoPhase*> phases{&gas};
+    importKinetics(gas.xml(), phases, &kin);
+
+    size_t nc = rcce.nConstraints();
+    vector_fp c(nc), cdot(nc), lambdaDot(nc), wdot(gas.nSpecies());
+    rcce.getConstraints(c.data());
+    rcce.setToConstrainedEquilState(c.data());
+    double T = gas.temperature();
+    vector_fp lambda = rcce.constraintPotentials();
+    kin.getNetProductionRates(wdot.data());
+    rcce.getConstraintRates(wdot.data(), cdot.data());
+    double Tdot = rcce.getPotentialRates(cdot.data(), 0.0, lambdaDot.data());
+
+    // Compare to finite difference approximation
+    double dt = 1e-12;
+    for (size_t j = 0; j < nc; j++) {
+        c[j] += cdot[j] * dt;
+    }
+    rcce.setToConstrainedEquilState(c.data());
+    const vector_fp& lambda2 = rcce.constraintPotentials();
+    double scale = std::abs(Tdot) / T;
+    for (size_t j = 0; j < nc; j++) {
+        scale = std::max(scale, std::abs(lambdaDot[j]));
+    }
+    EXPECT_GT(scale, 0.0);
+    for (size_t j = 0; j < nc; j++) {
+        EXPECT_NEAR(lambdaDot[j], (lambda2[j] - lambda[j]) / dt, 1e-3 * scale)
+            << rcce.constraintName(j);
+    }
+    EXPECT_NEAR(Tdot, (gas.temperature() - T) / dt, 1e-3 * scale * T);
+}
+
+//! Time at which the temperature of `r` has risen by `dT`, or -1 if that
+//! does not happen within `tmax`
+double ignitionDelay(ReactorNet& net, Reactor& r, double dT, double tmax)
+{
+    double T0 = r.temperature();
+    while (r.temperature() < T0 + dT) {
+        if (net.time() > tmax) {
+            return -1.0;
+        }
+        net.step();
+    }
+    return net.time();
+}
+
+TEST(RCCEReactor, ignition)
+{
+    std::string X = "H2:0.3, O2:0.15, H2O:0.05, AR:0.5, H:1e-3, O:1e-4, "
+                    "OH:1e-3, HO2:1e-5, H2O2:1e-6";
+    IdealGasMix gas("h2o2.cti");
+    gas.setState_TPX(1100, OneAtm, X);
+    compositionMap moles;
+    for (size_t k = 0; k < gas.nSpecies(); k++) {
+        moles[gas.speciesName(k)] = 1.0;
+    }
+    RCCEReactor rcce;
+    rcce.insert(gas);
+    rcce.addConstraint("moles", moles);
+    rcce.addConstraint("radicals", {{"H", 1.0}, {"O", 2.0}, {"OH", 1.0}});
+    rcce.addConstraint("HO2", {{"HO2", 1.0}, {"H2O2", 1.0}});
+    rcce.addConstraint("H atoms", {{"H", 1.0}});
+    ReactorNet net;
+    net.addReactor(rcce);
+    // The potentials of the constraints other than the elements tend to zero
+    // at equilibrium, so a tighter absolute tolerance would make the
+    // integrator take very small steps after ignition
+    net.setTolerances(1e-8, 1e-10);
+    net.reinitialize();
+    EXPECT_EQ(gas.nElements() + 6, rcce.neq());
+    EXPECT_EQ(gas.nElements() + 2, rcce.componentIndex("moles"));
+    EXPECT_EQ("HO2", rcce.componentName(gas.nElements() + 4));
+
+    // The reference uses the constrained-equilibrium initial state, so that
+    // both reactors start from the same state
+    IdealGasMix ref_gas("h2o2.cti");
+    ref_gas.setState_TPY(gas.temperature(), gas.pressure(),
+                         gas.massFractions());
+    IdealGasConstPressureReactor ref;
+    ref.insert(ref_gas);
+    ReactorNet ref_net;
+    ref_net.addReactor(ref);
+    ref_net.setTolerances(1e-8, 1e-14);
+
+    double tau = ignitionDelay(net, rcce, 400, 0.1);
+    double tau_ref = ignitionDelay(ref_net, ref, 400, 0.1);
+    ASSERT_GT(tau_ref, 0.0);
+    ASSERT_GT(tau, 0.0);
+    // Both reactors use the default integrator. With these constraints, the
+    // ignition delay predicted by RCCE is 1.0% shorter than with the
+    // detailed mechanism, and this difference changes by 0.1% when the
+    // relative tolerances of both integrators are reduced to 1e-10. Without
+    // the constraint on H atoms, the difference is about 30%.
+    EXPECT_NEAR(tau_ref, tau, 0.05 * tau_ref);
+
+    // The constraint potentials relax after ignition, so that both reactors
+    // reach the same equilibrium state
+    net.advance(1e-3);
+    ref_net.advance(1e-3);
+    EXPECT_NEAR(ref.temperature(), rcce.temperature(),
+                1e-6 * ref.temperature());
+}
@@ -0,0 +1,231 @@
+#include "gtest/gtest.h"
+#include "cantera/equil/TwoPhaseFlash.h"
+#include "cantera/thermo/RedlichKwongMFTP.h"
+#include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/thermo/NasaPoly2.h"
+#include "cantera/thermo/ShomatePoly.h"
+#include "cantera/base/stringUtils.h"
+#include "../thermo/thermo_data.h"
+
+using namespace Cantera;
+
+namespace {
+
+// One of the species H2O, CO2 or H2
+shared_ptr<Species> makeSpecies(const std::string& name)
+{
+    shared_ptr<Species> sp;
+    if (name == "CO2") {
+        sp = make_shared<Species>(name, parseCompString("C:1 O:2"));
+        sp->thermo.reset(new ShomatePoly2(200, 3500, 101325,
+                                          co2_shomate_coeffs));
+    } else if (name == "H2O") {
+        sp = make_shared<Species>(name, parseCompString("H:2 O:1"));
+        sp->thermo.reset(new NasaPoly2(200, 3500, 101325, h2o_nasa_coeffs));
+    } else {
+        sp = make_shared<Species>(name, parseCompString("H:2"));
+        sp->thermo.reset(new NasaPoly2(200, 3500, 101325, h2_nasa_coeffs));
+    }
+    return sp;
+}
+
+// Redlich-Kwong phase with the species in `names`
+void setupRK(RedlichKwongMFTP& p, const std::vector<std::string>& names)
+{
+    double fa = toSI("bar-cm6/mol2");
+    double fb = toSI("cm3/mol");
+    p.addUndefinedElements();
+    for (const auto& name : names) {
+        p.addSpecies(makeSpecies(name));
+        if (name == "H2O") {
+            p.setSpeciesCoeffs("H2O", 1.7458e8 * fa, -8e4 * fa, 18.18 * fb);
+        } else if (name == "CO2") {
+            p.setSpeciesCoeffs("CO2", 7.54e7 * fa, -4.13e4 * fa, 27.80 * fb);
+        } else {
+            // From the critical properties of H2
+            p.setSpeciesCoeffs("H2", 1.44e6 * fa, 0.0, 18.4 * fb);
+        }
+    }
+    p.initThermo();
+}
+
+}
+
+class TwoPhaseFlashTest : public testing::Test
+{
+public:
+    void checkEquilibrium(TwoPhaseFlash& flash, ThermoPhase& vap,
+                          ThermoPhase& liq, const vector_fp& z) {
+        size_t nc = flash.nComponents();
+        vector_fp x(nc), y(nc), muV(nc), muL(liq.nSpecies());
+        flash.getLiquidMoleFractions(x.data());
+        flash.getVaporMoleFractions(y.data());
+        double beta = flash.vaporFraction();
+        vap.getChemPotentials(muV.data());
+        liq.getChemPotentials(muL.data());
+        double RT = GasConstant * vap.temperature();
+        for (size_t k = 0; k < nc; k++) {
+            EXPECT_NEAR(z[k], beta * y[k] + (1 - beta) * x[k], 1e-10);
+            EXPECT_NEAR(y[k], vap.moleFraction(k), 1e-12);
+            size_t kl = liq.speciesIndex(vap.speciesName(k));
+            if (kl != npos) {
+                EXPECT_NEAR(x[k], liq.moleFraction(kl), 1e-12);
+                EXPECT_NEAR(muV[k] / RT, muL[kl] / RT, 1e-8);
+            } else {
+                EXPECT_DOUBLE_EQ(0.0, x[k]);
+            }
+        }
+    }
+};
+
+TEST_F(TwoPhaseFlashTest, rachford_rice)
+{
+    double z[] = {0.5, 0.3, 0.2};
+    double K[] = {2.0, 0.5, 0.1};
+    double beta = TwoPhaseFlash::solveRachfordRice(3, z, K);
+    double f = 0.0;
+    for (size_t k = 0; k < 3; k++) {
+        f += z[k] * (K[k] - 1) / (1 + beta * (K[k] - 1));
+    }
+    EXPECT_NEAR(0.0, f, 1e-14);
+    EXPECT_GT(beta, 0.0);
+    EXPECT_LT(beta, 1.0);
+
+    // Non-condensable first component
+    K[0] = std::numeric_limits<double>::infinity();
+    beta = TwoPhaseFlash::solveRachfordRice(3, z, K);
+    f = z[0] / beta;
+    for (size_t k = 1; k < 3; k++) {
+        f += z[k] * (K[k] - 1) / (1 + beta * (K[k] - 1));
+    }
+    EXPECT_NEAR(0.0, f, 1e-12);
+
+    // Negative flash and single-phase limits
+    double K2[] = {1.1, 0.5, 0.5};
+    EXPECT_LT(TwoPhaseFlash::solveRachfordRice(3, z, K2), 0.0);
+    double K3[] = {1.5, 1.2, 1.0};
+    EXPECT_EQ(std::numeric_limits<double>::infinity(),
+              TwoPhaseFlash::solveRachfordRice(3, z, K3));
+}
+
+TEST_F(TwoPhaseFlashTest, cubic_eos)
+{
+    RedlichKwongMFTP vap, liq;
+    setupRK(vap, {"H2O", "CO2", "H2"});
+    setupRK(liq, {"H2O", "CO2", "H2"});
+    TwoPhaseFlash flash(vap, liq);
+    vector_fp z{0.5, 0.2, 0.3};
+
+    int coldIters = flash.flash(320, 20 * OneAtm, z.data());
+    ASSERT_EQ(2, flash.nPhases());
+    checkEquilibrium(flash, vap, liq, z);
+    // Water-rich liquid
+    EXPECT_GT(liq.moleFraction(0), 0.9);
+    EXPECT_GT(liq.density(), 5 * vap.density());
+
+    // Warm start at a nearby state
+    int warmIters = flash.flash(322, 20 * OneAtm, z.data());
+    checkEquilibrium(flash, vap, liq, z);
+    EXPECT_LT(warmIters, coldIters);
+
+    // Superheated vapor
+    flash.flash(800, 10 * OneAtm, z.data());
+    EXPECT_EQ(1, flash.nPhases());
+    EXPECT_DOUBLE_EQ(1.0, flash.vaporFraction());
+    EXPECT_NEAR(z[1], vap.moleFraction(1), 1e-14);
+}
+
+TEST_F(TwoPhaseFlashTest, noncondensable_batch)
+{
+    IdealGasPhase vap;
+    vap.addUndefinedElements();
+    vap.addSpecies(makeSpecies("H2"));
+    vap.addSpecies(makeSpecies("H2O"));
+    vap.addSpecies(makeSpecies("CO2"));
+    vap.initThermo();
+    RedlichKwongMFTP liq;
+    setupRK(liq, {"H2O", "CO2"});
+    TwoPhaseFlash flash(vap, liq);
+    EXPECT_EQ((size_t) 3, flash.nComponents());
+
+    size_t n = 4;
+    vector_fp T{300, 310, 320, 330}, P(n, 20 * OneAtm), z;
+    for (size_t i = 0; i < n; i++) {
+        z.push_back(0.3);
+        z.push_back(0.6 - 0.05 * i);
+        z.push_back(0.1 + 0.05 * i);
+    }
+    vector_fp beta(n), x(3*n), y(3*n), lnK(3*n);
+    flash.flash(n, T.data(), P.data(), z.data(), beta.data(), x.data(),
+                y.data());
+    flash.getLogKValues(lnK.data());
+    EXPECT_EQ(std::numeric_limits<double>::infinity(), lnK[0]);
+
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_GT(beta[i], 0.0);
+        EXPECT_LT(beta[i], 1.0);
+        EXPECT_DOUBLE_EQ(0.0, x[3*i]);
+        flash.resetKValues();
+        vector_fp zi(&z[3*i], &z[3*i] + 3);
+        flash.flash(T[i], P[i], zi.data());
+        checkEquilibrium(flash, vap, liq, zi);
+        EXPECT_NEAR(beta[i], flash.vaporFraction(), 1e-9);
+    }
+}
+
+TEST_F(TwoPhaseFlashTest, absent_noncondensable)
+{
+    IdealGasPhase vap;
+    vap.addUndefinedElements();
+    vap.addSpecies(makeSpecies("H2"));
+    vap.addSpecies(makeSpecies("H2O"));
+    vap.initThermo();
+    RedlichKwongMFTP liq;
+    setupRK(liq, {"H2O"});
+    TwoPhaseFlash flash(vap, liq);
+
+    // Subcooled water, with no hydrogen to form a vapor
+    vector_fp z{0.0, 1.0};
+    flash.flash(300, OneAtm, z.data());
+    EXPECT_EQ(1, flash.nPhases());
+    EXPECT_DOUBLE_EQ(0.0, flash.vaporFraction());
+    vector_fp x(2), y(2);
+    flash.getLiquidMoleFractions(x.data());
+    flash.getVaporMoleFractions(y.data());
+    EXPECT_DOUBLE_EQ(0.0, y[0]);
+    EXPECT_DOUBLE_EQ(1.0, y[1]);
+    EXPECT_DOUBLE_EQ(0.0, x[0]);
+    EXPECT_DOUBLE_EQ(1.0, x[1]);
+}
+
+TEST_F(TwoPhaseFlashTest, ideal_solution)
+{
+    IdealGasPhase vap;
+    vap.addUndefinedElements();
+    vap.addSpecies(makeSpecies("H2"));
+    vap.addSpecies(makeSpecies("H2O"));
+    vap.addSpecies(makeSpecies("CO2"));
+    vap.initThermo();
+    std::unique_ptr<ThermoPhase> liq(newPhase("raoult-liquid.xml", "liquid"));
+    TwoPhaseFlash flash(vap, *liq);
+
+    vector_fp z{0.2, 0.5, 0.3};
+    double T = 300.0;
+    flash.flash(T, OneAtm, z.data());
+    ASSERT_EQ(2, flash.nPhases());
+    checkEquilibrium(flash, vap, *liq, z);
+
+    // Raoult's law, y_k P = x_k P_sat,k, with the saturation pressure given
+    // by the standard Gibbs energies of the liquid and the vapor at the
+    // common reference pressure
+    vector_fp x(3), y(3), gV(3), gL(2);
+    flash.getLiquidMoleFractions(x.data());
+    flash.getVaporMoleFractions(y.data());
+    vap.getGibbs_RT_ref(gV.data());
+    liq->getGibbs_RT_ref(gL.data());
+    for (size_t k = 1; k < 3; k++) {
+        double Psat = OneAtm * exp(gL[k-1] - gV[k]);
+        EXPECT_NEAR(y[k] * OneAtm, x[k] * Psat, 1e-8 * y[k] * OneAtm);
+    }
+}
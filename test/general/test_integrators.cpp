@@ -0,0 +1,238 @@
+#include "gtest/gtest.h"
+#include "cantera/numerics/FuncEval.h"
+#include "cantera/numerics/RosenbrockIntegrator.h"
+#include "cantera/numerics/ExtrapolationIntegrator.h"
+#include "cantera/numerics/CVodesIntegrator.h"
+
+#include <functional>
+
+using namespace Cantera;
+
+// Prothero-Robinson problem y' = lambda*(y - sin(t)) + cos(t), with the
+// solution y = sin(t)
+class ProtheroRobinson : public FuncEval
+{
+public:
+    ProtheroRobinson(double lambda) : m_lambda(lambda) {}
+
+    virtual void eval(double t, double* y, double* ydot, double* p) {
+        ydot[0] = m_lambda * (y[0] - sin(t)) + cos(t);
+    }
+    virtual void getState(double* y) {
+        y[0] = 0.0;
+    }
+    virtual size_t neq() {
+        return 1;
+    }
+
+protected:
+    double m_lambda;
+};
+
+// Robertson's chemical kinetics problem, with an analytical Jacobian
+class Robertson : public FuncEval
+{
+public:
+    virtual void eval(double t, double* y, double* ydot, double* p) {
+        ydot[0] = -0.04 * y[0] + 1e4 * y[1] * y[2];
+        ydot[2] = 3e7 * y[1] * y[1];
+        ydot[1] = -ydot[0] - ydot[2];
+    }
+    virtual bool evalJacobian(double t, double* y, double* ydot, double* p,
+                              Array2D* j) {
+        eval(t, y, ydot, p);
+        Array2D& J = *j;
+        J(0,0) = -0.04;
+        J(0,1) = 1e4 * y[2];
+        J(0,2) = 1e4 * y[1];
+        J(2,0) = 0.0;
+        J(2,1) = 6e7 * y[1];
+        J(2,2) = 0.0;
+        for (size_t k = 0; k < 3; k++) {
+            J(1,k) = -J(0,k) - J(2,k);
+        }
+        return true;
+    }
+    virtual void getState(double* y) {
+        y[0] = 1.0;
+        y[1] = y[2] = 0.0;
+    }
+    virtual size_t neq() {
+        return 3;
+    }
+};
+
+// Robertson's problem without the analytical Jacobian
+class RobertsonFD : public Robertson
+{
+public:
+    virtual bool evalJacobian(double t, double* y, double* ydot, double* p,
+                              Array2D* j) {
+        return false;
+    }
+};
+
+// Robertson's problem, starting from a state that can be changed between
+// integrations
+class RobertsonRestart : public RobertsonFD
+{
+public:
+    RobertsonRestart() : y0{1.0, 0.0, 0.0} {}
+    virtual void getState(double* y) {
+        std::copy(y0, y0 + 3, y);
+    }
+    double y0[3];
+};
+
+// Sequence of short integrations, each starting from the end state of the
+// previous one, as in operator-split coupling. `change` is called before each
+// restart. Returns the number of Jacobians computed in the short
+// integrations, and stores the number of Jacobian requests in `nRequests`.
+int restartJacBuilds(CVodesIntegrator& integ, RobertsonRestart& f,
+                     double* yEnd, int& nRequests,
+                     std::function<void()> change=[]{})
+{
+    f.y0[0] = 1.0;
+    f.y0[1] = f.y0[2] = 0.0;
+    integ.setTolerances(1e-8, 1e-14);
+    integ.initialize(0.0, f);
+    integ.integrate(1.0);
+    int nBuilds = 0;
+    nRequests = 0;
+    double t = 1.0;
+    for (int i = 0; i < 20; i++) {
+        std::copy(integ.solution(), integ.solution() + 3, f.y0);
+        change();
+        integ.reinitialize(t, f);
+        t += 0.01;
+        integ.integrate(t);
+        nBuilds += integ.nJacBuilds();
+        nRequests += integ.nJacEvals();
+    }
+    std::copy(integ.solution(), integ.solution() + 3, yEnd);
+    return nBuilds;
+}
+
+template <class T>
+class LinearlyImplicitTest : public testing::Test
+{
+public:
+    T integ;
+};
+
+typedef testing::Types<RosenbrockIntegrator, ExtrapolationIntegrator>
+    IntegratorTypes;
+TYPED_TEST_CASE(LinearlyImplicitTest, IntegratorTypes);
+
+TYPED_TEST(LinearlyImplicitTest, prothero_robinson)
+{
+    ProtheroRobinson f(-1e5);
+    this->integ.setTolerances(1e-8, 1e-12);
+    this->integ.initialize(0.0, f);
+    for (int i = 1; i <= 10; i++) {
+        this->integ.integrate(0.5 * i);
+        EXPECT_NEAR(sin(0.5 * i), this->integ.solution(0), 1e-7);
+    }
+    EXPECT_LT(this->integ.nSteps(), 1000);
+}
+
+TYPED_TEST(LinearlyImplicitTest, robertson)
+{
+    Robertson f;
+    RobertsonFD fd;
+    // Reference solution at t = 40 (Hairer and Wanner)
+    double yref[] = {0.7158270687, 9.185534764e-6, 0.2841637457};
+    this->integ.setTolerances(1e-8, 1e-14);
+    for (FuncEval* func : std::vector<FuncEval*>{&f, &fd}) {
+        this->integ.initialize(0.0, *func);
+        this->integ.integrate(40.0);
+        for (size_t k = 0; k < 3; k++) {
+            EXPECT_NEAR(yref[k], this->integ.solution(k), 1e-7 * yref[k]);
+        }
+        EXPECT_EQ(this->integ.nSteps(), this->integ.nJacEvals());
+    }
+}
+
+TEST(RosenbrockIntegrator, order)
+{
+    // Non-stiff problem, with fixed steps
+    ProtheroRobinson f(-2.0);
+    RosenbrockIntegrator integ;
+    vector_fp err;
+    for (double h : {0.1, 0.05, 0.025}) {
+        integ.setFixedStepSize(h);
+        integ.initialize(0.0, f);
+        integ.integrate(2.0);
+        err.push_back(std::abs(integ.solution(0) - sin(2.0)));
+    }
+    EXPECT_NEAR(4.0, log2(err[0] / err[1]), 0.3);
+    EXPECT_NEAR(4.0, log2(err[1] / err[2]), 0.3);
+}
+
+TEST(ExtrapolationIntegrator, order_selection)
+{
+    Robertson f;
+    ExtrapolationIntegrator integ;
+    integ.setTolerances(1e-4, 1e-10);
+    integ.initialize(0.0, f);
+    integ.integrate(40.0);
+    int lowOrder = integ.lastOrder();
+    integ.setTolerances(1e-11, 1e-17);
+    integ.initialize(0.0, f);
+    integ.integrate(40.0);
+    EXPECT_GT(integ.lastOrder(), lowOrder);
+    EXPECT_THROW(integ.setMaxOrder(2), CanteraError);
+}
+
+TEST(CVodesIntegrator, warm_restart)
+{
+    RobertsonRestart f;
+    CVodesIntegrator cold, warm;
+    warm.setWarmRestart(true);
+    double yCold[3], yWarm[3];
+    int coldRequests, warmRequests;
+    int coldBuilds = restartJacBuilds(cold, f, yCold, coldRequests);
+    int warmBuilds = restartJacBuilds(warm, f, yWarm, warmRequests);
+
+    // Each cold restart computes a new Jacobian, while warm restarts answer
+    // the first request after each restart with the saved Jacobian
+    EXPECT_EQ(coldRequests, coldBuilds);
+    EXPECT_GE(coldBuilds, 20);
+    EXPECT_GE(warmRequests, 20);
+    EXPECT_LE(warmBuilds, warmRequests - 20);
+    EXPECT_LT(warmBuilds, coldBuilds);
+    for (size_t k = 0; k < 3; k++) {
+        EXPECT_NEAR(yCold[k], yWarm[k], 1e-6 * yCold[k] + 1e-14);
+    }
+
+    // With the banded linear solver, the Jacobian is evaluated by CVODES and
+    // only the step size is kept
+    CVodesIntegrator band;
+    band.setProblemType(BAND + NOJAC);
+    band.setBandwidth(2, 2);
+    band.setWarmRestart(true);
+    double yBand[3];
+    int bandRequests;
+    EXPECT_GE(restartJacBuilds(band, f, yBand, bandRequests), 20);
+    for (size_t k = 0; k < 3; k++) {
+        EXPECT_NEAR(yCold[k], yBand[k], 1e-6 * yCold[k] + 1e-14);
+    }
+}
+
+TEST(CVodesIntegrator, warm_restart_invalidation)
+{
+    // A new Jacobian is computed after every restart if the sensitivity
+    // parameters change or the Jacobian is invalidated explicitly
+    RobertsonRestart f;
+    CVodesIntegrator warm;
+    warm.setWarmRestart(true);
+    double y[3];
+    int nRequests;
+    EXPECT_GE(restartJacBuilds(warm, f, y, nRequests,
+                               [&]{ warm.invalidateJacobian(); }), 20);
+
+    f.m_sens_params.push_back(1.0);
+    f.m_paramScales.push_back(1.0);
+    EXPECT_GE(restartJacBuilds(warm, f, y, nRequests,
+                               [&]{ f.m_sens_params[0] *= 1.1; }), 20);
+}
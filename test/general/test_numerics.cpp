@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include "cantera/numerics/polyfit.h"
+#include "cantera/numerics/DualNumber.h"
 
 using namespace Cantera;
 
@@ -91,3 +92,43 @@ TEST(Polyfit, weighted)
         }
     }
 }
+
+template <class S>
+S dualTestFunction(const S& x, const S& y)
+{
+    using std::exp;
+    using std::log;
+    using std::pow;
+    using std::max;
+    return x * exp(y) / (1.0 + x) - pow(x, 1.5) + pow(2.0, y) * log(x)
+        + max(0.0, y - x) + max(x, y);
+}
+
+TEST(Dual, derivatives)
+{
+    double x0 = 0.7, y0 = 1.3;
+    Dual<2> x(x0), y(y0);
+    x.setDerivative(0, 1.0);
+    y.setDerivative(1, 1.0);
+    Dual<2> f = dualTestFunction(x, y);
+    EXPECT_DOUBLE_EQ(f.value(), dualTestFunction(x0, y0));
+
+    double dfdx = exp(y0) / pow(1 + x0, 2) - 1.5 * sqrt(x0)
+        + pow(2.0, y0) / x0 - 1.0;
+    double dfdy = x0 * exp(y0) / (1 + x0) + log(2.0) * pow(2.0, y0) * log(x0)
+        + 1.0 + 1.0;
+    EXPECT_NEAR(f.derivative(0), dfdx, 1e-13);
+    EXPECT_NEAR(f.derivative(1), dfdy, 1e-13);
+
+    // Branches are differentiated on the side which is taken
+    EXPECT_TRUE(x < y);
+    EXPECT_FALSE(x > 1.0);
+    Dual<2> g = max(x, 1.0) * min(y, 2.0);
+    EXPECT_DOUBLE_EQ(g.derivative(0), 0.0);
+    EXPECT_DOUBLE_EQ(g.derivative(1), 1.0);
+
+    // Assigning a value clears the derivatives
+    x = 2.0;
+    EXPECT_DOUBLE_EQ((x * y).derivative(0), 0.0);
+    EXPECT_DOUBLE_EQ((x * y).derivative(1), 2.0);
+}
@@ -0,0 +1,73 @@
+#include "gtest/gtest.h"
+#include "cantera/base/Tracer.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+using namespace Cantera;
+
+namespace
+{
+
+size_t countOccurrences(const std::string& text, const std::string& s)
+{
+    size_t n = 0;
+    for (size_t pos = text.find(s); pos != npos; pos = text.find(s, pos + 1)) {
+        n++;
+    }
+    return n;
+}
+
+void nestedSpans(int n)
+{
+    for (int i = 0; i < n; i++) {
+        TraceSpan outer("outer", "test");
+        TraceSpan inner("inner", "test");
+    }
+}
+
+}
+
+TEST(Tracer, disabled)
+{
+    stopTracing();
+    clearTrace();
+    nestedSpans(5);
+    EXPECT_EQ(traceEventCount(), (size_t) 0);
+}
+
+TEST(Tracer, threads)
+{
+    clearTrace();
+    startTracing();
+    nestedSpans(3);
+    std::thread worker([]() {
+        setTraceThreadName("worker");
+        nestedSpans(2);
+    });
+    worker.join();
+    stopTracing();
+    nestedSpans(1);
+    EXPECT_EQ(traceEventCount(), (size_t) 10);
+
+    writeTrace("trace-threads.json");
+    std::stringstream buffer;
+    {
+        std::ifstream in("trace-threads.json");
+        buffer << in.rdbuf();
+    }
+    std::remove("trace-threads.json");
+    std::string trace = buffer.str();
+    EXPECT_EQ(countOccurrences(trace, "\"name\": \"outer\""), (size_t) 5);
+    EXPECT_EQ(countOccurrences(trace, "\"name\": \"inner\""), (size_t) 5);
+    EXPECT_EQ(countOccurrences(trace, "\"ph\": \"X\""), (size_t) 10);
+    EXPECT_EQ(countOccurrences(trace, "{\"name\": \"worker\"}"), (size_t) 1);
+    EXPECT_EQ(trace.find("\"traceEvents\": ["), (size_t) 1);
+
+    clearTrace();
+    EXPECT_EQ(traceEventCount(), (size_t) 0);
+    EXPECT_THROW(writeTrace("no-such-directory/trace.json"), CanteraError);
+}
@@ -0,0 +1,215 @@
+#include "gtest/gtest.h"
+#include "cantera/zeroD/ChemistryServer.h"
+#include "cantera/clib/ctserver.h"
+#include "cantera/IdealGasMix.h"
+#include "cantera/transport/TransportFactory.h"
+#include "cantera/transport/TransportBase.h"
+#include "cantera/zeroD/IdealGasConstPressureReactor.h"
+#include "cantera/zeroD/ReactorNet.h"
+
+#include <chrono>
+#include <csignal>
+#include <thread>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace Cantera;
+
+class ChemistryServerTest : public testing::Test
+{
+public:
+    ChemistryServerTest() : gas("h2o2.xml", "ohmech") {
+        trans.reset(newTransportMgr("Mix", &gas));
+        name = fmt::format("/cantera-test-{}", getpid());
+        nsp = gas.nSpecies();
+        size_t np = 7;
+        gas.setState_TPX(300, OneAtm, "H2:2, O2:1, AR:4");
+        vector_fp Y0(nsp), Y1(nsp);
+        gas.getMassFractions(Y0.data());
+        gas.equilibrate("HP");
+        gas.getMassFractions(Y1.data());
+        for (size_t i = 0; i < np; i++) {
+            double w = i / (np - 1.0);
+            T.push_back(800 + 200 * i);
+            P.push_back(OneAtm * (1 + i));
+            for (size_t k = 0; k < nsp; k++) {
+                Y.push_back((1 - w) * Y0[k] + w * Y1[k]);
+            }
+        }
+    }
+
+    IdealGasMix gas;
+    std::unique_ptr<Transport> trans;
+    std::string name;
+    size_t nsp;
+    vector_fp T, P, Y;
+};
+
+TEST_F(ChemistryServerTest, threaded_client)
+{
+    // Use a small batch size so that requests are split by the client
+    ChemistryServer server(name, gas, gas, trans.get(), 2, 3);
+    size_t np = T.size();
+    vector_fp wdot(np * nsp), props(np * (nServerProperties + nsp));
+    {
+        ChemistryClient client(name);
+        EXPECT_EQ(client.nSpecies(), nsp);
+        EXPECT_EQ(client.maxPoints(), (size_t) 3);
+        EXPECT_EQ(client.speciesIndex("OH"), gas.speciesIndex("OH"));
+        std::thread worker([&]() { server.serve(); });
+        client.getNetProductionRates(np, T.data(), P.data(), Y.data(),
+                                     wdot.data());
+        client.getProperties(np, T.data(), P.data(), Y.data(), props.data());
+        client.shutdownServer();
+        worker.join();
+    }
+
+    vector_fp wdot_ref(nsp), D(nsp);
+    for (size_t i = 0; i < np; i++) {
+        gas.setState_TPY(T[i], P[i], &Y[i*nsp]);
+        gas.getNetProductionRates(wdot_ref.data());
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_DOUBLE_EQ(wdot_ref[k], wdot[i*nsp + k]);
+        }
+        const double* p = &props[i*(nServerProperties + nsp)];
+        EXPECT_DOUBLE_EQ(gas.density(), p[0]);
+        EXPECT_DOUBLE_EQ(gas.cp_mass(), p[1]);
+        EXPECT_DOUBLE_EQ(gas.enthalpy_mass(), p[2]);
+        EXPECT_DOUBLE_EQ(trans->viscosity(), p[3]);
+        EXPECT_DOUBLE_EQ(trans->thermalConductivity(), p[4]);
+        trans->getMixDiffCoeffs(D.data());
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_DOUBLE_EQ(D[k], p[nServerProperties + k]);
+        }
+    }
+}
+
+TEST_F(ChemistryServerTest, errors)
+{
+    ChemistryServer server(name, gas, gas, nullptr, 1, 4);
+    EXPECT_THROW(ChemistryServer(name, gas, gas, nullptr), CanteraError);
+    ChemistryClient client(name);
+    // Only one slot is available
+    EXPECT_THROW(ChemistryClient second(name), CanteraError);
+    std::thread worker([&]() { server.serve(); });
+    vector_fp props(nServerProperties + nsp);
+    // The server has no transport manager
+    EXPECT_THROW(client.getProperties(1, T.data(), P.data(), Y.data(),
+                                      props.data()), CanteraError);
+    server.stop();
+    worker.join();
+    client.setTimeout(0.01);
+    EXPECT_THROW(client.getProperties(1, T.data(), P.data(), Y.data(),
+                                      props.data()), CanteraError);
+}
+
+TEST_F(ChemistryServerTest, reactors)
+{
+    ChemistryServer server(name, gas, gas, nullptr, 1, 2);
+    server.setTolerances(1e-10, 1e-18);
+    size_t np = 3;
+    double dt = 2e-4;
+    vector_fp T1(T.begin() + 2, T.begin() + 2 + np);
+    vector_fp P1(P.begin() + 2, P.begin() + 2 + np);
+    vector_fp Y1(Y.begin() + 2*nsp, Y.begin() + (2 + np)*nsp);
+    vector_fp T0 = T1, Y0 = Y1;
+    {
+        ChemistryClient client(name);
+        std::thread worker([&]() { server.serve(); });
+        client.advanceReactors(np, dt, T1.data(), P1.data(), Y1.data());
+        client.shutdownServer();
+        worker.join();
+    }
+
+    IdealGasMix ref("h2o2.xml", "ohmech");
+    for (size_t i = 0; i < np; i++) {
+        ref.setState_TPY(T0[i], P1[i], &Y0[i*nsp]);
+        IdealGasConstPressureReactor reactor;
+        reactor.insert(ref);
+        ReactorNet net;
+        net.addReactor(reactor);
+        net.setTolerances(1e-10, 1e-18);
+        net.advance(dt);
+        EXPECT_NEAR(ref.temperature(), T1[i], 1e-6 * T1[i]);
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(ref.massFraction(k), Y1[i*nsp + k], 1e-8);
+        }
+    }
+}
+
+TEST_F(ChemistryServerTest, abandoned_request)
+{
+    ChemistryServer server(name, gas, gas, nullptr, 1, 4);
+    vector_fp wdot(nsp);
+    {
+        ChemistryClient client(name);
+        client.setTimeout(0.01);
+        // The server is not running
+        EXPECT_THROW(client.getNetProductionRates(1, T.data(), P.data(),
+                                                  Y.data(), wdot.data()),
+                     CanteraError);
+        EXPECT_THROW(client.getNetProductionRates(1, T.data(), P.data(),
+                                                  Y.data(), wdot.data()),
+                     CanteraError);
+    }
+    // The slot is only released once the server has seen the request
+    EXPECT_THROW(ChemistryClient waiting(name), CanteraError);
+    server.poll();
+    ChemistryClient client(name);
+    std::thread worker([&]() { server.serve(); });
+    client.getNetProductionRates(1, T.data(), P.data(), Y.data(), wdot.data());
+    client.shutdownServer();
+    worker.join();
+}
+
+TEST_F(ChemistryServerTest, clib_client_process)
+{
+    ChemistryServer server(name, gas, gas, trans.get());
+    size_t np = T.size();
+    vector_fp wdot_ref(np * nsp);
+    for (size_t i = 0; i < np; i++) {
+        gas.setState_TPY(T[i], P[i], &Y[i*nsp]);
+        gas.getNetProductionRates(&wdot_ref[i*nsp]);
+    }
+
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        // Client process, which reports the result through its exit status
+        int status = 0;
+        int c = chemclient_new(name.c_str());
+        char buf[20];
+        if (c < 0 || chemclient_nSpecies(c) != nsp
+            || chemclient_getSpeciesName(c, 2, 20, buf) < 0
+            || gas.speciesName(2) != buf) {
+            _exit(2);
+        }
+        vector_fp wdot(np * nsp);
+        if (chemclient_getNetProductionRates(c, np, T.data(), P.data(),
+                                             Y.data(), wdot.data()) < 0) {
+            status = 3;
+        } else if (wdot != wdot_ref) {
+            status = 4;
+        }
+        chemclient_shutdownServer(c);
+        chemclient_del(c);
+        _exit(status);
+    }
+
+    // Serve until the client exits, which it should do well before the
+    // deadline
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+    int status = -1;
+    while (waitpid(pid, &status, WNOHANG) == 0) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            kill(pid, SIGKILL);
+            waitpid(pid, &status, 0);
+            FAIL() << "Client process did not exit";
+        }
+        if (!server.poll()) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(0, WEXITSTATUS(status));
+}
@@ -0,0 +1,95 @@
+#include "gtest/gtest.h"
+#include "cantera/kinetics/importKinetics.h"
+#include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/thermo/SurfPhase.h"
+#include "cantera/kinetics/InterfaceKinetics.h"
+
+using namespace Cantera;
+
+class CoverageDerivativesTest : public testing::Test
+{
+public:
+    CoverageDerivativesTest()
+        : gas("../data/sofc-test.xml", "gas")
+        , surf("../data/sofc-test.xml", "metal_surface")
+    {
+        std::vector<ThermoPhase*> th = { &surf, &gas };
+        importKinetics(surf.xml(), th, &kin);
+        gas.setState_TPX(1200, 5*OneAtm, "H2:0.2 O2:0.5 H2O:0.1 N2:0.2");
+        surf.setState_TP(1200, 5*OneAtm);
+        surf.setCoveragesByName("H(m):0.1 O(m):0.2 OH(m):0.3 (m):0.4");
+    }
+
+    IdealGasPhase gas;
+    SurfPhase surf;
+    InterfaceKinetics kin;
+};
+
+TEST_F(CoverageDerivativesTest, finite_difference)
+{
+    ASSERT_TRUE(kin.coverageDerivativesAvailable());
+    size_t nt = kin.nTotalSpecies();
+    size_t ns = surf.nSpecies();
+    vector_fp dwdot(nt * ns), wdot0(nt), wdot1(nt), theta(ns);
+    kin.getNetProductionRatesCoverageDerivatives(dwdot.data());
+    surf.getCoverages(theta.data());
+    double scale = 0.0;
+    for (double d : dwdot) {
+        scale = std::max(scale, std::abs(d));
+    }
+
+    // Compare to central differences
+    for (size_t n = 0; n < ns; n++) {
+        double dtheta = 1e-6;
+        theta[n] += dtheta;
+        surf.setCoveragesNoNorm(theta.data());
+        kin.getNetProductionRates(wdot1.data());
+        theta[n] -= 2 * dtheta;
+        surf.setCoveragesNoNorm(theta.data());
+        kin.getNetProductionRates(wdot0.data());
+        theta[n] += dtheta;
+        surf.setCoveragesNoNorm(theta.data());
+        for (size_t k = 0; k < nt; k++) {
+            double fd = (wdot1[k] - wdot0[k]) / (2 * dtheta);
+            EXPECT_NEAR(fd, dwdot[n*nt + k], 1e-6 * std::abs(fd) + 1e-8 * scale)
+                << kin.kineticsSpeciesName(k) << " / " << surf.speciesName(n);
+        }
+    }
+}
+
+TEST_F(CoverageDerivativesTest, cached_rate_constants)
+{
+    size_t nr = kin.nReactions();
+    vector_fp kf0(nr), kr0(nr), kf(nr), kr(nr);
+    kin.getFwdRateConstants(kf0.data());
+    kin.getRevRateConstants(kr0.data());
+
+    // Rate constants do not depend on the gas composition
+    gas.setState_TPX(1200, 5*OneAtm, "H2:0.6 O2:0.1 H2O:0.1 N2:0.2");
+    kin.getFwdRateConstants(kf.data());
+    kin.getRevRateConstants(kr.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_DOUBLE_EQ(kf0[i], kf[i]);
+        EXPECT_DOUBLE_EQ(kr0[i], kr[i]);
+    }
+
+    // Changing the gas pressure changes the equilibrium constants of
+    // reactions with a change in the number of gas molecules
+    gas.setState_TP(1200, 2*OneAtm);
+    kin.getRevRateConstants(kr.data());
+    IdealGasPhase gas2("../data/sofc-test.xml", "gas");
+    SurfPhase surf2("../data/sofc-test.xml", "metal_surface");
+    std::vector<ThermoPhase*> th = { &surf2, &gas2 };
+    InterfaceKinetics kin2;
+    importKinetics(surf2.xml(), th, &kin2);
+    gas2.setState_TPX(1200, 2*OneAtm, "H2:0.6 O2:0.1 H2O:0.1 N2:0.2");
+    surf2.setState_TP(1200, 5*OneAtm);
+    vector_fp kr2(nr);
+    kin2.getRevRateConstants(kr2.data());
+    bool changed = false;
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_NEAR(kr2[i], kr[i], 1e-12 * std::abs(kr2[i]));
+        changed |= (kr[i] != kr0[i]);
+    }
+    EXPECT_TRUE(changed);
+}
@@ -304,6 +304,71 @@ TEST_F(KineticsFromScratch, invalid_nonreactant_order)
     ASSERT_EQ((size_t) 0, kin.nReactions());
 }
 
+TEST_F(KineticsFromScratch, add_reactions)
+{
+    std::vector<shared_ptr<Reaction>> reactions;
+    for (size_t i = 0; i < kin_ref.nReactions(); i++) {
+        reactions.push_back(kin_ref.reaction(i));
+    }
+    ASSERT_EQ(kin_ref.nReactions(), kin.addReactions(reactions));
+    ASSERT_EQ(kin_ref.nReactions(), kin.nReactions());
+
+    std::string X = "O:0.02 H2:0.2 O2:0.5 H:0.03 OH:0.05 H2O:0.1 HO2:0.01";
+    p.setState_TPX(1200, 5*OneAtm, X);
+    p_ref.setState_TPX(1200, 5*OneAtm, X);
+    vector_fp wdot(p.nSpecies()), wdot_ref(p.nSpecies());
+    kin.getNetProductionRates(wdot.data());
+    kin_ref.getNetProductionRates(wdot_ref.data());
+    for (size_t k = 0; k < p.nSpecies(); k++) {
+        EXPECT_DOUBLE_EQ(wdot_ref[k], wdot[k]);
+    }
+    for (size_t i = 0; i < kin.nReactions(); i++) {
+        EXPECT_EQ(kin_ref.isReversible(i), kin.isReversible(i));
+    }
+}
+
+TEST_F(KineticsFromScratch, add_reactions_invalid)
+{
+    Arrhenius rate(3.87e1, 2.7, 6260.0 / GasConst_cal_mol_K);
+    auto R1 = make_shared<ElementaryReaction>(parseCompString("O:1 H2:1"),
+        parseCompString("H:1 OH:1"), rate);
+    auto R2 = make_shared<ElementaryReaction>(parseCompString("O:1 H2:1"),
+        parseCompString("H:1 OH:1"), Arrhenius(-3.87e1, 2.7, 0.0));
+
+    // An invalid reaction leaves the mechanism unmodified
+    ASSERT_THROW(kin.addReactions({R1, R2}), CanteraError);
+    ASSERT_EQ((size_t) 0, kin.nReactions());
+    EXPECT_EQ((size_t) 0, kin.addReactions({}));
+    ASSERT_EQ((size_t) 0, kin.nReactions());
+}
+
+TEST_F(KineticsFromScratch, add_reactions_undeclared)
+{
+    Arrhenius rate(3.87e1, 2.7, 6260.0 / GasConst_cal_mol_K);
+    auto R1 = make_shared<ElementaryReaction>(parseCompString("O:1 H2:1"),
+        parseCompString("H:1 OH:1"), rate);
+    auto R2 = make_shared<ElementaryReaction>(parseCompString("CO:1 OH:1"),
+        parseCompString("CO2:1 H:1"), rate);
+
+    // Errors found while adding a reaction are not rolled back
+    ASSERT_THROW(kin.addReactions({R1, R2}), CanteraError);
+    ASSERT_EQ((size_t) 1, kin.nReactions());
+}
+
+TEST_F(KineticsFromScratch, add_reactions_skip_undeclared)
+{
+    Arrhenius rate(3.87e1, 2.7, 6260.0 / GasConst_cal_mol_K);
+    auto R1 = make_shared<ElementaryReaction>(parseCompString("O:1 H2:1"),
+        parseCompString("H:1 OH:1"), rate);
+    auto R2 = make_shared<ElementaryReaction>(parseCompString("CO:1 OH:1"),
+        parseCompString("CO2:1 H:1"), rate);
+
+    kin.skipUndeclaredSpecies(true);
+    EXPECT_EQ((size_t) 2, kin.addReactions({R1, R2, R1}));
+    ASSERT_EQ((size_t) 2, kin.nReactions());
+    EXPECT_TRUE(kin.isReversible(1));
+}
+
 class InterfaceKineticsFromScratch : public testing::Test
 {
 public:
@@ -165,6 +165,31 @@ TEST_F(PdepTest, PlogIntermediatePressure3)
     EXPECT_NEAR(1.007440e+07, ropf[3], 1e+3);
 }
 
+TEST_F(PdepTest, PlogConstantPressure)
+{
+    // At a fixed pressure, the rate is evaluated using an equivalent Arrhenius
+    // expression, which needs to be updated when the pressure changes
+    vector_fp kf(6);
+    for (double P : {5.0 * OneAtm, 50.0 * OneAtm}) {
+        for (double T : {500.0, 1000.0, 1500.0}) {
+            set_TP(T, P);
+            kin_->getFwdRateConstants(&kf[0]);
+            double k1, k2, P1;
+            if (P < 10 * OneAtm) {
+                k1 = k(4.910800e+28, -4.8507, 24772.8);
+                k2 = k(1.286600e+44, -9.0246, 39796.5);
+                P1 = OneAtm;
+            } else {
+                k1 = k(1.286600e+44, -9.0246, 39796.5);
+                k2 = k(5.963200e+53, -11.529, 52599.6);
+                P1 = 10 * OneAtm;
+            }
+            double kf0 = k1 * pow(k2 / k1, log10(P / P1));
+            EXPECT_NEAR(kf0, kf[0], 1e-9 * kf0);
+        }
+    }
+}
+
 TEST_F(PdepTest, ChebyshevIntermediate1)
 {
     // Test Chebyshev rates in the normal interpolation region
@@ -0,0 +1,194 @@
+#include "gtest/gtest.h"
+#include "cantera/kinetics/importKinetics.h"
+#include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/zeroD/IdealGasConstPressureReactor.h"
+#include "cantera/zeroD/ReactorNet.h"
+
+using namespace Cantera;
+
+class QSSATest : public testing::Test
+{
+public:
+    QSSATest()
+        : p("h2o2.cti")
+        , p_ref("h2o2.cti")
+    {
+        std::vector<ThermoPhase*> th{&p};
+        importKinetics(p.xml(), th, &kin);
+        std::vector<ThermoPhase*> th_ref{&p_ref};
+        importKinetics(p_ref.xml(), th_ref, &kin_ref);
+        X = "H2:0.25, O2:0.12, H2O:0.08, H:0.002, O:0.001, OH:0.003, "
+            "HO2:1e-4, H2O2:1e-5, AR:0.5";
+        p.setState_TPX(1400, OneAtm, X);
+    }
+
+    IdealGasPhase p;
+    IdealGasPhase p_ref;
+    GasKinetics kin;
+    GasKinetics kin_ref;
+    std::string X;
+};
+
+TEST_F(QSSATest, set_species)
+{
+    kin.setQSSSpecies({"HO2", "H2O2"});
+    std::vector<std::string> names = kin.qssSpecies();
+    ASSERT_EQ((size_t) 2, names.size());
+    EXPECT_EQ("HO2", names[0]);
+    EXPECT_EQ("H2O2", names[1]);
+    EXPECT_THROW(kin.setQSSSpecies({"CH4"}), CanteraError);
+}
+
+TEST_F(QSSATest, reject_species_without_destruction)
+{
+    // Argon is not consumed by any reaction
+    EXPECT_THROW(kin.setQSSSpecies({"HO2", "AR"}), CanteraError);
+    EXPECT_EQ((size_t) 0, kin.qssSpecies().size());
+    p.setState_TPX(1400, OneAtm, "H2:0.25, O2:0.12, AR:1e-12");
+    kin.selectQSSSpecies(1.0);
+    for (const auto& name : kin.qssSpecies()) {
+        EXPECT_NE("AR", name);
+    }
+}
+
+TEST_F(QSSATest, zero_net_production)
+{
+    kin.setQSSSpecies({"HO2", "H2O2"});
+    vector_fp wdot(p.nSpecies()), cdot(p.nSpecies());
+    kin.getNetProductionRates(wdot.data());
+    kin.getCreationRates(cdot.data());
+    for (const auto& name : kin.qssSpecies()) {
+        size_t k = p.speciesIndex(name);
+        EXPECT_NEAR(0.0, wdot[k], 1e-8 * cdot[k]);
+        EXPECT_GT(cdot[k], 0.0);
+    }
+}
+
+TEST_F(QSSATest, phase_unchanged)
+{
+    std::vector<std::string> qss{"HO2", "H2O2"};
+    kin.setQSSSpecies(qss);
+    size_t kk = p.nSpecies();
+    double P = p.pressure();
+    vector_fp y0(kk), y1(kk), wdot(kk), cq(qss.size());
+    p.getMassFractions(y0.data());
+    kin.getNetProductionRates(wdot.data());
+    kin.getQSSConcentrations(cq.data());
+
+    // Evaluating the rates leaves the phase alone
+    p.getMassFractions(y1.data());
+    EXPECT_DOUBLE_EQ(P, p.pressure());
+    for (size_t k = 0; k < kk; k++) {
+        EXPECT_DOUBLE_EQ(y0[k], y1[k]) << p.speciesName(k);
+    }
+    for (size_t q = 0; q < qss.size(); q++) {
+        size_t k = p.speciesIndex(qss[q]);
+        EXPECT_TRUE(kin.isQSSSpecies(k));
+        EXPECT_GT(cq[q], 0.0);
+        EXPECT_NE(cq[q], p.concentration(k));
+    }
+    EXPECT_FALSE(kin.isQSSSpecies(p.speciesIndex("OH")));
+    EXPECT_FALSE(kin.isQSSSpecies(npos));
+}
+
+TEST_F(QSSATest, apply_to_phase)
+{
+    std::vector<std::string> qss{"HO2", "H2O2"};
+    kin.setQSSSpecies(qss);
+    size_t kk = p.nSpecies();
+    double rho = p.density();
+    double T = p.temperature();
+    vector_fp y0(kk), y1(kk), cq(qss.size());
+    p.getMassFractions(y0.data());
+    kin.getQSSConcentrations(cq.data());
+    kin.applyQSSConcentrations();
+
+    // The phase holds the QSS concentrations; everything else is unchanged
+    p.getMassFractions(y1.data());
+    EXPECT_DOUBLE_EQ(rho, p.density());
+    EXPECT_DOUBLE_EQ(T, p.temperature());
+    for (size_t k = 0; k < kk; k++) {
+        if (!kin.isQSSSpecies(k)) {
+            EXPECT_DOUBLE_EQ(y0[k], y1[k]) << p.speciesName(k);
+        }
+    }
+    for (size_t q = 0; q < qss.size(); q++) {
+        size_t k = p.speciesIndex(qss[q]);
+        EXPECT_NEAR(cq[q], p.concentration(k), 1e-12 * cq[q]);
+    }
+}
+
+TEST_F(QSSATest, reactor_contents)
+{
+    std::vector<std::string> qss{"HO2", "H2O2"};
+    kin.setQSSSpecies(qss);
+    vector_fp y0(p.nSpecies());
+    p.getMassFractions(y0.data());
+    IdealGasConstPressureReactor r;
+    r.setThermoMgr(p);
+    r.setKineticsMgr(kin);
+    ReactorNet net;
+    net.addReactor(r);
+    net.advance(1e-5);
+
+    // After each step, the contents of the reactor hold the QSS values at
+    // the current state, rather than the initial mass fractions. Evaluating
+    // them again from the contents differs slightly, since the third-body
+    // concentrations now include the QSS values.
+    ThermoPhase& contents = r.contents();
+    vector_fp cq(qss.size());
+    kin.getQSSConcentrations(cq.data());
+    for (size_t q = 0; q < qss.size(); q++) {
+        size_t k = contents.speciesIndex(qss[q]);
+        double yq = cq[q] * contents.molecularWeight(k) / contents.density();
+        EXPECT_NEAR(yq, r.massFraction(k), 1e-3 * yq) << qss[q];
+        EXPECT_GT(std::abs(r.massFraction(k) / y0[k] - 1.0), 0.1) << qss[q];
+    }
+    net.step();
+    kin.getQSSConcentrations(cq.data());
+    size_t k = contents.speciesIndex("HO2");
+    EXPECT_NEAR(cq[0] * contents.molecularWeight(k) / contents.density(),
+                r.massFraction(k), 1e-3 * r.massFraction(k));
+}
+
+TEST_F(QSSATest, consistent_with_full_mechanism)
+{
+    std::vector<std::string> qss{"O", "HO2", "H2O2"};
+    kin.setQSSSpecies(qss);
+    vector_fp cq(qss.size());
+    kin.getQSSConcentrations(cq.data());
+
+    // Evaluating the full mechanism with the QSS concentrations substituted
+    // should give the same rates for all species. The QSS concentrations are
+    // also set in the phase, so that the third-body concentrations match.
+    size_t kk = p.nSpecies();
+    vector_fp conc(kk);
+    for (int n = 0; n < 3; n++) {
+        p.getConcentrations(conc.data());
+        for (size_t q = 0; q < qss.size(); q++) {
+            EXPECT_GT(cq[q], 0.0);
+            conc[p.speciesIndex(qss[q])] = cq[q];
+        }
+        p.setConcentrations(conc.data());
+        kin.getQSSConcentrations(cq.data());
+    }
+    p_ref.setState_TP(p.temperature(), p.pressure());
+    p_ref.setConcentrations(conc.data());
+
+    vector_fp wdot(kk), wdot_ref(kk);
+    kin.getNetProductionRates(wdot.data());
+    kin_ref.getNetProductionRates(wdot_ref.data());
+    for (size_t k = 0; k < kk; k++) {
+        double scale = std::max(std::abs(wdot_ref[k]), 1e-3);
+        EXPECT_NEAR(wdot_ref[k], wdot[k], 1e-5 * scale) << p.speciesName(k);
+    }
+}
+
+TEST_F(QSSATest, select_species)
+{
+    size_t n = kin.selectQSSSpecies(1e-6);
+    EXPECT_GT(n, (size_t) 0);
+    EXPECT_EQ(n, kin.qssSpecies().size());
+    EXPECT_EQ((size_t) 0, kin.selectQSSSpecies(0.0));
+}
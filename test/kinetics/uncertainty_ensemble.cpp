@@ -0,0 +1,262 @@
+#include "gtest/gtest.h"
+#include "cantera/kinetics/UncertaintyEnsemble.h"
+#include "cantera/zeroD/IgnitionDelayModel.h"
+#include "cantera/IdealGasMix.h"
+
+#include <algorithm>
+#include <atomic>
+
+using namespace Cantera;
+
+namespace {
+
+// Model whose outputs are the logarithms of the forward rate constants of the
+// first two reactions. Samples where the second rate constant is increased by
+// more than a factor of two fail, and samples where the first rate constant
+// is decreased by more than a factor of two are censored.
+class RateConstantModel : public EnsembleModel
+{
+public:
+    RateConstantModel() : gas("h2o2.xml", "ohmech") {
+        gas.setState_TPX(1200, OneAtm, "H2:2, O2:1, AR:4");
+    }
+
+    virtual Kinetics& kinetics() {
+        return gas;
+    }
+
+    virtual size_t nOutputs() const {
+        return 2;
+    }
+
+    virtual void solveNominal(double* outputs) {
+        nominalSolves++;
+        kf0.resize(gas.nReactions());
+        gas.getFwdRateConstants(kf0.data());
+        solve(outputs);
+    }
+
+    virtual bool copyNominal(const EnsembleModel& other) {
+        kf0 = dynamic_cast<const RateConstantModel&>(other).kf0;
+        return true;
+    }
+
+    virtual void solve(double* outputs) {
+        vector_fp kf(gas.nReactions());
+        gas.getFwdRateConstants(kf.data());
+        if (kf[1] > 2 * kf0[1]) {
+            throw CanteraError("RateConstantModel::solve", "too fast");
+        } else if (kf[0] < 0.5 * kf0[0]) {
+            throw CensoredSampleError("RateConstantModel::solve", "too slow");
+        }
+        outputs[0] = std::log(kf[0]);
+        outputs[1] = std::log(kf[1]);
+    }
+
+    IdealGasMix gas;
+    vector_fp kf0;
+    static std::atomic<int> nominalSolves;
+};
+
+std::atomic<int> RateConstantModel::nominalSolves(0);
+
+}
+
+TEST(EnsembleStatistics, streaming_and_merge)
+{
+    const size_t n = 50;
+    vector_fp y(2*n), p(n);
+    for (size_t i = 0; i < n; i++) {
+        p[i] = std::sin(1.0 + i);
+        y[2*i] = 3 * p[i] + std::cos(2.0 * i);
+        y[2*i+1] = -1.0 + 0.1 * i;
+    }
+    EnsembleStatistics all(2, 1), a(2, 1), b(2, 1);
+    for (size_t i = 0; i < n; i++) {
+        all.add(&y[2*i], &p[i]);
+        if (i < 20) {
+            a.add(&y[2*i], &p[i]);
+        } else {
+            b.add(&y[2*i], &p[i]);
+        }
+    }
+    a.merge(b);
+
+    // Two-pass reference values
+    double ym = 0, pm = 0;
+    for (size_t i = 0; i < n; i++) {
+        ym += y[2*i] / n;
+        pm += p[i] / n;
+    }
+    double vy = 0, vp = 0, c = 0;
+    for (size_t i = 0; i < n; i++) {
+        vy += (y[2*i] - ym) * (y[2*i] - ym) / (n - 1);
+        vp += (p[i] - pm) * (p[i] - pm) / (n - 1);
+        c += (y[2*i] - ym) * (p[i] - pm) / (n - 1);
+    }
+    for (const EnsembleStatistics* s : {&all, &a}) {
+        EXPECT_EQ(n, s->count());
+        EXPECT_NEAR(ym, s->mean(0), 1e-12);
+        EXPECT_NEAR(vy, s->variance(0), 1e-12);
+        EXPECT_NEAR(c, s->covariance(0, 0), 1e-12);
+        EXPECT_NEAR(c / std::sqrt(vy * vp), s->correlation(0, 0), 1e-12);
+        EXPECT_DOUBLE_EQ(-1.0, s->min(1));
+        EXPECT_DOUBLE_EQ(-1.0 + 0.1 * (n - 1), s->max(1));
+    }
+}
+
+TEST(UncertaintyEnsemble, threads)
+{
+    RateConstantModel ref;
+    size_t nr = ref.gas.nReactions();
+    UncertaintyEnsemble ens(nr);
+    ens.setUncertaintyFactor(0, 3.0);
+    ens.setUncertaintyFactor(1, 2.0);
+    ens.setSeed(42);
+
+    auto factory = []() {
+        return std::unique_ptr<EnsembleModel>(new RateConstantModel());
+    };
+    size_t nSamples = 200;
+    ens.run(nSamples, factory);
+    EnsembleStatistics serial = ens.statistics();
+    std::vector<size_t> failed = ens.failedSamples();
+    std::vector<size_t> censored = ens.censoredSamples();
+    EXPECT_GT(failed.size(), (size_t) 0);
+    EXPECT_GT(censored.size(), (size_t) 0);
+    EXPECT_EQ(nSamples, serial.count() + failed.size() + censored.size());
+
+    // The nominal case is solved once, and shared by all threads
+    RateConstantModel::nominalSolves = 0;
+    ens.setThreads(4);
+    ens.run(nSamples, factory);
+    EXPECT_EQ(1, RateConstantModel::nominalSolves);
+    const EnsembleStatistics& parallel = ens.statistics();
+    EXPECT_EQ(failed, ens.failedSamples());
+    EXPECT_EQ(censored, ens.censoredSamples());
+    ASSERT_EQ(serial.count(), parallel.count());
+    for (size_t i = 0; i < 2; i++) {
+        EXPECT_NEAR(serial.mean(i), parallel.mean(i), 1e-10);
+        EXPECT_NEAR(serial.variance(i), parallel.variance(i), 1e-10);
+        EXPECT_DOUBLE_EQ(serial.min(i), parallel.min(i));
+    }
+
+    // Each output is the log of a rate constant, which depends only on the
+    // multiplier of that reaction
+    EXPECT_NEAR(1.0, parallel.correlation(0, 0), 1e-10);
+    EXPECT_NEAR(1.0, parallel.correlation(1, 1), 1e-10);
+    EXPECT_NEAR(0.0, parallel.covariance(0, 2), 1e-14);
+
+    // The nominal outputs are evaluated with unit multipliers
+    vector_fp kf0(nr);
+    ref.gas.getFwdRateConstants(kf0.data());
+    EXPECT_DOUBLE_EQ(std::log(kf0[0]), ens.nominalOutputs()[0]);
+}
+
+TEST(UncertaintyEnsemble, batched_rate_constants)
+{
+    RateConstantModel ref;
+    size_t nr = ref.gas.nReactions();
+    UncertaintyEnsemble ens(nr);
+    ens.setUncertaintyFactors(vector_fp(nr, 2.0));
+    ens.setSeed(7);
+
+    // Batched rate constants match those obtained with the multipliers, and
+    // do not depend on the multipliers set by the caller
+    size_t nb = 5;
+    vector_fp kf(nb * nr), kfs(nr), lnm(nr);
+    ref.gas.setMultiplier(0, 10.0);
+    ens.getFwdRateConstants(ref.gas, 10, nb, kf.data());
+    EXPECT_DOUBLE_EQ(10.0, ref.gas.multiplier(0));
+    for (size_t s = 0; s < nb; s++) {
+        ens.getLogMultipliers(10 + s, lnm.data());
+        for (size_t i = 0; i < nr; i++) {
+            ref.gas.setMultiplier(i, std::exp(lnm[i]));
+        }
+        ref.gas.getFwdRateConstants(kfs.data());
+        for (size_t i = 0; i < nr; i++) {
+            EXPECT_NEAR(kfs[i], kf[s*nr + i], 1e-12 * kfs[i]);
+        }
+    }
+
+    UncertaintyEnsemble wrong(nr + 1);
+    EXPECT_THROW(wrong.getFwdRateConstants(ref.gas, 0, 1, kf.data()),
+                 CanteraError);
+}
+
+TEST(UncertaintyEnsemble, ignition_delay_censoring)
+{
+    auto factory = []() {
+        return std::unique_ptr<EnsembleModel>(new IgnitionDelayModel(
+            "h2o2.xml", "ohmech", 1000.0, OneAtm, "H2:2, O2:1, AR:4"));
+    };
+    auto ref = factory();
+    IdealGasMix& gas = dynamic_cast<IdealGasMix&>(ref->kinetics());
+    UncertaintyEnsemble ens(gas.nReactions());
+    for (size_t i = 0; i < gas.nReactions(); i++) {
+        if (gas.reactionString(i) == "H + O2 <=> O + OH") {
+            ens.setUncertaintyFactor(i, 10.0);
+        }
+    }
+    EXPECT_THROW(dynamic_cast<IgnitionDelayModel&>(*ref).setHorizon(0.5),
+                 CanteraError);
+
+    // Samples where the chain branching reaction is slowed down enough do not
+    // ignite within the horizon, and are censored rather than failed
+    size_t nSamples = 20;
+    ens.setThreads(2);
+    ens.run(nSamples, [&]() {
+        auto model = factory();
+        dynamic_cast<IgnitionDelayModel&>(*model).setHorizon(1.5);
+        return model;
+    });
+    double tau0 = ens.nominalOutputs()[0];
+    const EnsembleStatistics& stats = ens.statistics();
+    EXPECT_GT(tau0, 0.0);
+    EXPECT_EQ(ens.failedSamples().size(), (size_t) 0);
+    EXPECT_GT(ens.censoredSamples().size(), (size_t) 0);
+    EXPECT_EQ(nSamples, stats.count() + ens.censoredSamples().size());
+    EXPECT_LT(stats.max(0), 1.5 * tau0);
+    EXPECT_LT(stats.min(0), tau0);
+}
+
+TEST(UncertaintyEnsemble, ignition_delay_cold_start)
+{
+    auto factory = []() {
+        return std::unique_ptr<EnsembleModel>(new IgnitionDelayModel(
+            "h2o2.xml", "ohmech", 1000.0, OneAtm, "H2:2, O2:1, AR:4"));
+    };
+    size_t nr = factory()->kinetics().nReactions();
+    UncertaintyEnsemble ens(nr);
+    ens.setUncertaintyFactors(vector_fp(nr, 2.0));
+    size_t nSamples = 8;
+    ens.setThreads(2);
+    ens.run(nSamples, factory);
+    const EnsembleStatistics& stats = ens.statistics();
+    std::vector<size_t> censored = ens.censoredSamples();
+    ASSERT_EQ(ens.failedSamples().size(), (size_t) 0);
+    ASSERT_EQ(nSamples, stats.count() + censored.size());
+
+    // Each sample gives the same ignition delay as an integration started
+    // from scratch with the multipliers of that sample
+    vector_fp lnm(nr);
+    double mean = 0.0, tmin = BigNumber, tmax = 0.0;
+    for (size_t s = 0; s < nSamples; s++) {
+        if (std::count(censored.begin(), censored.end(), s)) {
+            continue;
+        }
+        auto model = factory();
+        ens.getLogMultipliers(s, lnm.data());
+        for (size_t i = 0; i < nr; i++) {
+            model->kinetics().setMultiplier(i, std::exp(lnm[i]));
+        }
+        double tau;
+        model->solveNominal(&tau);
+        mean += tau / stats.count();
+        tmin = std::min(tmin, tau);
+        tmax = std::max(tmax, tau);
+    }
+    EXPECT_NEAR(mean, stats.mean(0), 1e-6 * mean);
+    EXPECT_NEAR(tmin, stats.min(0), 1e-6 * tmin);
+    EXPECT_NEAR(tmax, stats.max(0), 1e-6 * tmax);
+}
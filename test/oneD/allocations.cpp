@@ -0,0 +1,45 @@
+#include "gtest/gtest.h"
+#include "cantera/base/AllocationCounter.h"
+#include "counterflow.h"
+
+using namespace Cantera;
+
+// These tests are only compiled if Cantera is built with 'track_allocations'
+
+TEST(AllocationCounter, phases)
+{
+    ASSERT_TRUE(allocationTrackingEnabled());
+    resetAllocationCounts();
+    {
+        AllocationPhase refine(SolverPhase::Refine);
+        std::unique_ptr<vector_fp> v(new vector_fp(10));
+        {
+            AllocationPhase newton(SolverPhase::Newton);
+            v->resize(20);
+        }
+        v->resize(30);
+    }
+    EXPECT_EQ(allocationCount(SolverPhase::Refine), (size_t) 3);
+    EXPECT_EQ(allocationCount(SolverPhase::Newton), (size_t) 1);
+    resetAllocationCounts();
+    EXPECT_EQ(allocationCount(SolverPhase::Refine), (size_t) 0);
+}
+
+TEST(AllocationCounter, counterflow_time_step)
+{
+    ASSERT_TRUE(allocationTrackingEnabled());
+    Counterflow flame;
+    Sim1D& sim = *flame.sim;
+    sim.solve(0, false);
+
+    vector_fp x(sim.solutionVector()), r(sim.size());
+    sim.timeStep(2, 1e-5, x.data(), r.data(), 0);
+
+    // Once the workspaces are sized for the grid, time stepping makes no
+    // heap allocations
+    resetAllocationCounts();
+    sim.timeStep(2, 1e-5, x.data(), r.data(), 0);
+    EXPECT_EQ(allocationCount(SolverPhase::TimeStep), (size_t) 0);
+    EXPECT_EQ(allocationCount(SolverPhase::Newton), (size_t) 0);
+    EXPECT_EQ(allocationCount(SolverPhase::Residual), (size_t) 0);
+}
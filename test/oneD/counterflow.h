@@ -0,0 +1,59 @@
+#ifndef CT_TEST_COUNTERFLOW_H
+#define CT_TEST_COUNTERFLOW_H
+
+#include "cantera/oneD/Sim1D.h"
+#include "cantera/oneD/Inlet1D.h"
+#include "cantera/oneD/StFlow.h"
+#include "cantera/IdealGasMix.h"
+#include "cantera/transport.h"
+
+namespace Cantera
+{
+
+//! Non-reacting counterflow of hydrogen and air on a coarse grid, with the
+//! initial guess set up and ready to be solved
+class Counterflow
+{
+public:
+    Counterflow()
+        : gas("h2o2.xml", "ohmech")
+        , flow(&gas)
+    {
+        double T_in = 300.0;
+        double mdot = 0.2;
+        gas.setState_TPX(T_in, OneAtm, "H2:1.0");
+        double rho_f = gas.density();
+        gas.setState_TPX(T_in, OneAtm, "O2:0.21, AR:0.79");
+        double rho_o = gas.density();
+
+        vector_fp z{0.0, 0.004, 0.008, 0.012, 0.016, 0.02};
+        flow.setupGrid(z.size(), z.data());
+        tr.reset(newTransportMgr("Mix", &gas));
+        flow.setTransport(*tr);
+        flow.setKinetics(gas);
+        flow.setPressure(OneAtm);
+
+        fuel.setMoleFractions("H2:1.0");
+        fuel.setMdot(mdot);
+        fuel.setTemperature(T_in);
+        oxidizer.setMoleFractions("O2:0.21, AR:0.79");
+        oxidizer.setMdot(mdot);
+        oxidizer.setTemperature(T_in);
+
+        std::vector<Domain1D*> domains { &fuel, &flow, &oxidizer };
+        sim.reset(new Sim1D(domains));
+        vector_fp locs{0.0, 1.0};
+        vector_fp value{mdot/rho_f, -mdot/rho_o};
+        sim->setInitialGuess("u", locs, value);
+    }
+
+    IdealGasMix gas;
+    AxiStagnFlow flow;
+    std::unique_ptr<Transport> tr;
+    Inlet1D fuel, oxidizer;
+    std::unique_ptr<Sim1D> sim;
+};
+
+}
+
+#endif
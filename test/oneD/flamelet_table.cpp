@@ -0,0 +1,159 @@
+#include "gtest/gtest.h"
+#include "cantera/oneD/FlameletTable.h"
+#include "cantera/oneD/StFlow.h"
+#include "cantera/IdealGasMix.h"
+#include <cstdio>
+#include <fstream>
+
+using namespace Cantera;
+
+class FlameletTableTest : public testing::Test
+{
+public:
+    FlameletTableTest()
+        : gas("h2o2.xml", "ohmech")
+        , flow(&gas)
+        , kH2(gas.speciesIndex("H2"))
+        , kO2(gas.speciesIndex("O2"))
+        , kAR(gas.speciesIndex("AR"))
+    {
+        vector_fp z{0.0, 0.01, 0.02, 0.03, 0.04, 0.05};
+        flow.setupGrid(z.size(), z.data());
+        flow.setKinetics(gas);
+        flow.setPressure(OneAtm);
+    }
+
+    virtual void TearDown() {
+        std::remove("flamelet-table.bin");
+        std::remove("flamelet-table-bad.bin");
+    }
+
+    //! A mixing layer between pure hydrogen at z = 0 and air at the end of
+    //! the domain, with the temperature peak scaled by *Tpeak*
+    vector_fp mixingLayer(double Tpeak) {
+        size_t nc = flow.nComponents();
+        size_t np = flow.nPoints();
+        vector_fp x(nc * np, 0.0);
+        for (size_t j = 0; j < np; j++) {
+            double Z = 1.0 - double(j) / (np - 1);
+            x[j*nc + c_offset_T] = 300 + Tpeak * Z * (1 - Z);
+            x[j*nc + c_offset_Y + kH2] = Z;
+            x[j*nc + c_offset_Y + kO2] = 0.23 * (1 - Z);
+            x[j*nc + c_offset_Y + kAR] = 0.77 * (1 - Z);
+        }
+        return x;
+    }
+
+    IdealGasMix gas;
+    AxiStagnFlow flow;
+    size_t kH2, kO2, kAR;
+};
+
+TEST_F(FlameletTableTest, build_and_interpolate)
+{
+    FlameletTableBuilder builder(gas, {"T", "H2", "rho"}, 11);
+    builder.setStreams("H2:1", "O2:0.23, AR:0.77");
+    builder.addAxis("chi", {1.0, 3.0});
+    vector_fp x1 = mixingLayer(1000);
+    vector_fp x2 = mixingLayer(2000);
+    builder.addFlamelet(flow, x1.data(), {1.0});
+    EXPECT_THROW(builder.write("flamelet-table.bin"), CanteraError);
+    builder.addFlamelet(flow, x2.data(), {3.0});
+    EXPECT_THROW(builder.addFlamelet(flow, x2.data(), {2.0}), CanteraError);
+    builder.write("flamelet-table.bin");
+
+    FlameletTable table("flamelet-table.bin");
+    ASSERT_EQ(table.nAxes(), (size_t) 2);
+    ASSERT_EQ(table.nVariables(), (size_t) 3);
+    EXPECT_EQ(table.axisName(0), "chi");
+    EXPECT_EQ(table.axisName(1), "Z");
+    EXPECT_EQ(table.variableIndex("H2"), (size_t) 1);
+    EXPECT_EQ(table.variableIndex("OH"), npos);
+    EXPECT_EQ(table.axis(1).size(), (size_t) 11);
+
+    // The mass fraction of the fuel is equal to the mixture fraction, and the
+    // temperature is piecewise linear between the grid points of the
+    // flamelets, which are at intervals of 0.2 in mixture fraction
+    vector_fp values(3);
+    for (double Z : {0.0, 0.2, 0.35, 0.5, 1.0}) {
+        for (double chi : {1.0, 2.0, 3.0}) {
+            double coords[] = {chi, Z};
+            table.interpolate(coords, values.data());
+            EXPECT_NEAR(values[1], Z, 1e-12);
+            double Tpeak = 500 * (chi + 1);
+            double Zlo = std::floor(Z * 5 + 1e-10) / 5;
+            double Zhi = std::min(Zlo + 0.2, 1.0);
+            double w = (Zhi > Zlo) ? (Z - Zlo) / (Zhi - Zlo) : 0.0;
+            double T = 300 + Tpeak * ((1 - w) * Zlo * (1 - Zlo) + w * Zhi * (1 - Zhi));
+            EXPECT_NEAR(values[0], T, 1e-8);
+            EXPECT_DOUBLE_EQ(table.value(0, coords), values[0]);
+        }
+    }
+
+    // Coordinates outside the table are clipped
+    double inside[] = {3.0, 1.0};
+    double outside[] = {5.0, 1.5};
+    EXPECT_DOUBLE_EQ(table.value(2, outside), table.value(2, inside));
+
+    // Vectorized interpolation
+    vector_fp coords{1.0, 0.3, 2.5, 0.7}, batch(6);
+    table.interpolate(2, coords.data(), batch.data());
+    for (size_t i = 0; i < 2; i++) {
+        table.interpolate(&coords[2*i], values.data());
+        for (size_t n = 0; n < 3; n++) {
+            EXPECT_DOUBLE_EQ(batch[3*i+n], values[n]);
+        }
+    }
+}
+
+TEST_F(FlameletTableTest, invalid_file)
+{
+    {
+        std::ofstream out("flamelet-table-bad.bin");
+        out << "not a table";
+    }
+    EXPECT_THROW(FlameletTable("flamelet-table-bad.bin"), CanteraError);
+    EXPECT_THROW(FlameletTable("flamelet-table-missing.bin"), CanteraError);
+
+    // A valid header of a table truncated just after the header, and one
+    // where the names lie beyond the end of the file
+    FlameletTableBuilder builder(gas, {"T"}, 3);
+    builder.setStreams("H2:1", "O2:0.23, AR:0.77");
+    builder.addAxis("chi", {1.0});
+    vector_fp x = mixingLayer(1000);
+    builder.addFlamelet(flow, x.data(), {1.0});
+    builder.write("flamelet-table.bin");
+    std::string table;
+    {
+        std::ifstream in("flamelet-table.bin", std::ios::binary);
+        table.assign(std::istreambuf_iterator<char>(in),
+                     std::istreambuf_iterator<char>());
+    }
+    // Offsets of the header fields, after the 8-byte magic string
+    const size_t namesOffset = 8 + 4 * 8;
+    const size_t dataOffset = 8 + 7 * 8;
+    const size_t fileSize = 8 + 8 * 8;
+    const size_t headerSize = 8 + 9 * 8;
+    ASSERT_GT(table.size(), headerSize);
+    auto writeBad = [](std::string contents) {
+        std::ofstream out("flamelet-table-bad.bin", std::ios::binary);
+        out << contents;
+    };
+    auto setField = [](std::string& contents, size_t offset, uint64_t value) {
+        contents.replace(offset, 8, reinterpret_cast<const char*>(&value), 8);
+    };
+
+    std::string truncated = table.substr(0, headerSize);
+    setField(truncated, fileSize, headerSize);
+    setField(truncated, dataOffset, headerSize);
+    writeBad(truncated);
+    EXPECT_THROW(FlameletTable("flamelet-table-bad.bin"), CanteraError);
+
+    std::string badNames = table;
+    setField(badNames, namesOffset, table.size() + 1000);
+    writeBad(badNames);
+    EXPECT_THROW(FlameletTable("flamelet-table-bad.bin"), CanteraError);
+
+    FlameletTable valid("flamelet-table.bin");
+    EXPECT_EQ(valid.nVariables(), (size_t) 1);
+}
@@ -0,0 +1,95 @@
+#include "gtest/gtest.h"
+#include "cantera/oneD/Sim1D.h"
+#include "cantera/oneD/Inlet1D.h"
+#include "cantera/oneD/StFlow.h"
+#include "cantera/IdealGasMix.h"
+
+using namespace Cantera;
+
+namespace
+{
+
+//! Free flame of hydrogen and air on a coarse grid, with the initial guess
+//! varying linearly from the unburned to the equilibrium composition
+class FreeFlameGuess
+{
+public:
+    FreeFlameGuess(const std::string& infile, const std::string& id)
+        : gas(infile, id)
+        , flow(&gas)
+    {
+        gas.setState_TPX(300.0, OneAtm, "H2:2.0, O2:1.0, N2:3.76");
+        vector_fp yin(gas.nSpecies());
+        gas.getMassFractions(yin.data());
+        double Tin = gas.temperature();
+        gas.equilibrate("HP");
+        vector_fp yout(gas.nSpecies());
+        gas.getMassFractions(yout.data());
+        double Tout = gas.temperature();
+
+        vector_fp z{0.0, 0.002, 0.004, 0.006, 0.008, 0.01};
+        flow.setupGrid(z.size(), z.data());
+        flow.setKinetics(gas);
+        flow.setPressure(OneAtm);
+        inlet.setMoleFractions("H2:2.0, O2:1.0, N2:3.76");
+        inlet.setTemperature(Tin);
+        inlet.setMdot(1.0);
+
+        std::vector<Domain1D*> domains { &inlet, &flow, &outlet };
+        sim.reset(new Sim1D(domains));
+        vector_fp locs{0.0, 0.3, 0.7, 1.0};
+        vector_fp value{Tin, Tin, Tout, Tout};
+        sim->setInitialGuess("T", locs, value);
+        for (size_t k = 0; k < gas.nSpecies(); k++) {
+            value = {yin[k], yin[k], yout[k], yout[k]};
+            sim->setInitialGuess(gas.speciesName(k), locs, value);
+        }
+    }
+
+    //! Set the state of the gas to the solution at point *j*
+    void setState(size_t j) {
+        vector_fp y(gas.nSpecies());
+        for (size_t k = 0; k < gas.nSpecies(); k++) {
+            y[k] = sim->value(1, flow.componentIndex(gas.speciesName(k)), j);
+        }
+        gas.setMassFractions_NoNorm(y.data());
+    }
+
+    IdealGasMix gas;
+    FreeFlame flow;
+    Inlet1D inlet;
+    Outlet1D outlet;
+    std::unique_ptr<Sim1D> sim;
+};
+
+}
+
+TEST(MapSolution, skeletal_to_detailed)
+{
+    FreeFlameGuess skeletal("h2o2-plus.xml", "ohmech");
+    FreeFlameGuess detailed("gri30.xml", "gri30");
+    detailed.sim->mapSolution(*skeletal.sim, true, 0);
+
+    ThermoPhase& gas1 = skeletal.gas;
+    ThermoPhase& gas2 = detailed.gas;
+    ASSERT_EQ(skeletal.flow.nPoints(), detailed.flow.nPoints());
+    double no_max = 0.0;
+    for (size_t j = 0; j < detailed.flow.nPoints(); j++) {
+        skeletal.setState(j);
+        detailed.setState(j);
+        double sum = 0.0;
+        for (size_t k = 0; k < gas2.nSpecies(); k++) {
+            EXPECT_GE(gas2.massFraction(k), 0.0);
+            sum += gas2.massFraction(k);
+        }
+        EXPECT_NEAR(sum, 1.0, 1e-12);
+        for (size_t m = 0; m < gas1.nElements(); m++) {
+            size_t m2 = gas2.elementIndex(gas1.elementName(m));
+            EXPECT_NEAR(gas1.elementalMassFraction(m),
+                        gas2.elementalMassFraction(m2), 1e-12);
+        }
+        no_max = std::max(no_max, gas2.massFraction("NO"));
+    }
+    // Species without a counterpart are estimated in the burned gas
+    EXPECT_GT(no_max, 1e-6);
+}
@@ -0,0 +1,49 @@
+#include "gtest/gtest.h"
+#include "counterflow.h"
+
+using namespace Cantera;
+
+TEST(StFlowQSSA, algebraic_species)
+{
+    Counterflow flame;
+    Sim1D& sim = *flame.sim;
+    IdealGasMix& gas = flame.gas;
+    gas.setState_TPX(1400, OneAtm, "H2:0.25, O2:0.12, H2O:0.08, H:0.002, "
+                     "O:0.001, OH:0.003, HO2:1e-4, H2O2:1e-5, AR:0.5");
+    vector_fp locs{0.0, 0.5, 1.0};
+    vector_fp value{300.0, 1400.0, 300.0};
+    sim.setInitialGuess("T", locs, value);
+    for (size_t k = 0; k < gas.nSpecies(); k++) {
+        value.assign(3, gas.massFraction(k));
+        sim.setInitialGuess(gas.speciesName(k), locs, value);
+    }
+    std::vector<std::string> qss{"HO2", "H2O2"};
+    gas.setQSSSpecies(qss);
+    StFlow& flow = flame.flow;
+    flow.setKinetics(gas);
+
+    vector_fp x(sim.solution(), sim.solution() + sim.size());
+    vector_fp r(sim.size());
+    vector_int mask(sim.size());
+    flow.eval(npos, x.data(), r.data(), mask.data(), 0.0);
+
+    vector_fp y(gas.nSpecies()), cq(qss.size());
+    for (size_t j = 1; j + 1 < flow.nPoints(); j++) {
+        for (size_t k = 0; k < gas.nSpecies(); k++) {
+            y[k] = sim.value(1, flow.componentIndex(gas.speciesName(k)), j);
+        }
+        gas.setMassFractions_NoNorm(y.data());
+        gas.setState_TP(sim.value(1, flow.componentIndex("T"), j), OneAtm);
+        gas.getQSSConcentrations(cq.data());
+        EXPECT_GT(cq[0], 0.0);
+        for (size_t q = 0; q < qss.size(); q++) {
+            size_t k = gas.speciesIndex(qss[q]);
+            size_t n = flow.loc() + flow.index(flow.componentIndex(qss[q]), j);
+            double yq = cq[q] * gas.molecularWeight(k) / gas.density();
+            EXPECT_NEAR(r[n], y[k] - yq, 1e-12 * std::abs(y[k]));
+            EXPECT_EQ(mask[n], 0);
+        }
+        size_t n = flow.loc() + flow.index(flow.componentIndex("OH"), j);
+        EXPECT_EQ(mask[n], 1);
+    }
+}
@@ -0,0 +1,45 @@
+#include "gtest/gtest.h"
+#include "cantera/oneD/RadiationModel.h"
+
+using namespace Cantera;
+
+namespace
+{
+
+// The fifth-order polynomials in 1000/T previously used by StFlow
+double polynomial(const double* c, double T)
+{
+    double kP = 0.0;
+    for (int n = 0; n <= 5; n++) {
+        kP += c[n] * pow(1000 / T, (double) n);
+    }
+    return kP;
+}
+
+}
+
+TEST(PlanckMeanRadiation, polynomial_fits)
+{
+    const double c_H2O[6] = {-0.23093, -1.12390, 9.41530, -2.99880,
+                             0.51382, -1.86840e-5};
+    const double c_CO2[6] = {18.741, -121.310, 273.500, -194.050,
+                             56.310, -5.8169};
+    PlanckMeanRadiation rad;
+    for (double T = 300.0; T <= 2500.0; T += 7.3) {
+        double kP_H2O = polynomial(c_H2O, T);
+        double kP_CO2 = polynomial(c_CO2, T);
+        EXPECT_NEAR(kP_H2O, rad.absorptionCoeff("H2O", T), 5e-3 * kP_H2O)
+            << "T = " << T;
+        EXPECT_NEAR(kP_CO2, rad.absorptionCoeff("CO2", T), 5e-3 * kP_CO2)
+            << "T = " << T;
+    }
+
+    // Temperatures outside of the table use the nearest end of the table
+    EXPECT_DOUBLE_EQ(rad.absorptionCoeff("H2O", 3500.0),
+                     rad.absorptionCoeff("H2O", 5000.0));
+    EXPECT_DOUBLE_EQ(rad.absorptionCoeff("CO2", 200.0),
+                     rad.absorptionCoeff("CO2", 100.0));
+    EXPECT_GT(rad.absorptionCoeff("CO", 1500.0), 0.0);
+    EXPECT_GT(rad.absorptionCoeff("CH4", 1500.0), 0.0);
+    EXPECT_EQ(rad.absorptionCoeff("N2", 1500.0), 0.0);
+}
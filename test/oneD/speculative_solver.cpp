@@ -0,0 +1,145 @@
+#include "gtest/gtest.h"
+#include "cantera/oneD/SpeculativeSolver.h"
+#include "cantera/oneD/MultiNewton.h"
+#include "counterflow.h"
+
+using namespace Cantera;
+
+namespace
+{
+
+//! Non-reacting counterflow of hydrogen and air
+class CounterflowModel : public SpeculativeModel
+{
+public:
+    virtual Sim1D& simulation() {
+        return *flame.sim;
+    }
+
+    Counterflow flame;
+};
+
+std::unique_ptr<SpeculativeModel> newCounterflow()
+{
+    return std::unique_ptr<SpeculativeModel>(new CounterflowModel());
+}
+
+}
+
+TEST(SpeculativeSolver, first_converged_wins)
+{
+    SpeculativeSolver solver;
+    SolveStrategy missing("missing restart");
+    missing.restoreFile = "no-such-solution.xml";
+    missing.restoreId = "solution";
+    solver.addStrategy(missing);
+
+    SolveStrategy damped("damped");
+    damped.timeStep = 1e-6;
+    damped.timeSteps = {2, 5, 10};
+    damped.ssJacAge = 5;
+    damped.tsJacAge = 10;
+    damped.dampFactor = 2.0;
+    damped.maxDampSteps = 10;
+    damped.refine = false;
+    solver.addStrategy(damped);
+
+    SolveStrategy plain;
+    plain.refine = false;
+    EXPECT_EQ(solver.addStrategy(plain), (size_t) 2);
+    EXPECT_EQ(solver.strategy(2).name, "strategy 2");
+
+    // With a single thread, the strategies are tried in order
+    solver.setThreads(1);
+    EXPECT_EQ(solver.solve(newCounterflow), (size_t) 1);
+    EXPECT_EQ(solver.status(0), SpeculativeSolver::Status::Failed);
+    EXPECT_NE(solver.errorMessage(0).find("no-such-solution.xml"),
+              std::string::npos);
+    EXPECT_EQ(solver.status(1), SpeculativeSolver::Status::Converged);
+    EXPECT_EQ(solver.errorMessage(1), "");
+    EXPECT_EQ(solver.status(2), SpeculativeSolver::Status::NotRun);
+    EXPECT_GT(solver.elapsedTime(1), 0.0);
+
+    CounterflowModel target;
+    solver.getSolution(target.simulation());
+    Sim1D& best = solver.model().simulation();
+    ASSERT_EQ(target.simulation().size(), best.size());
+    // Mapping renormalizes the mass fractions at each point, which only sum
+    // to one within the tolerances of the solver
+    for (size_t i = 0; i < best.size(); i++) {
+        EXPECT_NEAR(target.simulation().solution()[i], best.solution()[i],
+                    1e-8 * std::abs(best.solution()[i]) + 1e-20);
+    }
+
+    // Concurrently, either of the good strategies may win
+    solver.setThreads(0);
+    size_t winner = solver.solve(newCounterflow);
+    EXPECT_TRUE(winner == 1 || winner == 2);
+    EXPECT_EQ(solver.winner(), winner);
+    EXPECT_EQ(solver.status(winner), SpeculativeSolver::Status::Converged);
+    EXPECT_EQ(solver.status(0), SpeculativeSolver::Status::Failed);
+}
+
+TEST(SpeculativeSolver, time_limit)
+{
+    SpeculativeSolver solver;
+    SolveStrategy fine("fine grid");
+    fine.setup = [](Sim1D& sim) {
+        sim.setRefineCriteria(1, 2.0, 0.01, 0.01);
+    };
+    solver.addStrategy(fine);
+    solver.addStrategy(SolveStrategy("coarse grid"));
+    solver.setTimeLimit(1e-9);
+    EXPECT_THROW(solver.solve(newCounterflow), CanteraError);
+    EXPECT_EQ(solver.winner(), npos);
+    EXPECT_EQ(solver.status(0), SpeculativeSolver::Status::Cancelled);
+    EXPECT_EQ(solver.status(1), SpeculativeSolver::Status::Cancelled);
+    EXPECT_THROW(solver.model(), CanteraError);
+}
+
+TEST(SpeculativeSolver, partial_settings)
+{
+    // Settings which are zero keep the values set up by the model
+    CounterflowModel ref;
+    Sim1D& sim0 = ref.simulation();
+    int ssAge = sim0.steadyJacAge();
+    int tsAge = sim0.transientJacAge();
+    double factor = sim0.newton().dampFactor();
+    size_t maxSteps = sim0.newton().maxDampSteps();
+
+    SpeculativeSolver solver;
+    SolveStrategy transient("transient age only");
+    transient.tsJacAge = tsAge + 7;
+    transient.maxDampSteps = maxSteps + 3;
+    transient.refine = false;
+    transient.setup = [&](Sim1D& sim) {
+        EXPECT_EQ(sim.steadyJacAge(), ssAge);
+        EXPECT_EQ(sim.transientJacAge(), tsAge + 7);
+        EXPECT_DOUBLE_EQ(sim.newton().dampFactor(), factor);
+        EXPECT_EQ(sim.newton().maxDampSteps(), maxSteps + 3);
+    };
+    SolveStrategy steady("steady age only");
+    steady.ssJacAge = ssAge + 2;
+    steady.dampFactor = 3.0;
+    steady.refine = false;
+    steady.setup = [&](Sim1D& sim) {
+        EXPECT_EQ(sim.steadyJacAge(), ssAge + 2);
+        EXPECT_EQ(sim.transientJacAge(), tsAge);
+        EXPECT_DOUBLE_EQ(sim.newton().dampFactor(), 3.0);
+        EXPECT_EQ(sim.newton().maxDampSteps(), maxSteps);
+        // Make this strategy fail, so that both are run
+        throw CanteraError("setup", "not converged");
+    };
+    solver.addStrategy(steady);
+    solver.addStrategy(transient);
+    solver.setThreads(1);
+    EXPECT_EQ(solver.solve(newCounterflow), (size_t) 1);
+}
+
+TEST(MultiNewton, damping_options)
+{
+    MultiNewton newton(1);
+    EXPECT_THROW(newton.setDampingOptions(1.0, 7), CanteraError);
+    EXPECT_THROW(newton.setDampingOptions(2.0, 0), CanteraError);
+    newton.setDampingOptions(2.0, 10);
+}
@@ -0,0 +1,160 @@
+#include "gtest/gtest.h"
+#include "cantera/oneD/Sim1D.h"
+#include "cantera/oneD/Inlet1D.h"
+#include "cantera/oneD/StFlow.h"
+#include "cantera/oneD/MultiJac.h"
+#include "cantera/IdealGasMix.h"
+#include "cantera/transport.h"
+
+using namespace Cantera;
+
+//! Water spray injected into a counterflow of cold and hot air
+class SprayCounterflow : public testing::Test
+{
+public:
+    SprayCounterflow()
+        : gas("h2o2.xml", "ohmech")
+        , flow(&gas)
+    {
+        size_t nsp = gas.nSpecies();
+        double T_cold = 300.0;
+        double T_hot = 1200.0;
+        double mdot = 0.5;
+        std::string air = "O2:0.21, AR:0.79";
+        gas.setState_TPX(T_cold, OneAtm, air);
+        double rho_l = gas.density();
+        vector_fp y_air(nsp);
+        gas.getMassFractions(y_air.data());
+        gas.setState_TPX(T_hot, OneAtm, air);
+        double rho_r = gas.density();
+
+        vector_fp z(11);
+        for (size_t j = 0; j < z.size(); j++) {
+            z[j] = 0.02 * j / (z.size() - 1.0);
+        }
+        flow.setupGrid(z.size(), z.data());
+        tr.reset(newTransportMgr("Mix", &gas));
+        flow.setTransport(*tr);
+        flow.setKinetics(gas);
+        flow.setPressure(OneAtm);
+        flow.updateFuelSpecies("H2O");
+
+        left.setMoleFractions(air);
+        left.setMdot(mdot);
+        left.setTemperature(T_cold);
+        right.setMoleFractions(air);
+        right.setMdot(mdot);
+        right.setTemperature(T_hot);
+
+        liquid.setupGrid(z.size(), z.data());
+        flow.setLiquidDomain(&liquid);
+        liquid.setGasDomain(&flow);
+        liquid.setAVCoefficients({1e-6, 1e-6, 1e-6, 1e-6, 1e-6});
+
+        std::vector<Domain1D*> gas_domains { &left, &flow, &right };
+        std::vector<Domain1D*> liq_domains { &spray_in, &liquid, &spray_out };
+        gas_sim.reset(new Sim1D(gas_domains));
+        liq_sim.reset(new Sim1D(liq_domains));
+
+        double u_l = mdot / rho_l;
+        double diameter = 20e-6;
+        spray_in.setDropletInjectionVel(u_l);
+        spray_in.setDropletSpreadVel(0.0);
+        spray_in.setDropletTemperature(T_cold);
+        spray_in.setDropletMass(Pi / 6.0 * 1000.0 * pow(diameter, 3));
+        spray_in.setNumberDensity(1e9);
+
+        vector_fp locs{0.0, 1.0};
+        vector_fp value{u_l, -mdot / rho_r};
+        gas_sim->setInitialGuess("u", locs, value);
+        value = {T_cold, T_hot};
+        gas_sim->setInitialGuess("T", locs, value);
+        for (size_t k = 0; k < nsp; k++) {
+            value = {y_air[k], y_air[k]};
+            gas_sim->setInitialGuess(gas.speciesName(k), locs, value);
+        }
+        value = {u_l, u_l};
+        liq_sim->setInitialGuess("vl", locs, value);
+        value = {T_cold, T_cold};
+        liq_sim->setInitialGuess("Tl", locs, value);
+        value = {1.0, 1.0};
+        liq_sim->setInitialGuess("ml", locs, value);
+        liq_sim->setInitialGuess("nl", locs, value);
+    }
+
+    IdealGasMix gas;
+    SprayGas flow;
+    std::unique_ptr<Transport> tr;
+    Inlet1D left, right;
+    SprayLiquid liquid;
+    SprayInlet1D spray_in;
+    SprayOutlet1D spray_out;
+    std::unique_ptr<Sim1D> gas_sim, liq_sim;
+};
+
+TEST_F(SprayCounterflow, analytic_jacobian)
+{
+    // Develop the spray a little, so that the droplets have non-uniform
+    // properties
+    liq_sim->take_step(0, 5, 1e-5);
+
+    // Sim1D hides the OneDim overloads used here
+    OneDim& liq = *liq_sim;
+    vector_fp x(liq_sim->solutionVector()), r0(liq.size());
+    liq.eval(npos, x.data(), r0.data(), 0.0);
+    MultiJac& jac = liq.jacobian();
+
+    liquid.enableAnalyticJacobian(false);
+    jac.eval(x.data(), r0.data(), 0.0);
+    MultiJac fd = jac;
+
+    liquid.enableAnalyticJacobian(true);
+    jac.eval(x.data(), r0.data(), 0.0);
+
+    size_t nv = liquid.nComponents();
+    size_t np = liquid.nPoints();
+    for (size_t j = 2; j + 2 < np; j++) {
+        EXPECT_TRUE(liquid.evalJacobianColumns(liquid.firstPoint() + j,
+                                               x.data(), jac));
+        for (size_t n = 0; n < nv; n++) {
+            size_t col = liquid.loc() + liquid.index(n, j);
+            size_t i0 = liquid.loc() + liquid.index(0, j-1);
+            size_t i1 = liquid.loc() + liquid.index(0, j+2);
+            double scale = 0.0;
+            for (size_t i = i0; i < i1; i++) {
+                scale = std::max(scale, std::abs(jac(i, col)));
+            }
+            for (size_t i = i0; i < i1; i++) {
+                EXPECT_NEAR(fd(i, col), jac(i, col), 1e-4 * scale + 1e-10)
+                    << liquid.componentName(n) << " at point " << j
+                    << ", row " << i - liquid.loc();
+            }
+        }
+    }
+}
+
+TEST_F(SprayCounterflow, default_water_properties)
+{
+    // Antoine equation for water at its normal boiling point
+    EXPECT_NEAR(OneAtm, liquid.prs(373.15), 1e-3 * OneAtm);
+
+    // The droplets heat up and evaporate on the hot side
+    flow.solveEnergyEqn();
+    double dt_gas = 1e-5;
+    double dt_liq = 1e-5;
+    for (int iter = 0; iter < 20; iter++) {
+        dt_liq = liq_sim->take_step(0, 5, dt_liq);
+        dt_gas = gas_sim->take_step(0, 5, dt_gas);
+    }
+    double ml_min = 1.0;
+    double Tl_max = 0.0;
+    for (size_t j = 0; j < liquid.nPoints(); j++) {
+        ml_min = std::min(ml_min,
+                          liq_sim->value(1, liquid.componentIndex("ml"), j));
+        Tl_max = std::max(Tl_max,
+                          liq_sim->value(1, liquid.componentIndex("Tl"), j));
+    }
+    EXPECT_LT(ml_min, 0.5);
+    EXPECT_GT(Tl_max, 305.0);
+    EXPECT_LT(Tl_max, 373.15);
+}
@@ -0,0 +1,145 @@
+#include "gtest/gtest.h"
+#include "cantera/oneD/Sim1D.h"
+#include "cantera/oneD/Inlet1D.h"
+#include "cantera/oneD/StFlow.h"
+#include "cantera/oneD/MultiJac.h"
+#include "cantera/IdealGasMix.h"
+#include "cantera/Interface.h"
+#include "cantera/transport.h"
+
+using namespace Cantera;
+
+//! Hydrogen and oxygen impinging on a reacting metal surface
+class ReactingSurfaceTest : public testing::Test
+{
+public:
+    ReactingSurfaceTest()
+        : gas("../data/sofc-test.xml", "gas")
+        , surf("../data/sofc-test.xml", "metal_surface", {&gas})
+        , flow(&gas)
+        , T_in(1000.0)
+        , T_surf(1200.0)
+        , mdot(0.1)
+        , X("H2:0.2, O2:0.1, H2O:0.1, N2:0.6")
+    {
+        surf.setState_TP(T_surf, OneAtm);
+        vector_fp z{0.0, 0.002, 0.004, 0.006, 0.008, 0.01};
+        flow.setupGrid(z.size(), z.data());
+        tr.reset(newTransportMgr("Mix", &gas));
+        flow.setTransport(*tr);
+        flow.setKinetics(gas);
+        flow.setPressure(OneAtm);
+
+        inlet.setMoleFractions(X);
+        inlet.setMdot(mdot);
+        inlet.setTemperature(T_in);
+        surface.setKineticsMgr(&surf);
+        surface.setTemperature(T_surf);
+
+        initialize();
+    }
+
+    //! Create the simulation and set the initial guess
+    void initialize() {
+        // Start from the steady coverages for the inlet composition
+        gas.setState_TPX(T_surf, OneAtm, X);
+        surf.setCoveragesByName("H(m):0.1, O(m):0.2, OH(m):0.3, (m):0.4");
+        surf.solvePseudoSteadyStateProblem();
+        std::vector<Domain1D*> domains { &inlet, &flow, &surface };
+        sim.reset(new Sim1D(domains));
+        gas.setState_TPX(T_in, OneAtm, X);
+        vector_fp locs{0.0, 1.0};
+        vector_fp value{mdot / gas.density(), 0.0};
+        sim->setInitialGuess("u", locs, value);
+        value = {T_in, T_surf};
+        sim->setInitialGuess("T", locs, value);
+        for (size_t k = 0; k < gas.nSpecies(); k++) {
+            value.assign(2, gas.massFraction(k));
+            sim->setInitialGuess(gas.speciesName(k), locs, value);
+        }
+    }
+
+    //! Compare the Jacobian columns of the coverages computed by
+    //! ReactingSurf1D::evalJacobianColumns with finite differences
+    void checkJacobian() {
+        // Sim1D hides the OneDim overloads used here
+        OneDim& sys = *sim;
+        vector_fp x(sim->solutionVector()), r0(sys.size());
+        sys.eval(npos, x.data(), r0.data(), 0.0);
+        MultiJac& jac = sys.jacobian();
+
+        surface.enableAnalyticJacobian(false);
+        jac.eval(x.data(), r0.data(), 0.0);
+        MultiJac fd = jac;
+
+        surface.enableAnalyticJacobian(true);
+        jac.eval(x.data(), r0.data(), 0.0);
+        ASSERT_TRUE(surface.evalJacobianColumns(surface.firstPoint(),
+                                                x.data(), jac));
+
+        // Rows of the last flow point and of the surface
+        size_t i0 = flow.loc() + flow.index(0, flow.nPoints() - 1);
+        size_t i1 = surface.loc() + surface.nComponents();
+        for (size_t n = 0; n < surface.nComponents(); n++) {
+            size_t col = surface.loc() + n;
+            double scale = 0.0;
+            for (size_t i = i0; i < i1; i++) {
+                scale = std::max(scale, std::abs(fd(i, col)));
+            }
+            for (size_t i = i0; i < i1; i++) {
+                EXPECT_NEAR(fd(i, col), jac(i, col), 1e-4 * scale + 1e-10)
+                    << surface.componentName(n) << ", row " << i;
+            }
+        }
+    }
+
+    IdealGasMix gas;
+    Interface surf;
+    AxiStagnFlow flow;
+    std::unique_ptr<Transport> tr;
+    Inlet1D inlet;
+    ReactingSurf1D surface;
+    std::unique_ptr<Sim1D> sim;
+    double T_in, T_surf, mdot;
+    std::string X;
+};
+
+TEST_F(ReactingSurfaceTest, analytic_jacobian)
+{
+    ASSERT_TRUE(surf.coverageDerivativesAvailable());
+    checkJacobian();
+}
+
+TEST_F(ReactingSurfaceTest, analytic_jacobian_quasi_steady)
+{
+    surface.enableQuasiSteadyCoverages(true);
+    checkJacobian();
+}
+
+TEST_F(ReactingSurfaceTest, quasi_steady_coverages)
+{
+    // The steady solution with the coverages as coupled unknowns satisfies
+    // the pseudo-steady state conditions at the surface, so solving with
+    // quasi-steady coverages gives the same solution
+    flow.setSteadyTolerances(1e-10, 1e-16);
+    surface.setSteadyTolerances(1e-10, 1e-16);
+    sim->solve(0, false);
+    vector_fp x_coupled(sim->solutionVector());
+
+    initialize();
+    surface.enableQuasiSteadyCoverages(true);
+    sim->solve(0, false);
+    vector_fp x_qss(sim->solutionVector());
+
+    for (size_t n = 0; n < surface.nComponents(); n++) {
+        size_t i = surface.loc() + n;
+        EXPECT_NEAR(x_coupled[i], x_qss[i], 1e-6)
+            << surface.componentName(n);
+    }
+    size_t j = flow.nPoints() - 1;
+    for (size_t n = 0; n < flow.nComponents(); n++) {
+        size_t i = flow.loc() + flow.index(n, j);
+        EXPECT_NEAR(x_coupled[i], x_qss[i], 1e-6 * std::abs(x_coupled[i])
+                    + 1e-9) << flow.componentName(n);
+    }
+}
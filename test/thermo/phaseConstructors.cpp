@@ -2,6 +2,7 @@
 #include "cantera/thermo/ThermoFactory.h"
 #include "cantera/thermo/PDSSFactory.h"
 #include "cantera/thermo/PDSS_ConstVol.h"
+#include "cantera/thermo/PDSS_SSVol.h"
 #include "cantera/thermo/FixedChemPotSSTP.h"
 #include "cantera/thermo/PureFluidPhase.h"
 #include "cantera/thermo/WaterSSTP.h"
@@ -231,6 +232,83 @@ TEST_F(ConstructFromScratch, RedlichKwongMFTP)
     EXPECT_NEAR(p.enthalpy_mole(), -404848642.3797, 1e-3);
 }
 
+TEST_F(ConstructFromScratch, RedlichKwongMFTP_batchedDensities)
+{
+    RedlichKwongMFTP p;
+    p.addUndefinedElements();
+    p.addSpecies(sCO2);
+    p.addSpecies(sH2O);
+    p.addSpecies(sH2);
+    double fa = toSI("bar-cm6/mol2");
+    double fb = toSI("cm3/mol");
+    p.setSpeciesCoeffs("CO2", 7.54e7 * fa, -4.13e4 * fa, 27.80 * fb);
+    p.setSpeciesCoeffs("H2O", 1.7458e8 * fa, -8e4 * fa, 18.18 * fb);
+    p.setSpeciesCoeffs("H2", 30e7 * fa, -330e4 * fa, 31 * fb);
+    p.initThermo();
+    p.setMoleFractionsByName("CO2:0.6, H2O:0.3, H2:0.1");
+
+    vector_fp T{300, 400, 500, 700, 1000};
+    vector_fp P{OneAtm, 50 * OneAtm, 200 * OneAtm, 100 * OneAtm, 10 * OneAtm};
+    vector_fp rho(T.size());
+    p.getDensities(T.size(), T.data(), P.data(), FLUID_UNDEFINED, rho.data());
+    for (size_t i = 0; i < T.size(); i++) {
+        p.setState_TP(T[i], P[i]);
+        EXPECT_NEAR(rho[i], p.density(), 1e-10 * p.density());
+        EXPECT_NEAR(p.pressure(), P[i], 1e-8 * P[i]);
+    }
+}
+
+TEST_F(ConstructFromScratch, RedlichKwongMFTP_threeRoots)
+{
+    RedlichKwongMFTP p;
+    p.addUndefinedElements();
+    p.addSpecies(sH2O);
+    double fa = toSI("bar-cm6/mol2");
+    double fb = toSI("cm3/mol");
+    p.setSpeciesCoeffs("H2O", 1.7458e8 * fa, -8e4 * fa, 18.18 * fb);
+    p.initThermo();
+
+    // Below the saturation pressure, both the liquid and the gas are
+    // (meta)stable
+    double T = 400;
+    double P = OneAtm;
+    double a, b;
+    p.setState_TP(T, P);
+    p.calculateAB(T, a, b);
+    double V[3];
+    ASSERT_EQ(3, p.NicholsSolve(T, P, a, b, V));
+    EXPECT_LT(V[0], V[1]);
+    EXPECT_LT(V[1], V[2]);
+
+    double mw = p.meanMolecularWeight();
+    vector_fp rho(1);
+    p.getDensities(1, &T, &P, FLUID_LIQUID_0, rho.data());
+    EXPECT_NEAR(rho[0], mw / V[0], 1e-10 * rho[0]);
+    EXPECT_GT(rho[0], 500.0);
+    EXPECT_NEAR(rho[0], p.densityCalc(T, P, FLUID_LIQUID_0, 1000.0),
+                1e-10 * rho[0]);
+    p.getDensities(1, &T, &P, FLUID_GAS, rho.data());
+    EXPECT_NEAR(rho[0], mw / V[2], 1e-10 * rho[0]);
+    EXPECT_NEAR(rho[0], P * mw / (GasConstant * T), 0.05 * rho[0]);
+    EXPECT_NEAR(rho[0], p.densityCalc(T, P, FLUID_GAS, -1.0), 1e-10 * rho[0]);
+    double rho_gas = rho[0];
+    p.getDensities(1, &T, &P, FLUID_UNDEFINED, rho.data());
+    EXPECT_DOUBLE_EQ(rho_gas, rho[0]);
+
+    // Each root satisfies the equation of state
+    for (int i = 0; i < 3; i++) {
+        EXPECT_NEAR(p.pressureCalc(T, V[i]), P, 1e-6 * P);
+    }
+
+    // If only the gas root and the unstable root are physical, the unstable
+    // root is discarded
+    double V2[3] = {V[1], V[2], 0.0};
+    EXPECT_EQ(1, RedlichKwongMFTP::classifyRoots(T, P, a, b, V2, 2));
+    EXPECT_DOUBLE_EQ(V[2], V2[0]);
+    EXPECT_EQ(-2.0, RedlichKwongMFTP::selectMolarVolume(1, V2, FLUID_LIQUID_0,
+                                                        false, -1.0));
+}
+
 TEST_F(ConstructFromScratch, IdealSolnGasVPSS_gas)
 {
     IdealSolnGasVPSS p;
@@ -280,6 +358,80 @@ TEST(WaterSSTP, fromScratch)
     EXPECT_NEAR(water.enthalpy_mole() / 1e6, -285.83, 2e-2);
 }
 
+TEST(WaterSSTP, tabulated)
+{
+    WaterSSTP exact, water;
+    for (WaterSSTP* p : {&exact, &water}) {
+        p->addUndefinedElements();
+        p->addSpecies(make_species("H2O", "H:2, O:1", h2o_nasa_coeffs));
+        p->initThermo();
+    }
+    water.setTabulation(std::make_shared<WaterPropsTable>());
+    for (double T : {300.0, 400.0, 500.0}) {
+        for (double P : {1e5, 1e6, 1e7}) {
+            exact.setState_TP(T, P);
+            water.setState_TP(T, P);
+            EXPECT_NEAR(water.pressure(), P, 1e-8 * P);
+            EXPECT_NEAR(water.density(), exact.density(),
+                        1e-5 * exact.density());
+            EXPECT_NEAR(water.enthalpy_mole(), exact.enthalpy_mole(),
+                        1e-5 * GasConstant * T);
+            EXPECT_NEAR(water.cp_mole(), exact.cp_mole(),
+                        1e-4 * exact.cp_mole());
+            double g1, g2;
+            exact.getGibbs_RT_ref(&g1);
+            water.getGibbs_RT_ref(&g2);
+            EXPECT_NEAR(g1, g2, 1e-5);
+        }
+    }
+    // Outside of the table, the full equation of state is used
+    exact.setState_TP(640.0, 3e7);
+    water.setState_TP(640.0, 3e7);
+    EXPECT_NEAR(water.density(), exact.density(), 1e-10 * exact.density());
+
+    // Changing the temperature at constant density changes the pressure
+    water.setState_TP(300.0, 1e6);
+    water.setTemperature(310.0);
+    EXPECT_GT(water.pressure(), 1e6);
+}
+
+TEST(WaterSSTP, tabulated_state_consistency)
+{
+    // The state set from the table satisfies the equation of state at the
+    // requested pressure, so properties which depend on the actual state
+    // match the untabulated phase
+    WaterSSTP exact, water;
+    for (WaterSSTP* p : {&exact, &water}) {
+        p->addUndefinedElements();
+        p->addSpecies(make_species("H2O", "H:2, O:1", h2o_nasa_coeffs));
+        p->initThermo();
+    }
+    water.setTabulation(std::make_shared<WaterPropsTable>());
+    for (double T : {300.0, 373.15, 450.0, 590.0}) {
+        for (double P : {1e5, 1e6, 1e7, 5e7}) {
+            exact.setState_TP(T, P);
+            water.setState_TP(T, P);
+            double mu1, mu2;
+            exact.getStandardChemPotentials(&mu1);
+            water.getStandardChemPotentials(&mu2);
+            // States not covered by the table, and the untabulated phase,
+            // use a density iteration which converges to about 1e-8
+            EXPECT_NEAR(water.pressure(), P, 1e-8 * P);
+            EXPECT_NEAR(exact.pressure(), water.pressure(), 1e-8 * P);
+            EXPECT_NEAR(water.density(), exact.density(),
+                        1e-9 * exact.density());
+            EXPECT_NEAR(mu1, mu2, 1e-8 * GasConstant * T);
+
+            // The pressure follows the equation of state when the state is
+            // changed at constant density
+            exact.setTemperature(T + 1.0);
+            water.setTemperature(T + 1.0);
+            EXPECT_NEAR(exact.pressure(), water.pressure(),
+                        1e-8 * exact.pressure());
+        }
+    }
+}
+
 TEST(IdealMolalSoln, fromScratch)
 {
     IdealMolalSoln p;
@@ -311,4 +463,109 @@ TEST(IdealMolalSoln, fromScratch)
     EXPECT_NEAR(p.density(), 12.058, 1e-3);
 }
 
+TEST(IdealMolalSoln, batchedStandardState)
+{
+    IdealMolalSoln p;
+    p.addUndefinedElements();
+    p.addSpecies(make_species("H2O(l)", "H:2, O:1", h2o_nasa_coeffs));
+    p.addSpecies(make_species("OH(aq)", "H:1, O:1", oh_nasa_coeffs));
+    p.addSpecies(make_species("H2(aq)", "H:2", h2_nasa_coeffs));
+    p.addSpecies(make_species("O2(aq)", "O:2", o2_nasa_coeffs));
+    size_t k = 0;
+    for (double v : {0.018, 0.035, 0.025, 0.030}) {
+        std::unique_ptr<PDSS_ConstVol> ss(new PDSS_ConstVol());
+        ss->setMolarVolume(v);
+        p.installPDSS(k++, std::move(ss));
+    }
+    p.initThermo();
+
+    // Standard state properties evaluated together by the phase should match
+    // those computed by the individual PDSS objects
+    size_t kk = p.nSpecies();
+    vector_fp h(kk), s(kk), cp(kk), V(kk), h0(kk);
+    for (double T : {300.0, 350.0}) {
+        for (double P : {OneAtm, 50 * OneAtm}) {
+            p.setState_TP(T, P);
+            p.getEnthalpy_RT(h.data());
+            p.getEntropy_R(s.data());
+            p.getCp_R(cp.data());
+            p.getStandardVolumes(V.data());
+            p.getEnthalpy_RT_ref(h0.data());
+            for (k = 0; k < kk; k++) {
+                PDSS* ss = p.providePDSS(k);
+                ss->setState_TP(T, P);
+                EXPECT_DOUBLE_EQ(ss->enthalpy_RT(), h[k]);
+                EXPECT_DOUBLE_EQ(ss->entropy_R(), s[k]);
+                EXPECT_DOUBLE_EQ(ss->cp_R(), cp[k]);
+                EXPECT_DOUBLE_EQ(ss->molarVolume(), V[k]);
+                EXPECT_DOUBLE_EQ(ss->enthalpy_RT_ref(), h0[k]);
+            }
+        }
+    }
+}
+
+TEST(IdealMolalSoln, batchedStandardStateSSVol)
+{
+    IdealMolalSoln p;
+    p.addUndefinedElements();
+    p.addSpecies(make_species("H2O(l)", "H:2, O:1", h2o_nasa_coeffs));
+    p.addSpecies(make_species("OH(aq)", "H:1, O:1", oh_nasa_coeffs));
+    p.addSpecies(make_species("H2(aq)", "H:2", h2_nasa_coeffs));
+    p.addSpecies(make_species("O2(aq)", "O:2", o2_nasa_coeffs));
+    std::vector<std::pair<std::string, std::string>> models = {
+        {"density_temperature_polynomial", "1100.0, -0.2, -5.0e-4, 1.0e-7"},
+        {"temperature_polynomial", "1.0e-2, 1.0e-6, 3.0e-8, 1.0e-11"},
+        {"temperature_polynomial", "2.0e-2, -4.0e-6, 2.0e-8, 0.0"},
+        {"density_temperature_polynomial", "1200.0, 0.1, -8.0e-4, 2.0e-7"}
+    };
+    for (size_t k = 0; k < models.size(); k++) {
+        XML_Node node("species");
+        XML_Node& ss = node.addChild("standardState");
+        ss.addAttribute("model", models[k].first);
+        if (models[k].first == "temperature_polynomial") {
+            ss.addChild("volumeTemperaturePolynomial", models[k].second);
+        } else {
+            ss.addChild("densityTemperaturePolynomial", models[k].second);
+        }
+        std::unique_ptr<PDSS> pdss(new PDSS_SSVol());
+        pdss->setParametersFromXML(node);
+        p.installPDSS(k, std::move(pdss));
+    }
+    p.initThermo();
+
+    // Standard state properties evaluated together by the phase should match
+    // those computed by the individual PDSS objects
+    size_t kk = p.nSpecies();
+    vector_fp h(kk), s(kk), cp(kk), V(kk), hp(kk), hm(kk);
+    for (double T : {300.0, 350.0}) {
+        for (double P : {OneAtm, 500 * OneAtm}) {
+            p.setState_TP(T, P);
+            p.getEnthalpy_RT(h.data());
+            p.getEntropy_R(s.data());
+            p.getCp_R(cp.data());
+            p.getStandardVolumes(V.data());
+            for (size_t k = 0; k < kk; k++) {
+                PDSS* ss = p.providePDSS(k);
+                ss->setState_TP(T, P);
+                EXPECT_DOUBLE_EQ(ss->enthalpy_RT(), h[k]);
+                EXPECT_DOUBLE_EQ(ss->entropy_R(), s[k]);
+                EXPECT_DOUBLE_EQ(ss->cp_R(), cp[k]);
+                EXPECT_DOUBLE_EQ(ss->molarVolume(), V[k]);
+            }
+
+            // cp should be consistent with the temperature derivative of
+            // the enthalpy, including the pressure correction
+            double dT = 1e-3;
+            p.setState_TP(T + dT, P);
+            p.getEnthalpy_RT(hp.data());
+            p.setState_TP(T - dT, P);
+            p.getEnthalpy_RT(hm.data());
+            for (size_t k = 0; k < kk; k++) {
+                double cp_fd = ((T + dT) * hp[k] - (T - dT) * hm[k]) / (2 * dT);
+                EXPECT_NEAR(cp_fd, cp[k], 1e-6 * cp[k]) << k;
+            }
+        }
+    }
+}
+
 } // namespace Cantera
@@ -1,7 +1,9 @@
 #include "gtest/gtest.h"
-#include "cantera/base/ct_defs.h"
+#include "cantera/base/ctexceptions.h"
 #include "cantera/thermo/WaterPropsIAPWSphi.h"
 #include "cantera/thermo/WaterPropsIAPWS.h"
+#include "cantera/thermo/WaterPropsTable.h"
+#include "cantera/thermo/PDSS_Water.h"
 
 using namespace Cantera;
 
@@ -141,3 +143,99 @@ TEST_F(WaterPropsIAPWS_Test, expansion_coeffs)
                     beta_num[i], 2e-10 * beta_num[i]);
     }
 }
+
+TEST(WaterPropsTable, lookup)
+{
+    WaterPropsTable table;
+    WaterPropsIAPWS water;
+    WaterPropsTable::State s;
+    vector_fp TT{300.0, 450.0, 590.0, 400.0, 550.0, 1000.0};
+    vector_fp PP{1.0e5, 5.0e6, 5.0e7, 1.0e4, 2.0e6, 1.0e6};
+    std::vector<int> phase{WATER_LIQUID, WATER_LIQUID, WATER_LIQUID,
+                           WATER_GAS, WATER_GAS, WATER_GAS};
+    for (size_t i = 0; i < TT.size(); i++) {
+        ASSERT_TRUE(table.lookup(TT[i], PP[i], phase[i], s));
+        double rho = water.density(TT[i], PP[i], phase[i]);
+        double RT = GasConstant * TT[i];
+        EXPECT_NEAR(s.density, rho, 1e-5 * rho);
+        EXPECT_NEAR(s.enthalpy, water.enthalpy(), 1e-5 * RT);
+        EXPECT_NEAR(s.entropy, water.entropy(), 1e-4 * GasConstant);
+        EXPECT_NEAR(s.cp, water.cp(), 1e-4 * water.cp());
+        EXPECT_NEAR(s.cv, water.cv(), 1e-4 * water.cv());
+        EXPECT_NEAR(s.compressibility, water.isothermalCompressibility(),
+                    1e-4 * water.isothermalCompressibility());
+        EXPECT_NEAR(s.expansion, water.coeffThermExp(), 1e-3 / TT[i]);
+    }
+    EXPECT_LT(table.maxError(), 1e-2);
+}
+
+TEST(WaterPropsTable, saturation_pressure)
+{
+    WaterPropsTable table;
+    WaterPropsIAPWS water;
+    for (double T : {273.16, 300.0, 373.15, 500.0, 599.0}) {
+        double P = water.psat(T);
+        EXPECT_NEAR(table.satPressure(T), P, 1e-5 * P);
+    }
+    EXPECT_EQ(table.satPressure(640.0), -1);
+}
+
+TEST(WaterPropsTable, outside_range)
+{
+    WaterPropsTable table;
+    WaterPropsTable::State s;
+    // Critical region, pressure range and temperature range
+    EXPECT_FALSE(table.lookup(640.0, 3.0e7, WATER_LIQUID, s));
+    EXPECT_FALSE(table.lookup(300.0, 2.0e8, WATER_LIQUID, s));
+    EXPECT_FALSE(table.lookup(250.0, 1.0e5, WATER_LIQUID, s));
+    EXPECT_FALSE(table.lookup(2000.0, 1.0e5, WATER_GAS, s));
+    // Wrong side of the saturation curve
+    EXPECT_FALSE(table.lookup(400.0, 1.0e4, WATER_LIQUID, s));
+    EXPECT_FALSE(table.lookup(400.0, 1.0e6, WATER_GAS, s));
+    EXPECT_THROW(WaterPropsTable(60, 20, 273.16, 650.0), CanteraError);
+}
+
+TEST(WaterPropsTable, PDSS_Water)
+{
+    // A coarse table, so that interpolated values differ measurably from the
+    // equation of state
+    auto table = std::make_shared<WaterPropsTable>(10, 4);
+    PDSS_Water exact, water;
+    water.setTabulation(table);
+    for (double T : {300.0, 373.15, 450.0, 590.0}) {
+        for (double P : {1e5, 1e7, 5e7}) {
+            exact.setState_TP(T, P);
+            water.setState_TP(T, P);
+            double RT = GasConstant * T;
+            // The tabulated density is refined on the equation of state
+            EXPECT_NEAR(water.pressure(), P, 1e-8 * P);
+            EXPECT_NEAR(water.density(), exact.density(),
+                        1e-9 * exact.density());
+            EXPECT_NEAR(water.enthalpy_mole(), exact.enthalpy_mole(),
+                        1e-8 * RT);
+            EXPECT_NEAR(water.cp_mole(), exact.cp_mole(),
+                        1e-8 * exact.cp_mole());
+
+            // Reference state properties are interpolated
+            EXPECT_NEAR(water.enthalpy_RT_ref(), exact.enthalpy_RT_ref(),
+                        1e-3);
+            EXPECT_NEAR(water.entropy_R_ref(), exact.entropy_R_ref(), 1e-3);
+            EXPECT_NEAR(water.cp_R_ref(), exact.cp_R_ref(),
+                        1e-3 * exact.cp_R_ref());
+            EXPECT_NEAR(water.molarVolume_ref(), exact.molarVolume_ref(),
+                        1e-3 * exact.molarVolume_ref());
+        }
+    }
+    // Below the normal boiling point, the reference state properties come
+    // from the table. Above it, the liquid at the reference pressure is
+    // metastable and is not covered by the table.
+    water.setState_TP(330.0, 1e7);
+    exact.setState_TP(330.0, 1e7);
+    EXPECT_NE(water.cp_R_ref(), exact.cp_R_ref());
+
+    // Outside of the table, the full equation of state is used
+    exact.setState_TP(640.0, 3e7);
+    water.setState_TP(640.0, 3e7);
+    EXPECT_DOUBLE_EQ(water.density(), exact.density());
+    EXPECT_DOUBLE_EQ(water.cp_R_ref(), exact.cp_R_ref());
+}